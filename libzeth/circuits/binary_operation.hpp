@@ -6,6 +6,7 @@
 #define __ZETH_CIRCUITS_BINARY_OPERATION_HPP__
 
 #include "libzeth/circuits/circuit_utils.hpp"
+#include "libzeth/core/annotations.hpp"
 #include "libzeth/core/bits.hpp"
 #include "math.h"
 
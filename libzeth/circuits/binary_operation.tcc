@@ -35,7 +35,7 @@ template<typename FieldT> void xor_gadget<FieldT>::generate_r1cs_constraints()
         this->pb.add_r1cs_constraint(
             libsnark::r1cs_constraint<FieldT>(
                 2 * a[i], b[i], a[i] + b[i] - res[i]),
-            FMT(this->annotation_prefix, " xored_bits_%zu", i));
+            ZETH_FMT(this->annotation_prefix, " xored_bits_%zu", i));
     }
 }
 
@@ -95,7 +95,7 @@ void xor_constant_gadget<FieldT>::generate_r1cs_constraints()
                 b[i],
                 res[i] - c[i] - a[i] * (FieldT("1") - FieldT("2") * c[i]) -
                     b[i] * (FieldT("1") - FieldT("2") * c[i])),
-            FMT(this->annotation_prefix, " rotated_xored_bits_%zu", i));
+            ZETH_FMT(this->annotation_prefix, " rotated_xored_bits_%zu", i));
     }
 }
 
@@ -144,7 +144,7 @@ void xor_rot_gadget<FieldT>::generate_r1cs_constraints()
         this->pb.add_r1cs_constraint(
             libsnark::r1cs_constraint<FieldT>(
                 2 * a[i], b[i], a[i] + b[i] - res[(i + shift) % a.size()]),
-            FMT(this->annotation_prefix, " rotated_xored_bits_%zu", i));
+            ZETH_FMT(this->annotation_prefix, " rotated_xored_bits_%zu", i));
     }
 }
 
@@ -225,7 +225,9 @@ void double_bit32_sum_eq_gadget<FieldT>::generate_r1cs_constraints(
     if (enforce_boolean) {
         for (size_t i = 0; i < 32; i++) {
             libsnark::generate_boolean_r1cs_constraint<FieldT>(
-                this->pb, res[i], FMT(this->annotation_prefix, " res[%zu]", i));
+                this->pb,
+                res[i],
+                ZETH_FMT(this->annotation_prefix, " res[%zu]", i));
         }
     }
 
@@ -245,7 +247,7 @@ void double_bit32_sum_eq_gadget<FieldT>::generate_r1cs_constraints(
             (left_side - packed_addition(res)),
             (left_side - packed_addition(res) - pow(2, 32)),
             0),
-        FMT(this->annotation_prefix, " sum_equal_sum_constraint"));
+        ZETH_FMT(this->annotation_prefix, " sum_equal_sum_constraint"));
 }
 
 template<typename FieldT>
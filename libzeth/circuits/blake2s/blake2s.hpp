@@ -8,6 +8,7 @@
 #include "libzeth/circuits/binary_operation.hpp"
 #include "libzeth/circuits/blake2s/blake2s_comp.hpp"
 #include "libzeth/circuits/circuit_utils.hpp"
+#include "libzeth/core/annotations.hpp"
 #include "libzeth/core/bits.hpp"
 #include "libzeth/core/utils.hpp"
 
@@ -28,13 +28,15 @@ BLAKE2s_256<FieldT>::BLAKE2s_256(
     // Allocate and format the 16 input block variable
     for (size_t i = 0; i < nb_blocks; i++) {
         libsnark::digest_variable<FieldT> temp_digest(
-            pb, BLAKE2s_digest_size, FMT(this->annotation_prefix, " h_%zu", i));
+            pb,
+            BLAKE2s_digest_size,
+            ZETH_FMT(this->annotation_prefix, " h_%zu", i));
         h.emplace_back(temp_digest);
 
         libsnark::block_variable<FieldT> temp_block(
             pb,
             BLAKE2s_block_size,
-            FMT(this->annotation_prefix, " block_%zu", i));
+            ZETH_FMT(this->annotation_prefix, " block_%zu", i));
         block.emplace_back(temp_block);
     }
 
@@ -44,14 +46,14 @@ BLAKE2s_256<FieldT>::BLAKE2s_256(
             h[i],
             block[i],
             h[i + 1],
-            FMT(this->annotation_prefix, " BLAKE2sC_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " BLAKE2sC_%zu", i)));
     }
     BLAKE2sC_vector.emplace_back(BLAKE2s_256_comp<FieldT>(
         pb,
         h[nb_blocks - 1],
         block[nb_blocks - 1],
         output,
-        FMT(this->annotation_prefix, " BLAKE2sC_%zu", nb_blocks - 1)));
+        ZETH_FMT(this->annotation_prefix, " BLAKE2sC_%zu", nb_blocks - 1)));
 };
 
 template<typename FieldT>
@@ -28,7 +28,7 @@ BLAKE2s_256_comp<FieldT>::BLAKE2s_256_comp(
         block[i].allocate(
             pb,
             BLAKE2s_word_size,
-            FMT(this->annotation_prefix, " block_%zu", i));
+            ZETH_FMT(this->annotation_prefix, " block_%zu", i));
     }
 
     // Allocate the init state variables and output bytes (before swapping
@@ -37,17 +37,17 @@ BLAKE2s_256_comp<FieldT>::BLAKE2s_256_comp(
         h_array[i].allocate(
             this->pb,
             BLAKE2s_word_size,
-            FMT(this->annotation_prefix, " h_%zu", i));
+            ZETH_FMT(this->annotation_prefix, " h_%zu", i));
 
         out_temp[i].allocate(
             pb,
             BLAKE2s_word_size,
-            FMT(this->annotation_prefix, " out_temp_%zu", i));
+            ZETH_FMT(this->annotation_prefix, " out_temp_%zu", i));
 
         output_bytes[i].allocate(
             pb,
             BLAKE2s_word_size,
-            FMT(this->annotation_prefix, " output_byte_%zu", i));
+            ZETH_FMT(this->annotation_prefix, " output_byte_%zu", i));
     }
 
     // Allocate the state variables
@@ -56,7 +56,7 @@ BLAKE2s_256_comp<FieldT>::BLAKE2s_256_comp(
             v[i][j].allocate(
                 this->pb,
                 BLAKE2s_word_size,
-                FMT(this->annotation_prefix, " v_%zu", i * rounds + j));
+                ZETH_FMT(this->annotation_prefix, " v_%zu", i * rounds + j));
         }
     }
     for (size_t i = 0; i < rounds; i++) {
@@ -64,7 +64,8 @@ BLAKE2s_256_comp<FieldT>::BLAKE2s_256_comp(
             v_temp[i][j].allocate(
                 this->pb,
                 BLAKE2s_word_size,
-                FMT(this->annotation_prefix, " v_temp_%zu", i * rounds + j));
+                ZETH_FMT(
+                    this->annotation_prefix, " v_temp_%zu", i * rounds + j));
         }
     }
 
@@ -207,7 +207,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             v_temp[i][4],
             v_temp[i][8],
             v_temp[i][12],
-            FMT(this->annotation_prefix, " g_primitive_1_round_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " g_primitive_1_round_%zu", i)));
 
         g_arrays[i].emplace_back(g_primitive<FieldT>(
             this->pb,
@@ -221,7 +221,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             v_temp[i][5],
             v_temp[i][9],
             v_temp[i][13],
-            FMT(this->annotation_prefix, " g_primitive_2_round_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " g_primitive_2_round_%zu", i)));
 
         g_arrays[i].emplace_back(g_primitive<FieldT>(
             this->pb,
@@ -235,7 +235,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             v_temp[i][6],
             v_temp[i][10],
             v_temp[i][14],
-            FMT(this->annotation_prefix, " g_primitive_3_round_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " g_primitive_3_round_%zu", i)));
 
         g_arrays[i].emplace_back(g_primitive<FieldT>(
             this->pb,
@@ -249,7 +249,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             v_temp[i][7],
             v_temp[i][11],
             v_temp[i][15],
-            FMT(this->annotation_prefix, " g_primitive_4_round_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " g_primitive_4_round_%zu", i)));
 
         g_arrays[i].emplace_back(g_primitive<FieldT>(
             this->pb,
@@ -263,7 +263,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             v[i + 1][5],
             v[i + 1][10],
             v[i + 1][15],
-            FMT(this->annotation_prefix, " g_primitive_5_round_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " g_primitive_5_round_%zu", i)));
 
         g_arrays[i].emplace_back(g_primitive<FieldT>(
             this->pb,
@@ -277,7 +277,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             v[i + 1][6],
             v[i + 1][11],
             v[i + 1][12],
-            FMT(this->annotation_prefix, " g_primitive_6_round_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " g_primitive_6_round_%zu", i)));
 
         g_arrays[i].emplace_back(g_primitive<FieldT>(
             this->pb,
@@ -291,7 +291,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             v[i + 1][7],
             v[i + 1][8],
             v[i + 1][13],
-            FMT(this->annotation_prefix, " g_primitive_7_round_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " g_primitive_7_round_%zu", i)));
 
         g_arrays[i].emplace_back(g_primitive<FieldT>(
             this->pb,
@@ -305,7 +305,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             v[i + 1][4],
             v[i + 1][9],
             v[i + 1][14],
-            FMT(this->annotation_prefix, " g_primitive_8_round_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " g_primitive_8_round_%zu", i)));
     }
 
     for (size_t i = 0; i < 8; i++) {
@@ -314,7 +314,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             v[rounds][i],
             v[rounds][8 + i],
             out_temp[i],
-            FMT(this->annotation_prefix, " xor_output_temp_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " xor_output_temp_%zu", i)));
     }
 
     for (size_t i = 0; i < 8; i++) {
@@ -323,7 +323,7 @@ template<typename FieldT> void BLAKE2s_256_comp<FieldT>::setup_mixing_gadgets()
             out_temp[i],
             h_array[i],
             output_bytes[i],
-            FMT(this->annotation_prefix, " xor_output_%zu", i)));
+            ZETH_FMT(this->annotation_prefix, " xor_output_%zu", i)));
     }
 }
 
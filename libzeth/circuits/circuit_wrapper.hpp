@@ -6,10 +6,19 @@
 #define __ZETH_CIRCUITS_CIRCUIT_WRAPPER_HPP__
 
 #include "libzeth/circuits/joinsplit.tcc"
+#include "libzeth/core/arena.hpp"
 #include "libzeth/core/extended_proof.hpp"
+#include "libzeth/core/logging.hpp"
 #include "libzeth/core/note.hpp"
+#include "libzeth/core/packed_bits.hpp"
+#include "libzeth/core/r1cs_checker.hpp"
+#include "libzeth/core/r1cs_compaction.hpp"
 #include "libzeth/zeth_constants.hpp"
 #include "libzeth/core/bits.hpp"
+
+#include <memory>
+#include <mutex>
+
 namespace libzeth
 {
 
@@ -35,10 +44,25 @@ private:
         TreeDepth>>
         joinsplit_g;
 
+    // Satisfiability checker for the joinsplit circuit, built on first use
+    // and shared by all subsequent proofs.
+    mutable std::once_flag checker_init;
+    mutable std::unique_ptr<r1cs_checker<libff::Fr<ppT>>> checker;
+
+    // Compaction of the joinsplit constraint system (if enabled), built on
+    // first use.
+    const bool compact_constraints;
+    mutable std::once_flag compaction_init;
+    mutable std::unique_ptr<r1cs_compaction<libff::Fr<ppT>>> compaction;
+
 public:
     using FieldT = libff::Fr<ppT>;
 
-    circuit_wrapper();
+    // If `compact_constraints` is true, keys and proofs are generated for the
+    // constraint system with linear-only constraints removed (see
+    // r1cs_compaction). Keys generated with and without compaction are not
+    // interchangeable.
+    explicit circuit_wrapper(bool compact_constraints = false);
 
     // Generate the trusted setup
     typename snarkT::KeypairT generate_trusted_setup() const;
@@ -46,7 +70,15 @@ public:
     // Retrieve the constraint system (intended for debugging purposes).
     libsnark::protoboard<FieldT> get_constraint_system() const;
 
-    // Generate a proof and returns an extended proof
+    // Retrieve the constraint system for which keys and proofs are generated
+    // (that is, after compaction, if enabled).
+    libsnark::r1cs_constraint_system<FieldT> get_proving_constraint_system()
+        const;
+
+    // Generate a proof and returns an extended proof. The witness is first
+    // checked as specified by `check_mode`, and std::invalid_argument
+    // (describing the first unsatisfied constraints) is thrown if it does not
+    // satisfy the circuit.
     extended_proof<ppT, snarkT> prove(
         const std::array<FieldT, NumInputs> &roots,
         const std::array<joinsplit_input<FieldT, TreeDepth>, NumInputs> &inputs,
@@ -55,7 +87,14 @@ public:
         const bits64 &vpub_out,
         const bits254 &h_sig_in,
         const bits254 &phi_in,
-        const typename snarkT::ProvingKeyT &proving_key) const;
+        const typename snarkT::ProvingKeyT &proving_key,
+        r1cs_check_mode check_mode = r1cs_check_mode::sampled) const;
+
+private:
+    const r1cs_checker<FieldT> &get_checker(
+        const libsnark::protoboard<FieldT> &pb) const;
+    const r1cs_compaction<FieldT> &get_compaction(
+        const libsnark::protoboard<FieldT> &pb) const;
 };
 
 } // namespace libzeth
@@ -25,7 +25,8 @@ circuit_wrapper<
     snarkT,
     NumInputs,
     NumOutputs,
-    TreeDepth>::circuit_wrapper()
+    TreeDepth>::circuit_wrapper(bool compact_constraints)
+    : compact_constraints(compact_constraints)
 {
 }
 
@@ -62,6 +63,9 @@ typename snarkT::KeypairT circuit_wrapper<
 
     // Generate a verification and proving key (trusted setup) and write them
     // in a file
+    if (compact_constraints) {
+        return snarkT::generate_setup(get_compaction(pb).constraint_system());
+    }
     return snarkT::generate_setup(pb);
 }
 
@@ -100,6 +104,30 @@ libsnark::protoboard<libff::Fr<ppT>> circuit_wrapper<
     return pb;
 }
 
+template<
+    typename HashT,
+    typename HashTreeT,
+    typename ppT,
+    typename snarkT,
+    size_t NumInputs,
+    size_t NumOutputs,
+    size_t TreeDepth>
+libsnark::r1cs_constraint_system<libff::Fr<ppT>> circuit_wrapper<
+    HashT,
+    HashTreeT,
+    ppT,
+    snarkT,
+    NumInputs,
+    NumOutputs,
+    TreeDepth>::get_proving_constraint_system() const
+{
+    const libsnark::protoboard<FieldT> pb = get_constraint_system();
+    if (compact_constraints) {
+        return get_compaction(pb).constraint_system();
+    }
+    return pb.get_constraint_system();
+}
+
 template<
     typename HashT,
     typename HashTreeT,
@@ -124,20 +152,25 @@ extended_proof<ppT, snarkT> circuit_wrapper<
         const bits64 &vpub_out,
         const bits254 &h_sig_in,
         const bits254 &phi_in,
-        const typename snarkT::ProvingKeyT &proving_key) const
+        const typename snarkT::ProvingKeyT &proving_key,
+        r1cs_check_mode check_mode) const
 {
     // left hand side and right hand side of the joinsplit
-    bits64 lhs_value = vpub_in;
-    bits64 rhs_value = vpub_out;
+    packed_bits<ZETH_V_SIZE> lhs_value =
+        packed_bits<ZETH_V_SIZE>::from_array(vpub_in);
+    packed_bits<ZETH_V_SIZE> rhs_value =
+        packed_bits<ZETH_V_SIZE>::from_array(vpub_out);
 
     // Compute the sum on the left hand side of the joinsplit
     for (size_t i = 0; i < NumInputs; i++) {
-        lhs_value = bits_add<ZETH_V_SIZE>(lhs_value, inputs[i].note.value);
+        lhs_value = lhs_value.add(
+            packed_bits<ZETH_V_SIZE>::from_array(inputs[i].note.value));
     }
 
     // Compute the sum on the right hand side of the joinsplit
     for (size_t i = 0; i < NumOutputs; i++) {
-        rhs_value = bits_add<ZETH_V_SIZE>(rhs_value, outputs[i].value);
+        rhs_value = rhs_value.add(
+            packed_bits<ZETH_V_SIZE>::from_array(outputs[i].value));
     }
 
     // [CHECK] Make sure that the balance between rhs and lfh is respected
@@ -148,6 +181,13 @@ extended_proof<ppT, snarkT> circuit_wrapper<
         throw std::invalid_argument("invalid joinsplit balance");
     }
 
+    // The sub-gadgets are allocated from the arena of the calling thread. It
+    // is reset when `scope` is destroyed (after the gadgets, which are
+    // declared later), and its blocks are reused by the next proof computed
+    // on this thread.
+    arena &proof_arena = thread_arena();
+    arena_scope scope(proof_arena);
+
     libsnark::protoboard<FieldT> pb;
 
     joinsplit_gadget<FieldT, HashT, HashTreeT, NumInputs, NumOutputs, TreeDepth>
@@ -155,12 +195,36 @@ extended_proof<ppT, snarkT> circuit_wrapper<
     g.generate_r1cs_constraints();
     g.generate_r1cs_witness(
         roots, inputs, outputs, vpub_in, vpub_out, h_sig_in, phi_in);
+    ZETH_LOG(debug) << "Proof arena: " << proof_arena.num_allocations()
+                    << " allocations (" << proof_arena.bytes_allocated()
+                    << " bytes), capacity " << proof_arena.capacity()
+                    << " bytes";
+
+    if (check_mode != r1cs_check_mode::off) {
+        // Number of unsatisfied constraints to report
+        const size_t max_failures = 16;
+
+        libff::enter_block("Check satisfiability");
+        const std::vector<r1cs_unsatisfied_constraint> unsatisfied =
+            get_checker(pb).check(
+                pb.full_variable_assignment(), check_mode, max_failures);
+        libff::leave_block("Check satisfiability");
 
-    bool is_valid_witness = pb.is_satisfied();
-    std::cout << "******* [DEBUG] Satisfiability result: " << is_valid_witness
-              << " *******" << std::endl;
+        if (!unsatisfied.empty()) {
+            throw std::invalid_argument(
+                "witness does not satisfy the circuit: " +
+                r1cs_unsatisfied_constraints_to_string(unsatisfied));
+        }
+    }
 
-    typename snarkT::ProofT proof = snarkT::generate_proof(pb, proving_key);
+    typename snarkT::ProofT proof =
+        compact_constraints
+            ? snarkT::generate_proof(
+                  proving_key,
+                  pb.primary_input(),
+                  get_compaction(pb).auxiliary_input(
+                      pb.full_variable_assignment()))
+            : snarkT::generate_proof(pb, proving_key);
     libsnark::r1cs_primary_input<libff::Fr<ppT>> primary_input =
         pb.primary_input();
 
@@ -172,6 +236,58 @@ extended_proof<ppT, snarkT> circuit_wrapper<
     return ext_proof;
 }
 
+template<
+    typename HashT,
+    typename HashTreeT,
+    typename ppT,
+    typename snarkT,
+    size_t NumInputs,
+    size_t NumOutputs,
+    size_t TreeDepth>
+const r1cs_checker<libff::Fr<ppT>> &circuit_wrapper<
+    HashT,
+    HashTreeT,
+    ppT,
+    snarkT,
+    NumInputs,
+    NumOutputs,
+    TreeDepth>::get_checker(const libsnark::protoboard<FieldT> &pb) const
+{
+    // The constraints do not depend on the witness, so any protoboard for
+    // this circuit can be used to build the checker.
+    std::call_once(checker_init, [this, &pb]() {
+        checker.reset(new r1cs_checker<FieldT>(pb.get_constraint_system()));
+    });
+    return *checker;
+}
+
+template<
+    typename HashT,
+    typename HashTreeT,
+    typename ppT,
+    typename snarkT,
+    size_t NumInputs,
+    size_t NumOutputs,
+    size_t TreeDepth>
+const r1cs_compaction<libff::Fr<ppT>> &circuit_wrapper<
+    HashT,
+    HashTreeT,
+    ppT,
+    snarkT,
+    NumInputs,
+    NumOutputs,
+    TreeDepth>::get_compaction(const libsnark::protoboard<FieldT> &pb) const
+{
+    std::call_once(compaction_init, [this, &pb]() {
+        libff::enter_block("Compact constraint system");
+        compaction.reset(
+            new r1cs_compaction<FieldT>(pb.get_constraint_system()));
+        compaction->print_statistics();
+        libff::leave_block("Compact constraint system");
+    });
+    return *compaction;
+}
+
 } // namespace libzeth
 
 #endif // __ZETH_CIRCUITS_CIRCUIT_WRAPPER_TCC__
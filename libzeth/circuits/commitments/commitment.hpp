@@ -5,6 +5,8 @@
 // Content Taken and adapted from Zcash
 // https://github.com/zcash/zcash/blob/master/src/zcash/circuit/commitment.tcc
 
+#include "libzeth/core/annotations.hpp"
+#include "libzeth/core/arena.hpp"
 #include "libzeth/zeth_constants.hpp"
 
 #include <libsnark/gadgetlib1/gadget.hpp>
@@ -5,6 +5,7 @@
 // Content Taken and adapted from Zcash
 // https://github.com/zcash/zcash/blob/master/src/zcash/circuit/commitment.tcc
 #include "libzeth/core/field_element_utils.hpp"
+#include "libzeth/core/logging.hpp"
 #include "libzeth/core/utils.hpp"
 namespace libzeth
 {
@@ -20,10 +21,13 @@ COMM_gadget<FieldT, HashT>::COMM_gadget(
 {
         /*
     block.reset(new libsnark::block_variable<FieldT>(
-        pb, {x, y}, FMT(this->annotation_prefix, " block")));
+        pb, {x, y}, ZETH_FMT(this->annotation_prefix, " block")));
 
     hasher.reset(new HashT(
-        pb, *block, *result, FMT(this->annotation_prefix, " hasher_gadget")));
+        pb,
+        *block,
+        *result,
+        ZETH_FMT(this->annotation_prefix, " hasher_gadget")));
          */
     reverse_x.allocate(pb, 254, "reverse_x");
     reverse_y.allocate(pb, 254, "reverse_y");
@@ -35,13 +39,16 @@ COMM_gadget<FieldT, HashT>::COMM_gadget(
         pb.val(reverse_y[i]) = pb.val(y[254-1-i]);
     }
     this->pb.val(left) = reverse_x.get_field_element_from_bits(pb);
-    std::cout << "cm left: " << std::endl;
-    this->pb.val(left).print();
+    ZETH_LOG(trace) << "COMM left: "
+                    << field_element_to_hex(this->pb.val(left));
     this->pb.val(right) = reverse_y.get_field_element_from_bits(pb);
-    std::cout << "cm right: " << std::endl;
-    this->pb.val(right).print();
-    hasher.reset(new HashT(
-            pb, left, right, FMT(this->annotation_prefix, " hasher_gadget")));
+    ZETH_LOG(trace) << "COMM right: "
+                    << field_element_to_hex(this->pb.val(right));
+    hasher = arena_make_shared<HashT>(
+            pb,
+            left,
+            right,
+            ZETH_FMT(this->annotation_prefix, " hasher_gadget"));
 }
 
 template<typename FieldT, typename HashT>
@@ -55,9 +62,8 @@ template<typename FieldT, typename HashT>
 void COMM_gadget<FieldT, HashT>::generate_r1cs_witness()
 {
     hasher->generate_r1cs_witness();
-    std::cout << "cm hash result: " << std::endl;
-    this->pb.val(hasher->result()).print();
-    std::cout << "cm result hex: " << field_element_to_hex(this->pb.val(hasher->result())) << std::endl;
+    ZETH_LOG(trace) << "COMM result: "
+                    << field_element_to_hex(this->pb.val(hasher->result()));
     result->generate_r1cs_witness(libff::bit_vector(
             bits254_to_vector(bits254_from_hex(field_element_to_hex(this->pb.val(hasher->result()))))));
 }
@@ -86,12 +92,12 @@ COMM_cm_gadget<FieldT, HashT>::COMM_cm_gadget(
     input.allocate(
         pb,
         254,
-        FMT(this->annotation_prefix, " cm_input"));
+        ZETH_FMT(this->annotation_prefix, " cm_input"));
 
-    temp_result.reset(new libsnark::digest_variable<FieldT>(
+    temp_result = arena_make_shared<libsnark::digest_variable<FieldT>>(
         pb,
         HashT::get_digest_len(),
-        FMT(this->annotation_prefix, " cm_temp_output")));
+        ZETH_FMT(this->annotation_prefix, " cm_temp_output"));
 
     std::vector<bool> temp;
     std::vector<bool> apk_bits = a_pk.get_bits(pb);
@@ -105,18 +111,18 @@ COMM_cm_gadget<FieldT, HashT>::COMM_cm_gadget(
     input.fill_with_bits(pb, temp);
 
     // Allocate gadgets
-    com_gadget.reset(new COMM_gadget<FieldT, HashT>(
-        pb, trap_r, input, temp_result, annotation_prefix));
+    com_gadget = arena_make_shared<COMM_gadget<FieldT, HashT>>(
+        pb, trap_r, input, temp_result, annotation_prefix);
 
     // This gadget casts the `temp_result` from bits to field element
     // We reverse the order otherwise the resulting linear combination is built
     // by interpreting our bit string as little endian.
-    bits_to_field.reset(new libsnark::packing_gadget<FieldT>(
+    bits_to_field = arena_make_shared<libsnark::packing_gadget<FieldT>>(
         pb,
         libsnark::pb_variable_array<FieldT>(
             temp_result->bits.rbegin(), temp_result->bits.rend()),
         result,
-        FMT(this->annotation_prefix, " cm_bits_to_field")));
+        ZETH_FMT(this->annotation_prefix, " cm_bits_to_field"));
 }
 
 template<typename FieldT, typename HashT>
@@ -0,0 +1,64 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CIRCUITS_COMMITMENT_FIELD_HPP__
+#define __ZETH_CIRCUITS_COMMITMENT_FIELD_HPP__
+
+#include "libzeth/core/annotations.hpp"
+
+#include <libsnark/gadgetlib1/gadget.hpp>
+
+namespace libzeth
+{
+
+// Field-native variant of COMM_cm_gadget. The note is given as field elements
+// (linear combinations, so that the value can be packed from its bits
+// directly) and the commitment is output as a single field variable:
+//
+//   cm = HashT(a_pk, rho, trap_r, v)
+//
+// With `HashT = PoseidonSponge128<1, FieldT>`, the 4 elements are absorbed
+// by a single permutation. The sponge initializes its capacity with the
+// number of inputs, which separates this domain from the PRFs of
+// prf_field.hpp (absorbing 2 or 3 elements). As for the PRFs, `HashT` must be
+// constructible from a vector of linear combinations and provide `result()`
+// and a static `get_hash`.
+template<typename FieldT, typename HashT>
+class COMM_cm_field_gadget : public libsnark::gadget<FieldT>
+{
+public:
+    // Hash gadget used as a commitment
+    HashT hasher;
+
+    COMM_cm_field_gadget(
+        libsnark::protoboard<FieldT> &pb,
+        // ZethNote public address key
+        const libsnark::linear_combination<FieldT> &a_pk,
+        // ZethNote nullifier's preimage
+        const libsnark::linear_combination<FieldT> &rho,
+        // ZethNote randomness
+        const libsnark::linear_combination<FieldT> &trap_r,
+        // ZethNote value
+        const libsnark::linear_combination<FieldT> &value_v,
+        const std::string &annotation_prefix = "COMM_cm_field_gadget");
+
+    void generate_r1cs_constraints();
+    void generate_r1cs_witness();
+
+    // Returns the commitment
+    const libsnark::pb_variable<FieldT> &result() const;
+
+    /// Computes the commitment natively
+    static FieldT get_hash(
+        const FieldT &a_pk,
+        const FieldT &rho,
+        const FieldT &trap_r,
+        const FieldT &value_v);
+};
+
+} // namespace libzeth
+
+#include "libzeth/circuits/commitments/commitment_field.tcc"
+
+#endif // __ZETH_CIRCUITS_COMMITMENT_FIELD_HPP__
@@ -0,0 +1,61 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CIRCUITS_COMMITMENT_FIELD_TCC__
+#define __ZETH_CIRCUITS_COMMITMENT_FIELD_TCC__
+
+#include "libzeth/circuits/commitments/commitment_field.hpp"
+
+namespace libzeth
+{
+
+template<typename FieldT, typename HashT>
+COMM_cm_field_gadget<FieldT, HashT>::COMM_cm_field_gadget(
+    libsnark::protoboard<FieldT> &pb,
+    const libsnark::linear_combination<FieldT> &a_pk,
+    const libsnark::linear_combination<FieldT> &rho,
+    const libsnark::linear_combination<FieldT> &trap_r,
+    const libsnark::linear_combination<FieldT> &value_v,
+    const std::string &annotation_prefix)
+    : libsnark::gadget<FieldT>(pb, annotation_prefix)
+    , hasher(
+          pb,
+          std::vector<libsnark::linear_combination<FieldT>>{
+              a_pk, rho, trap_r, value_v},
+          ZETH_FMT(this->annotation_prefix, " hasher_gadget"))
+{
+}
+
+template<typename FieldT, typename HashT>
+void COMM_cm_field_gadget<FieldT, HashT>::generate_r1cs_constraints()
+{
+    hasher.generate_r1cs_constraints();
+}
+
+template<typename FieldT, typename HashT>
+void COMM_cm_field_gadget<FieldT, HashT>::generate_r1cs_witness()
+{
+    hasher.generate_r1cs_witness();
+}
+
+template<typename FieldT, typename HashT>
+const libsnark::pb_variable<FieldT> &COMM_cm_field_gadget<FieldT, HashT>::
+    result() const
+{
+    return hasher.result();
+}
+
+template<typename FieldT, typename HashT>
+FieldT COMM_cm_field_gadget<FieldT, HashT>::get_hash(
+    const FieldT &a_pk,
+    const FieldT &rho,
+    const FieldT &trap_r,
+    const FieldT &value_v)
+{
+    return HashT::get_hash({a_pk, rho, trap_r, value_v});
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CIRCUITS_COMMITMENT_FIELD_TCC__
@@ -7,8 +7,13 @@
 
 #include "libzeth/circuits/notes/note.hpp"
 #include "libzeth/circuits/safe_arithmetic.hpp"
+#include "libzeth/core/annotations.hpp"
+#include "libzeth/core/arena.hpp"
+#include "libzeth/core/field_element_utils.hpp"
 #include "libzeth/core/joinsplit_input.hpp"
+#include "libzeth/core/logging.hpp"
 #include "libzeth/core/merkle_tree_field.hpp"
+#include "libzeth/core/packed_bits.hpp"
 #include "libzeth/zeth_constants.hpp"
 
 #include <boost/static_assert.hpp>
@@ -164,7 +169,7 @@ public:
             /*
             merkle_root.reset(new libsnark::pb_variable<FieldT>);
             merkle_root->allocate(
-                pb, FMT(this->annotation_prefix, " merkle_root"));
+                pb, ZETH_FMT(this->annotation_prefix, " merkle_root"));
             */
             merkle_roots.allocate(pb, NumInputs, " merkle_roots");
             // Witness the merkle root
@@ -180,19 +185,19 @@ public:
                 packed_inputs[i].allocate(
                     pb,
                     1,
-                    FMT(this->annotation_prefix, " in_nullifier[%zu]", i));
+                    ZETH_FMT(this->annotation_prefix, " in_nullifier[%zu]", i));
             }
 
             // We allocate a field element for h_sig to pack its first
             // 254 bits
             packed_inputs[NumInputs].allocate(
-                pb, 1, FMT(this->annotation_prefix, " h_sig"));
+                pb, 1, ZETH_FMT(this->annotation_prefix, " h_sig"));
 
             // We allocate a field element for each message authentication tags
             // h_iS to pack their first 254 bits
             for (size_t i = NumInputs + 1; i < NumInputs + 1 + NumInputs; i++) {
                 packed_inputs[i].allocate(
-                    pb, 1, FMT(this->annotation_prefix, " h_i[%zu]", i));
+                    pb, 1, ZETH_FMT(this->annotation_prefix, " h_i[%zu]", i));
             }
 
             // We allocate as many field elements as needed to pack the public
@@ -200,7 +205,7 @@ public:
             packed_inputs[NumInputs + 1 + NumInputs].allocate(
                 pb,
                 nb_field_residual,
-                FMT(this->annotation_prefix, " residual_bits"));
+                ZETH_FMT(this->annotation_prefix, " residual_bits"));
 
             // The primary inputs are:
             // [Root, NullifierS, CommitmentS, h_sig, h_iS, Residual Field
@@ -216,40 +221,45 @@ public:
             pb.set_input_sizes(nb_inputs);
             // ---------------------------------------------------------------
 
-            ZERO.allocate(pb, FMT(this->annotation_prefix, " ZERO"));
+            ZERO.allocate(pb, ZETH_FMT(this->annotation_prefix, " ZERO"));
             // Witness `zero`
             this->pb.val(ZERO) = FieldT::zero();
 
             // Initialize the digest_variables
-            phi.reset(new libsnark::digest_variable<FieldT>(
-                pb, ZETH_PHI_SIZE, FMT(this->annotation_prefix, " phi")));
+            phi = arena_make_shared<libsnark::digest_variable<FieldT>>(
+                pb, ZETH_PHI_SIZE, ZETH_FMT(this->annotation_prefix, " phi"));
             // Witness phi
             phi->generate_r1cs_witness(
                     libff::bit_vector(bits254_to_vector(phi_in)));
 
-            h_sig.reset(new libsnark::digest_variable<FieldT>(
-                pb, ZETH_HSIG_SIZE, FMT(this->annotation_prefix, " h_sig")));
+            h_sig = arena_make_shared<libsnark::digest_variable<FieldT>>(
+                pb,
+                ZETH_HSIG_SIZE,
+                ZETH_FMT(this->annotation_prefix, " h_sig"));
             // Witness h_sig
             h_sig->generate_r1cs_witness(
                     libff::bit_vector(bits254_to_vector(h_sig_in)));
 
             for (size_t i = 0; i < NumInputs; i++) {
-                input_nullifiers[i].reset(new libsnark::digest_variable<FieldT>(
-                    pb,
-                    HashT::get_digest_len(),
-                    FMT(this->annotation_prefix, " input_nullifiers[%zu]", i)));
-                a_sks[i].reset(new libsnark::digest_variable<FieldT>(
+                input_nullifiers[i] =
+                    arena_make_shared<libsnark::digest_variable<FieldT>>(
+                        pb,
+                        HashT::get_digest_len(),
+                        ZETH_FMT(this->annotation_prefix,
+                            " input_nullifiers[%zu]",
+                            i));
+                a_sks[i] = arena_make_shared<libsnark::digest_variable<FieldT>>(
                     pb,
                     ZETH_A_SK_SIZE,
-                    FMT(this->annotation_prefix, " a_sks[%zu]", i)));
-                rhos[i].reset(new libsnark::digest_variable<FieldT>(
+                    ZETH_FMT(this->annotation_prefix, " a_sks[%zu]", i));
+                rhos[i] = arena_make_shared<libsnark::digest_variable<FieldT>>(
                         pb,
                         ZETH_RHO_SIZE,
-                        FMT(this->annotation_prefix, " rhos[%zu]", i)));
-                h_is[i].reset(new libsnark::digest_variable<FieldT>(
+                        ZETH_FMT(this->annotation_prefix, " rhos[%zu]", i));
+                h_is[i] = arena_make_shared<libsnark::digest_variable<FieldT>>(
                     pb,
                     HashT::get_digest_len(),
-                    FMT(this->annotation_prefix, " h_is[%zu]", i)));
+                    ZETH_FMT(this->annotation_prefix, " h_is[%zu]", i));
             }
 
             // Witness the a_sk and rho_iS
@@ -258,22 +268,29 @@ public:
                         bits254_to_vector(inputs[i].spending_key_a_sk)));
                 rhos[i]->generate_r1cs_witness(libff::bit_vector(
                         bits254_to_vector(inputs[i].note.rho)));
-                std::cout << "rho: " << std::endl;
-                rhos[i]->bits.get_field_element_from_bits(pb).print();
+                ZETH_LOG(trace)
+                    << "rho: "
+                    << field_element_to_hex(
+                           rhos[i]->bits.get_field_element_from_bits(pb));
             }
 
             for (size_t i = 0; i < NumOutputs; i++) {
-                rho_is[i].reset(new libsnark::digest_variable<FieldT>(
-                    pb,
-                    HashT::get_digest_len(),
-                    FMT(this->annotation_prefix, " rho_is[%zu]", i)));
+                rho_is[i] =
+                    arena_make_shared<libsnark::digest_variable<FieldT>>(
+                        pb,
+                        HashT::get_digest_len(),
+                        ZETH_FMT(this->annotation_prefix, " rho_is[%zu]", i));
             }
 
             // Allocate the zk_vpub_in and zk_vpub_out
             zk_vpub_in.allocate(
-                pb, ZETH_V_SIZE, FMT(this->annotation_prefix, " zk_vpub_in"));
+                pb,
+                ZETH_V_SIZE,
+                ZETH_FMT(this->annotation_prefix, " zk_vpub_in"));
             zk_vpub_out.allocate(
-                pb, ZETH_V_SIZE, FMT(this->annotation_prefix, " zk_vpub_out"));
+                pb,
+                ZETH_V_SIZE,
+                ZETH_FMT(this->annotation_prefix, " zk_vpub_out"));
             // Witness LHS public value
             zk_vpub_in.fill_with_bits(this->pb, bits64_to_vector(vpub_in));
             // Witness RHS public value
@@ -379,56 +396,66 @@ public:
             //
             // 1. Pack the nullifiers
             for (size_t i = 0; i < NumInputs; i++) {
-                packers[i].reset(new libsnark::multipacking_gadget<FieldT>(
-                    pb,
-                    unpacked_inputs[i],
-                    packed_inputs[i],
-                    254,
-                    FMT(this->annotation_prefix,
-                        " packer_nullifiers[%zu]",
-                        i)));
+                packers[i] =
+                    arena_make_shared<libsnark::multipacking_gadget<FieldT>>(
+                        pb,
+                        unpacked_inputs[i],
+                        packed_inputs[i],
+                        254,
+                        ZETH_FMT(this->annotation_prefix,
+                            " packer_nullifiers[%zu]",
+                            i));
             }
 
             // 2. Pack the h_sig
-            packers[NumInputs].reset(new libsnark::multipacking_gadget<FieldT>(
-                pb,
-                unpacked_inputs[NumInputs],
-                packed_inputs[NumInputs],
-                254,
-                FMT(this->annotation_prefix, " packer_h_sig")));
+            packers[NumInputs] =
+                arena_make_shared<libsnark::multipacking_gadget<FieldT>>(
+                    pb,
+                    unpacked_inputs[NumInputs],
+                    packed_inputs[NumInputs],
+                    254,
+                    ZETH_FMT(this->annotation_prefix, " packer_h_sig"));
 
             // 3. Pack the h_iS
             for (size_t i = NumInputs + 1; i < NumInputs + 1 + NumInputs; i++) {
-                packers[i].reset(new libsnark::multipacking_gadget<FieldT>(
-                    pb,
-                    unpacked_inputs[i],
-                    packed_inputs[i],
-                    254,
-                    FMT(this->annotation_prefix, " packer_h_i[%zu]", i)));
+                packers[i] =
+                    arena_make_shared<libsnark::multipacking_gadget<FieldT>>(
+                        pb,
+                        unpacked_inputs[i],
+                        packed_inputs[i],
+                        254,
+                        ZETH_FMT(
+                            this->annotation_prefix, " packer_h_i[%zu]", i));
             }
 
             // 4. Pack the other values and residual bits
-            packers[NumInputs + 1 + NumInputs].reset(
-                new libsnark::multipacking_gadget<FieldT>(
+            packers[NumInputs + 1 + NumInputs] =
+                arena_make_shared<libsnark::multipacking_gadget<FieldT>>(
                     pb,
                     unpacked_inputs[NumInputs + 1 + NumInputs],
                     packed_inputs[NumInputs + 1 + NumInputs],
                     254,
-                    FMT(this->annotation_prefix, " packer_residual_bits")));
+                    ZETH_FMT(this->annotation_prefix, " packer_residual_bits"));
 
         } // End of the block dedicated to generate the verifier inputs
 
         zk_total_uint64.allocate(
-            pb, ZETH_V_SIZE, FMT(this->annotation_prefix, " zk_total"));
+            pb, ZETH_V_SIZE, ZETH_FMT(this->annotation_prefix, " zk_total"));
 
         // Input note gadgets for commitments, nullifiers, and spend authority
         // as well as PRF gadgets for the h_iS
         for (size_t i = 0; i < NumInputs; i++) {
-            input_notes[i].reset(
-                new input_note_gadget<FieldT, HashT, HashTreeT, TreeDepth>(
-                    pb, ZERO, a_sks[i], input_nullifiers[i], rhos[i], merkle_roots[i], inputs[i].note));
-            h_i_gadgets[i].reset(new PRF_pk_gadget<FieldT, HashT>(
-                pb, ZERO, a_sks[i]->bits, h_sig->bits, i, h_is[i]));
+            input_notes[i] = arena_make_shared<
+                input_note_gadget<FieldT, HashT, HashTreeT, TreeDepth>>(
+                pb,
+                ZERO,
+                a_sks[i],
+                input_nullifiers[i],
+                rhos[i],
+                merkle_roots[i],
+                inputs[i].note);
+            h_i_gadgets[i] = arena_make_shared<PRF_pk_gadget<FieldT, HashT>>(
+                pb, ZERO, a_sks[i]->bits, h_sig->bits, i, h_is[i]);
         }
         // Witness the JoinSplit inputs and the h_is
         for (size_t i = 0; i < NumInputs; i++) {
@@ -443,16 +470,17 @@ public:
         // Ouput note gadgets for commitments as well as PRF gadgets for the
         // init and Witness the rho_is
         for (size_t i = 0; i < NumOutputs; i++) {
-            rho_i_gadgets[i].reset(new PRF_rho_gadget<FieldT, HashT>(
-                pb, ZERO, phi->bits, h_sig->bits, i, rho_is[i]));
+            rho_i_gadgets[i] = arena_make_shared<PRF_rho_gadget<FieldT, HashT>>(
+                pb, ZERO, phi->bits, h_sig->bits, i, rho_is[i]);
 
             rho_i_gadgets[i]->generate_r1cs_witness();
         }
         // init and Witness the JoinSplit outputs
         for (size_t i = 0; i < NumOutputs; i++) {
             //rho_i_gadgets[i]->generate_r1cs_witness();
-            output_notes[i].reset(new output_note_gadget<FieldT, HashT>(
-                    pb, rho_is[i], output_commitments[i], outputs[i]));
+            output_notes[i] =
+                arena_make_shared<output_note_gadget<FieldT, HashT>>(
+                    pb, rho_is[i], output_commitments[i], outputs[i]);
             output_notes[i]->generate_r1cs_witness(outputs[i]);
         }
     }
@@ -487,7 +515,7 @@ public:
             this->pb,
             ZERO,
             FieldT::zero(),
-            FMT(this->annotation_prefix, " ZERO"));
+            ZETH_FMT(this->annotation_prefix, " ZERO"));
 
         // Constrain the JoinSplit inputs and the h_iS
         for (size_t i = 0; i < NumInputs; i++) {
@@ -522,7 +550,8 @@ public:
             // Ensure that both sides are equal (ie: 1 * left_side = right_side)
             this->pb.add_r1cs_constraint(
                 libsnark::r1cs_constraint<FieldT>(1, left_side, right_side),
-                FMT(this->annotation_prefix, " lhs_rhs_equality_constraint"));
+                ZETH_FMT(
+                    this->annotation_prefix, " lhs_rhs_equality_constraint"));
 
             // See: https://github.com/zcash/zcash/issues/854
             // Ensure that `left_side` is a 64-bit integer
@@ -530,13 +559,15 @@ public:
                 libsnark::generate_boolean_r1cs_constraint<FieldT>(
                     this->pb,
                     zk_total_uint64[i],
-                    FMT(this->annotation_prefix, " zk_total_uint64[%zu]", i));
+                    ZETH_FMT(
+                        this->annotation_prefix, " zk_total_uint64[%zu]", i));
             }
 
             this->pb.add_r1cs_constraint(
                 libsnark::r1cs_constraint<FieldT>(
                     1, left_side, packed_addition(zk_total_uint64)),
-                FMT(this->annotation_prefix, " lhs_equal_zk_total_constraint"));
+                ZETH_FMT(
+                    this->annotation_prefix, " lhs_equal_zk_total_constraint"));
         }
     }
 
@@ -588,14 +619,15 @@ public:
             // We add binary numbers here see:
             // https://stackoverflow.com/questions/13282825/adding-binary-numbers-in-c
             // To check left_side_acc < 2^64, we set the function's bool to true
-            bits64 left_side_acc = vpub_in;
+            packed_bits<ZETH_V_SIZE> left_side_acc =
+                packed_bits<ZETH_V_SIZE>::from_array(vpub_in);
             for (size_t i = 0; i < NumInputs; i++) {
-                left_side_acc = bits_add<ZETH_V_SIZE>(
-                    left_side_acc, inputs[i].note.value, true);
+                left_side_acc = left_side_acc.add(
+                    packed_bits<ZETH_V_SIZE>::from_array(inputs[i].note.value),
+                    true);
             }
 
-            zk_total_uint64.fill_with_bits(
-                this->pb, bits64_to_vector(left_side_acc));
+            zk_total_uint64.fill_with_bits(this->pb, left_side_acc.to_vector());
         }
         /*
         // Witness the JoinSplit inputs and the h_is
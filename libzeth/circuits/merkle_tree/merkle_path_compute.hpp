@@ -7,6 +7,7 @@
 #define __ZETH_CIRCUITS_MERKLE_PATH_COMPUTE_HPP__
 
 #include "libzeth/circuits/merkle_tree/merkle_path_selector.hpp"
+#include "libzeth/core/annotations.hpp"
 
 namespace libzeth
 {
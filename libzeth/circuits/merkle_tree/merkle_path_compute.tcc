@@ -40,14 +40,14 @@ merkle_path_compute<FieldT, HashTreeT>::merkle_path_compute(
                 leaf,
                 path[i],
                 address_bits[i],
-                FMT(this->annotation_prefix, " selector[%zu]", i)));
+                ZETH_FMT(this->annotation_prefix, " selector[%zu]", i)));
         } else {
             selectors.push_back(merkle_path_selector<FieldT>(
                 pb,
                 hashers[i - 1].result(),
                 path[i],
                 address_bits[i],
-                FMT(this->annotation_prefix, " selector[%zu]", i)));
+                ZETH_FMT(this->annotation_prefix, " selector[%zu]", i)));
         }
 
         // We initialize the gadget to compute the next level hash input
@@ -56,7 +56,7 @@ merkle_path_compute<FieldT, HashTreeT>::merkle_path_compute(
             pb,
             {selectors[i].get_left()},
             selectors[i].get_right(),
-            FMT(this->annotation_prefix, " hasher[%zu]", i));
+            ZETH_FMT(this->annotation_prefix, " hasher[%zu]", i));
 
         // We append the initialized hasher in the vector of hashers
         hashers.push_back(t);
@@ -0,0 +1,68 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CIRCUITS_MERKLE_PATH_COMPUTE_KARY_HPP__
+#define __ZETH_CIRCUITS_MERKLE_PATH_COMPUTE_KARY_HPP__
+
+#include "libzeth/circuits/merkle_tree/merkle_path_selector_kary.hpp"
+#include "libzeth/core/annotations.hpp"
+
+namespace libzeth
+{
+
+/// Computes the root of a Merkle tree with `arity` children per node (see
+/// merkle_tree_field_kary), from a leaf, its address and its authentication
+/// path. `HashTreeT` must be constructible from a `pb_variable_array` of
+/// `arity` inputs (e.g. `Poseidon128<4, 1, FieldT>` for a 4-ary tree).
+///
+/// A 4-ary tree holds as many leaves as a binary tree of twice the depth,
+/// but a path requires half as many hashes (each absorbing 4 inputs, at
+/// roughly the cost of one binary hash for Poseidon128).
+template<typename FieldT, typename HashTreeT>
+class merkle_path_compute_kary : public libsnark::gadget<FieldT>
+{
+public:
+    const size_t depth;
+    const size_t arity;
+    // Address of the leaf to authenticate (`depth * log2(arity)` bits, least
+    // significant first)
+    const libsnark::pb_variable_array<FieldT> address_bits;
+    // Leaf to authenticate
+    const libsnark::pb_variable<FieldT> leaf;
+    // Merkle Authentication path (`depth * (arity - 1)` nodes, as returned by
+    // merkle_tree_field_kary::get_path)
+    const libsnark::pb_variable_array<FieldT> path;
+
+    // Gadgets ordering the computed hash and the authentication nodes at
+    // each level
+    std::vector<merkle_path_selector_kary<FieldT>> selectors;
+    // Vector of hash gadgets to compute the intermediary hashes
+    std::vector<HashTreeT> hashers;
+
+    merkle_path_compute_kary(
+        libsnark::protoboard<FieldT> &pb,
+        // Depth of the tree
+        const size_t depth,
+        // Number of children of each node (a power of 2)
+        const size_t arity,
+        // Address of the leaf to authenticate
+        const libsnark::pb_variable_array<FieldT> &address_bits,
+        // Leaf to authenticate
+        const libsnark::pb_variable<FieldT> leaf,
+        // Merkle Authentication path
+        const libsnark::pb_variable_array<FieldT> &path,
+        const std::string &annotation_prefix);
+
+    void generate_r1cs_constraints();
+    void generate_r1cs_witness();
+
+    // Returns the computed root
+    const libsnark::pb_variable<FieldT> result();
+};
+
+} // namespace libzeth
+
+#include "libzeth/circuits/merkle_tree/merkle_path_compute_kary.tcc"
+
+#endif // __ZETH_CIRCUITS_MERKLE_PATH_COMPUTE_KARY_HPP__
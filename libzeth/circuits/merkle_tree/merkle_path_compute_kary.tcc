@@ -0,0 +1,92 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CIRCUITS_MERKLE_PATH_COMPUTE_KARY_TCC__
+#define __ZETH_CIRCUITS_MERKLE_PATH_COMPUTE_KARY_TCC__
+
+namespace libzeth
+{
+
+template<typename FieldT, typename HashTreeT>
+merkle_path_compute_kary<FieldT, HashTreeT>::merkle_path_compute_kary(
+    libsnark::protoboard<FieldT> &pb,
+    const size_t depth,
+    const size_t arity,
+    const libsnark::pb_variable_array<FieldT> &address_bits,
+    const libsnark::pb_variable<FieldT> leaf,
+    const libsnark::pb_variable_array<FieldT> &path,
+    const std::string &annotation_prefix)
+    : libsnark::gadget<FieldT>(pb, annotation_prefix)
+    , depth(depth)
+    , arity(arity)
+    , address_bits(address_bits)
+    , leaf(leaf)
+    , path(path)
+{
+    const size_t num_bits = libff::log2(arity);
+
+    // We first assert that we are not working with an empty tree, and that
+    // the address and path are consistent with the tree size
+    assert(depth > 0);
+    assert(arity >= 2 && (1ul << num_bits) == arity);
+    assert(address_bits.size() == depth * num_bits);
+    assert(path.size() == depth * (arity - 1));
+
+    selectors.reserve(depth);
+    hashers.reserve(depth);
+    for (size_t i = 0; i < depth; i++) {
+        // The bits and authentication nodes for this level
+        const libsnark::pb_variable_array<FieldT> level_bits(
+            address_bits.begin() + i * num_bits,
+            address_bits.begin() + (i + 1) * num_bits);
+        const libsnark::pb_variable_array<FieldT> level_siblings(
+            path.begin() + i * (arity - 1),
+            path.begin() + (i + 1) * (arity - 1));
+
+        selectors.push_back(merkle_path_selector_kary<FieldT>(
+            pb,
+            (i == 0) ? leaf : hashers[i - 1].result(),
+            level_siblings,
+            level_bits,
+            ZETH_FMT(this->annotation_prefix, " selector[%zu]", i)));
+
+        // We initialize the gadget to compute the next level hash from the
+        // ordered children
+        hashers.push_back(HashTreeT(
+            pb,
+            selectors[i].get_children(),
+            ZETH_FMT(this->annotation_prefix, " hasher[%zu]", i)));
+    }
+};
+
+template<typename FieldT, typename HashTreeT>
+void merkle_path_compute_kary<FieldT, HashTreeT>::generate_r1cs_constraints()
+{
+    for (size_t i = 0; i < hashers.size(); i++) {
+        selectors[i].generate_r1cs_constraints();
+        hashers[i].generate_r1cs_constraints();
+    }
+};
+
+template<typename FieldT, typename HashTreeT>
+void merkle_path_compute_kary<FieldT, HashTreeT>::generate_r1cs_witness()
+{
+    for (size_t i = 0; i < hashers.size(); i++) {
+        selectors[i].generate_r1cs_witness();
+        hashers[i].generate_r1cs_witness();
+    }
+};
+
+template<typename FieldT, typename HashTreeT>
+const libsnark::pb_variable<FieldT> merkle_path_compute_kary<
+    FieldT,
+    HashTreeT>::result()
+{
+    assert(hashers.size() > 0);
+    return hashers.back().result();
+};
+
+} // namespace libzeth
+
+#endif // __ZETH_CIRCUITS_MERKLE_PATH_COMPUTE_KARY_TCC__
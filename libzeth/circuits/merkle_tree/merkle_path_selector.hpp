@@ -6,6 +6,8 @@
 #ifndef __ZETH_CIRCUITS_MERKLE_PATH_SELECTOR_HPP___
 #define __ZETH_CIRCUITS_MERKLE_PATH_SELECTOR_HPP___
 
+#include "libzeth/core/annotations.hpp"
+
 #include <libsnark/gadgetlib1/gadgets/basic_gadgets.hpp>
 
 // Depending on the address bit, output the correct left/right inputs
@@ -22,8 +22,8 @@ merkle_path_selector<FieldT>::merkle_path_selector(
     , is_right(is_right)
 {
     // We allocate the selector's outputs left and right
-    left.allocate(pb, FMT(this->annotation_prefix, " left"));
-    right.allocate(pb, FMT(this->annotation_prefix, " right"));
+    left.allocate(pb, ZETH_FMT(this->annotation_prefix, " left"));
+    right.allocate(pb, ZETH_FMT(this->annotation_prefix, " right"));
 };
 
 template<typename FieldT>
@@ -32,14 +32,14 @@ void merkle_path_selector<FieldT>::generate_r1cs_constraints()
     // Constrain is_right to be boolean
     this->pb.add_r1cs_constraint(
         libsnark::r1cs_constraint<FieldT>(is_right, 1 - is_right, 0),
-        FMT(this->annotation_prefix, " is_right"));
+        ZETH_FMT(this->annotation_prefix, " is_right"));
 
     // We then constrain left to be the authentication node if is_right = 1,
     // input otherwise
     this->pb.add_r1cs_constraint(
         libsnark::r1cs_constraint<FieldT>(
             is_right, pathvar - input, left - input),
-        FMT(this->annotation_prefix,
+        ZETH_FMT(this->annotation_prefix,
             " is_right*pathvar+(1-is_right)*input=left"));
 
     // Inversely, we constrain right to be the input if is_right = 1, the
@@ -47,7 +47,7 @@ void merkle_path_selector<FieldT>::generate_r1cs_constraints()
     this->pb.add_r1cs_constraint(
         libsnark::r1cs_constraint<FieldT>(
             is_right, input - pathvar, right - pathvar),
-        FMT(this->annotation_prefix,
+        ZETH_FMT(this->annotation_prefix,
             " is_right*input+(1-is_right)*pathvar=right"));
 };
 
@@ -0,0 +1,79 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CIRCUITS_MERKLE_PATH_SELECTOR_KARY_HPP__
+#define __ZETH_CIRCUITS_MERKLE_PATH_SELECTOR_KARY_HPP__
+
+#include "libzeth/core/annotations.hpp"
+
+#include <libsnark/gadgetlib1/gadgets/basic_gadgets.hpp>
+
+// Generalization of merkle_path_selector to nodes with `k = 2^m` children.
+// Given the `input` (the leaf or the output of the previous hash), its `k-1`
+// siblings and the `m` bits of its position among the children (least
+// significant first), output the `k` children in order.
+//
+// The children are built in `m` stages. Stage `i` takes the block of `2^i`
+// nodes containing the input (initially the input alone) and the block of
+// `2^i` siblings adjacent to it, and orders them using the i-th bit:
+//
+//   bit = 0: (block containing input, siblings)
+//   bit = 1: (siblings, block containing input)
+//
+// in exactly the same way as merkle_path_selector orders left and right. As
+// a consequence, the siblings are given as a block of 1 node (for bit 0),
+// followed by a block of 2 nodes (bit 1), 4 nodes (bit 2), etc. This is the
+// order returned by merkle_tree_field_kary::get_path. For `k = 2` this gadget
+// is equivalent to merkle_path_selector.
+//
+// The cost is `m` booleanity constraints and `2 * (k-1)` selection
+// constraints.
+
+namespace libzeth
+{
+
+template<typename FieldT>
+class merkle_path_selector_kary : public libsnark::gadget<FieldT>
+{
+public:
+    // The hash of the previous level or the leaf
+    const libsnark::pb_variable<FieldT> input;
+    // The `k-1` authentication nodes of the current level
+    const libsnark::pb_variable_array<FieldT> siblings;
+    // The `m` bits of the position of `input` among the children
+    const libsnark::pb_variable_array<FieldT> position_bits;
+
+    // stages[i] holds the `2^(i+1)` ordered nodes output by stage `i`. The
+    // last stage holds all children.
+    std::vector<libsnark::pb_variable_array<FieldT>> stages;
+
+    merkle_path_selector_kary(
+        libsnark::protoboard<FieldT> &pb,
+        // The hash of the previous level or the leaf
+        const libsnark::pb_variable<FieldT> &input,
+        // The authentication nodes of the current level
+        const libsnark::pb_variable_array<FieldT> &siblings,
+        // The bits of the position of `input` in the current level
+        const libsnark::pb_variable_array<FieldT> &position_bits,
+        const std::string &annotation_prefix);
+
+    void generate_r1cs_constraints();
+    void generate_r1cs_witness();
+
+    // Returns the `k` ordered inputs of the next hash to compute
+    const libsnark::pb_variable_array<FieldT> &get_children();
+
+private:
+    // The j-th node containing `input`, before stage `i`
+    const libsnark::pb_variable<FieldT> &stage_input(size_t i, size_t j) const;
+    // The j-th sibling used in stage `i`
+    const libsnark::pb_variable<FieldT> &stage_sibling(
+        size_t i, size_t j) const;
+};
+
+} // namespace libzeth
+
+#include "libzeth/circuits/merkle_tree/merkle_path_selector_kary.tcc"
+
+#endif // __ZETH_CIRCUITS_MERKLE_PATH_SELECTOR_KARY_HPP__
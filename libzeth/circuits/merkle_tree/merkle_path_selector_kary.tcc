@@ -0,0 +1,112 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CIRCUITS_MERKLE_PATH_SELECTOR_KARY_TCC__
+#define __ZETH_CIRCUITS_MERKLE_PATH_SELECTOR_KARY_TCC__
+
+namespace libzeth
+{
+
+template<typename FieldT>
+merkle_path_selector_kary<FieldT>::merkle_path_selector_kary(
+    libsnark::protoboard<FieldT> &pb,
+    const libsnark::pb_variable<FieldT> &input,
+    const libsnark::pb_variable_array<FieldT> &siblings,
+    const libsnark::pb_variable_array<FieldT> &position_bits,
+    const std::string &annotation_prefix)
+    : libsnark::gadget<FieldT>(pb, annotation_prefix)
+    , input(input)
+    , siblings(siblings)
+    , position_bits(position_bits)
+{
+    assert(position_bits.size() > 0);
+    assert(siblings.size() == (1ul << position_bits.size()) - 1);
+
+    // We allocate the outputs of each stage
+    stages.resize(position_bits.size());
+    for (size_t i = 0; i < position_bits.size(); ++i) {
+        stages[i].allocate(
+            pb, 2ul << i, ZETH_FMT(this->annotation_prefix, " stage[%zu]", i));
+    }
+}
+
+template<typename FieldT>
+void merkle_path_selector_kary<FieldT>::generate_r1cs_constraints()
+{
+    for (size_t i = 0; i < position_bits.size(); ++i) {
+        const libsnark::pb_variable<FieldT> &bit = position_bits[i];
+        const size_t half = 1ul << i;
+
+        // Constrain the position bit to be boolean
+        this->pb.add_r1cs_constraint(
+            libsnark::r1cs_constraint<FieldT>(bit, 1 - bit, 0),
+            ZETH_FMT(this->annotation_prefix, " position_bits[%zu]", i));
+
+        for (size_t j = 0; j < half; ++j) {
+            const libsnark::pb_variable<FieldT> &in = stage_input(i, j);
+            const libsnark::pb_variable<FieldT> &sibling = stage_sibling(i, j);
+
+            // The first half is the sibling if bit = 1, the input otherwise
+            this->pb.add_r1cs_constraint(
+                libsnark::r1cs_constraint<FieldT>(
+                    bit, sibling - in, stages[i][j] - in),
+                ZETH_FMT(this->annotation_prefix,
+                    " bit*sibling+(1-bit)*input=stage[%zu][%zu]",
+                    i,
+                    j));
+
+            // Inversely, the second half is the input if bit = 1, the sibling
+            // otherwise
+            this->pb.add_r1cs_constraint(
+                libsnark::r1cs_constraint<FieldT>(
+                    bit, in - sibling, stages[i][half + j] - sibling),
+                ZETH_FMT(this->annotation_prefix,
+                    " bit*input+(1-bit)*sibling=stage[%zu][%zu]",
+                    i,
+                    half + j));
+        }
+    }
+}
+
+template<typename FieldT>
+void merkle_path_selector_kary<FieldT>::generate_r1cs_witness()
+{
+    for (size_t i = 0; i < position_bits.size(); ++i) {
+        const FieldT bit = this->pb.val(position_bits[i]);
+        const size_t half = 1ul << i;
+
+        for (size_t j = 0; j < half; ++j) {
+            const FieldT in = this->pb.val(stage_input(i, j));
+            const FieldT sibling = this->pb.val(stage_sibling(i, j));
+            this->pb.val(stages[i][j]) = in + bit * (sibling - in);
+            this->pb.val(stages[i][half + j]) = sibling + bit * (in - sibling);
+        }
+    }
+}
+
+template<typename FieldT>
+const libsnark::pb_variable_array<FieldT>
+    &merkle_path_selector_kary<FieldT>::get_children()
+{
+    return stages.back();
+}
+
+template<typename FieldT>
+const libsnark::pb_variable<FieldT> &merkle_path_selector_kary<
+    FieldT>::stage_input(size_t i, size_t j) const
+{
+    return (i == 0) ? input : stages[i - 1][j];
+}
+
+template<typename FieldT>
+const libsnark::pb_variable<FieldT> &merkle_path_selector_kary<
+    FieldT>::stage_sibling(size_t i, size_t j) const
+{
+    // Stage `i` uses the block of `2^i` siblings starting at `2^i - 1`
+    return siblings[(1ul << i) - 1 + j];
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CIRCUITS_MERKLE_PATH_SELECTOR_KARY_TCC__
@@ -6,6 +6,7 @@
 #define __ZETH_CIRCUITS_MIMC_HPP__
 
 #include "libzeth/circuits/mimc/mimc_round.hpp"
+#include "libzeth/core/annotations.hpp"
 
 // MiMCe7_permutation_gadget enforces correct computation of a MiMC permutation
 // with exponent 7 and rounds 91. It makes use of MiMCe7_round_gadget to enforce
@@ -6,6 +6,7 @@
 #define __ZETH_CIRCUITS_MIMC_MP_HPP__
 
 #include "libzeth/circuits/mimc/mimc.hpp"
+#include "libzeth/core/annotations.hpp"
 
 // This gadget implements the interface of the HashTreeT template
 //
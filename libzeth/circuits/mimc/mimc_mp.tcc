@@ -18,10 +18,10 @@ MiMC_mp_gadget<FieldT>::MiMC_mp_gadget(
     , x(x)
     , y(y)
     , permutation_gadget(
-          pb, x, y, FMT(this->annotation_prefix, " permutation_gadget"))
+          pb, x, y, ZETH_FMT(this->annotation_prefix, " permutation_gadget"))
 {
     // Allocates output variable
-    output.allocate(pb, FMT(this->annotation_prefix, " output"));
+    output.allocate(pb, ZETH_FMT(this->annotation_prefix, " output"));
 }
 
 template<typename FieldT>
@@ -37,7 +37,7 @@ void MiMC_mp_gadget<FieldT>::generate_r1cs_constraints()
     this->pb.add_r1cs_constraint(
         libsnark::r1cs_constraint<FieldT>(
             permutation_gadget.result() + m + key, 1, output),
-        FMT(this->annotation_prefix, " out=k+E_k(m_i)+m_i"));
+        ZETH_FMT(this->annotation_prefix, " out=k+E_k(m_i)+m_i"));
 }
 
 template<typename FieldT>
@@ -6,6 +6,7 @@
 #define __ZETH_CIRCUITS_MIMC_ROUND_HPP__
 
 #include "libzeth/circuits/circuit_utils.hpp"
+#include "libzeth/core/annotations.hpp"
 
 #include <libsnark/gadgetlib1/gadget.hpp>
 
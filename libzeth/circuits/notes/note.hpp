@@ -9,6 +9,8 @@
 #include "libzeth/circuits/commitments/commitment.hpp"
 #include "libzeth/circuits/merkle_tree/merkle_path_authenticator.hpp"
 #include "libzeth/circuits/prfs/prf.hpp"
+#include "libzeth/core/annotations.hpp"
+#include "libzeth/core/arena.hpp"
 #include "libzeth/core/bits.hpp"
 #include "libzeth/core/note.hpp"
 
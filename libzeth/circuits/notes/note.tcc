@@ -6,6 +6,7 @@
 // https://github.com/zcash/zcash/blob/master/src/zcash/circuit/note.tcc
 
 #include "libzeth/circuits/notes/note.hpp"
+#include "libzeth/core/logging.hpp"
 
 namespace libzeth
 {
@@ -18,11 +19,11 @@ note_gadget<FieldT>::note_gadget(
     value.allocate(
         pb,
         ZETH_V_SIZE,
-        FMT(this->annotation_prefix, " value")); // ZETH_V_SIZE = 64
+        ZETH_FMT(this->annotation_prefix, " value")); // ZETH_V_SIZE = 64
     r.allocate(
         pb,
         ZETH_R_SIZE,
-        FMT(this->annotation_prefix, " r")); // ZETH_R_SIZE = 256
+        ZETH_FMT(this->annotation_prefix, " r")); // ZETH_R_SIZE = 256
 }
 */
 /*
@@ -31,12 +32,14 @@ template<typename FieldT> void note_gadget<FieldT>::generate_r1cs_constraints()
 
     for (size_t i = 0; i < ZETH_V_SIZE; i++) {
         libsnark::generate_boolean_r1cs_constraint<FieldT>(
-            this->pb, value[i], FMT(this->annotation_prefix, " value[%zu]", i));
+            this->pb,
+            value[i],
+            ZETH_FMT(this->annotation_prefix, " value[%zu]", i));
     }
 
     for (size_t i = 0; i < ZETH_R_SIZE; i++) {
         libsnark::generate_boolean_r1cs_constraint<FieldT>(
-            this->pb, r[i], FMT(this->annotation_prefix, " r[%zu]", i));
+            this->pb, r[i], ZETH_FMT(this->annotation_prefix, " r[%zu]", i));
     }
 
 }
@@ -68,30 +71,32 @@ input_note_gadget<FieldT, HashT, HashTreeT, TreeDepth>::input_note_gadget(
     // ZETH_RHO_SIZE = 256
     //rho.allocate(pb, ZETH_RHO_SIZE, " rho");
     address_bits_va.allocate(
-        pb, TreeDepth, FMT(this->annotation_prefix, " merkle_tree_depth"));
-    a_pk.reset(new libsnark::digest_variable<FieldT>(
-        pb, HashT::get_digest_len(), FMT(this->annotation_prefix, " a_pk")));
-    commitment.allocate(pb, FMT(this->annotation_prefix, " commitment"));
+        pb, TreeDepth, ZETH_FMT(this->annotation_prefix, " merkle_tree_depth"));
+    a_pk = arena_make_shared<libsnark::digest_variable<FieldT>>(
+        pb,
+        HashT::get_digest_len(),
+        ZETH_FMT(this->annotation_prefix, " a_pk"));
+    commitment.allocate(pb, ZETH_FMT(this->annotation_prefix, " commitment"));
 
-    libsnark::pb_variable_array<FieldT> *pb_auth_path =
-        new libsnark::pb_variable_array<FieldT>();
-    pb_auth_path->allocate(
-        pb, TreeDepth, FMT(this->annotation_prefix, " authentication_path"));
-    auth_path.reset(pb_auth_path);
+    auth_path = arena_make_shared<libsnark::pb_variable_array<FieldT>>();
+    auth_path->allocate(
+        pb,
+        TreeDepth,
+        ZETH_FMT(this->annotation_prefix, " authentication_path"));
 
     // Call to the "PRF_addr_a_pk_gadget" to make sure a_pk is correctly
     // computed from a_sk
-    spend_authority.reset(
-        new PRF_addr_a_pk_gadget<FieldT, HashT>(pb, ZERO, a_sk->bits, a_pk));
+    spend_authority = arena_make_shared<PRF_addr_a_pk_gadget<FieldT, HashT>>(
+        pb, ZERO, a_sk->bits, a_pk);
 
     // Witness a_pk for a_sk with PRF_addr
-    std::cout << "Witness PRF_addr_a_pk_gadget" << std::endl;
+    ZETH_LOG(trace) << "Witness PRF_addr_a_pk_gadget";
     spend_authority->generate_r1cs_witness();
 
     // Call to the "PRF_nf_gadget" to make sure the nullifier is correctly
     // computed from a_sk and rho
-    expose_nullifiers.reset(
-        new PRF_nf_gadget<FieldT, HashT>(pb, ZERO, a_sk->bits, rho->bits, nullifier));
+    expose_nullifiers = arena_make_shared<PRF_nf_gadget<FieldT, HashT>>(
+        pb, ZERO, a_sk->bits, rho->bits, nullifier);
 
     // Below this point, we need to do several calls
     // to the commitment gagdets.
@@ -117,36 +122,38 @@ input_note_gadget<FieldT, HashT, HashTreeT, TreeDepth>::input_note_gadget(
     value.allocate(
             pb,
             ZETH_V_SIZE,
-            FMT(this->annotation_prefix, " value")); // ZETH_V_SIZE = 64
+            ZETH_FMT(this->annotation_prefix, " value")); // ZETH_V_SIZE = 64
     r.allocate(
             pb,
             ZETH_R_SIZE,
-            FMT(this->annotation_prefix, " r")); // ZETH_R_SIZE = 256
+            ZETH_FMT(this->annotation_prefix, " r")); // ZETH_R_SIZE = 256
     r.fill_with_bits(this->pb, bits254_to_vector(note.r));
     value.fill_with_bits(this->pb, bits64_to_vector(note.value));
-    commit_to_inputs_cm.reset(new COMM_cm_gadget<FieldT, HashT>(
-        pb, a_pk->bits, rho->bits, r, value, commitment));
+    commit_to_inputs_cm = arena_make_shared<COMM_cm_gadget<FieldT, HashT>>(
+        pb, a_pk->bits, rho->bits, r, value, commitment);
 
     // We do not forget to allocate the `value_enforce` variable
     // since it is submitted to boolean constraints
-    value_enforce.allocate(pb, FMT(this->annotation_prefix, " value_enforce"));
+    value_enforce.allocate(
+        pb, ZETH_FMT(this->annotation_prefix, " value_enforce"));
 
     // This gadget makes sure that the computed
     // commitment is in the merkle tree of root rt
     // We finally compute a root from the (field) commitment and the
     // authentication path We furthermore check, depending on value_enforce, if
     // the computed root is equal to the current one
-    check_membership.reset(new merkle_path_authenticator<FieldT, HashTreeT>(
-        pb,
-        TreeDepth,
-        address_bits_va,
-        commitment,
-        rt,
-        *auth_path,
-        value_enforce, // boolean that is set to ONE if the cm needs to be in
-                       // the tree of root rt (and if the given path needs to be
-                       // correct), ZERO otherwise
-        FMT(this->annotation_prefix, " auth_path")));
+    check_membership =
+        arena_make_shared<merkle_path_authenticator<FieldT, HashTreeT>>(
+            pb,
+            TreeDepth,
+            address_bits_va,
+            commitment,
+            rt,
+            *auth_path,
+            value_enforce, // boolean that is set to ONE if the cm needs to be
+                           // in the tree of root rt (and if the given path
+                           // needs to be correct), ZERO otherwise
+            ZETH_FMT(this->annotation_prefix, " auth_path"));
 }
 
 template<typename FieldT, typename HashT, typename HashTreeT, size_t TreeDepth>
@@ -160,12 +167,12 @@ void input_note_gadget<FieldT, HashT, HashTreeT, TreeDepth>::
     /*
     for (size_t i = 0; i < ZETH_RHO_SIZE; i++) { // ZETH_RHO_SIZE = 256
         libsnark::generate_boolean_r1cs_constraint<FieldT>(
-            this->pb, rho[i], FMT(this->annotation_prefix, " rho"));
+            this->pb, rho[i], ZETH_FMT(this->annotation_prefix, " rho"));
     }
      */
 
 
-    std::cout << "enter PRF_addr_a_pk_gadget" << std::endl;
+    ZETH_LOG(trace) << "Constraints of PRF_addr_a_pk_gadget";
 
     spend_authority->generate_r1cs_constraints();
     expose_nullifiers->generate_r1cs_constraints();
@@ -178,13 +185,14 @@ void input_note_gadget<FieldT, HashT, HashTreeT, TreeDepth>::
     libsnark::generate_boolean_r1cs_constraint<FieldT>(
         this->pb,
         value_enforce,
-        FMT(this->annotation_prefix, " value_enforce"));
+        ZETH_FMT(this->annotation_prefix, " value_enforce"));
     */
 
     this->pb.add_r1cs_constraint(
         libsnark::r1cs_constraint<FieldT>(
             packed_addition(this->value), (1 - value_enforce), 0),
-        FMT(this->annotation_prefix, " wrap_constraint_mkpath_dummy_inputs"));
+        ZETH_FMT(
+            this->annotation_prefix, " wrap_constraint_mkpath_dummy_inputs"));
 
     check_membership->generate_r1cs_constraints();
 }
@@ -202,11 +210,11 @@ void input_note_gadget<FieldT, HashT, HashTreeT, TreeDepth>::
     // Witness rho for the input note
     //rho.fill_with_bits(this->pb, bits254_to_vector(note.rho));
     // Witness the nullifier for the input note
-    std::cout << "Witness PRF_nf_gadget" << std::endl;
+    ZETH_LOG(trace) << "Witness PRF_nf_gadget";
     expose_nullifiers->generate_r1cs_witness();
 
     // Witness the commitment of the input note
-    std::cout << "Witness COMM_cm_gadget" << std::endl;
+    ZETH_LOG(trace) << "Witness COMM_cm_gadget";
     commit_to_inputs_cm->generate_r1cs_witness();
 
     // Set enforce flag for nonzero input value
@@ -233,7 +241,7 @@ void input_note_gadget<FieldT, HashT, HashTreeT, TreeDepth>::
     //                  source[i] - target[i],
     //                  0
     //              ),
-    //              FMT(
+    //              ZETH_FMT(
     //                  this->annotation_prefix, "
     //                  copying_check_%zu", i));
     //      }
@@ -281,8 +289,8 @@ void input_note_gadget<FieldT, HashT, HashTreeT, TreeDepth>::
     // rejected.
     this->pb.val(value_enforce) =
         (note.is_zero_valued()) ? FieldT::zero() : FieldT::one();
-    std::cout << "[DEBUG] Value of `value_enforce`: "
-              << (this->pb.val(value_enforce)).as_ulong() << std::endl;
+    ZETH_LOG(debug) << "Value of `value_enforce`: "
+                    << (this->pb.val(value_enforce)).as_ulong();
 
     // Witness merkle tree authentication path
     address_bits_va.fill_with_bits(this->pb, address_bits);
@@ -303,22 +311,24 @@ output_note_gadget<FieldT, HashT>::output_note_gadget(
     const std::string &annotation_prefix)
     : libsnark::gadget<FieldT>(pb, annotation_prefix)
 {
-    a_pk.reset(new libsnark::digest_variable<FieldT>(
-        pb, HashT::get_digest_len(), FMT(this->annotation_prefix, " a_pk")));
+    a_pk = arena_make_shared<libsnark::digest_variable<FieldT>>(
+        pb,
+        HashT::get_digest_len(),
+        ZETH_FMT(this->annotation_prefix, " a_pk"));
     a_pk->bits.fill_with_bits(pb, bits254_to_vector(note.a_pk));
     // Commit to the output notes publicly without disclosing them.
     value.allocate(
             pb,
             ZETH_V_SIZE,
-            FMT(this->annotation_prefix, " value")); // ZETH_V_SIZE = 64
+            ZETH_FMT(this->annotation_prefix, " value")); // ZETH_V_SIZE = 64
     r.allocate(
             pb,
             ZETH_R_SIZE,
-            FMT(this->annotation_prefix, " r")); // ZETH_R_SIZE = 256
+            ZETH_FMT(this->annotation_prefix, " r")); // ZETH_R_SIZE = 256
     r.fill_with_bits(pb, bits254_to_vector(note.r));
     value.fill_with_bits(pb, bits64_to_vector(note.value));
-    commit_to_outputs_cm.reset(new COMM_cm_gadget<FieldT, HashT>(
-            pb, a_pk->bits, rho->bits, r, value, commitment));
+    commit_to_outputs_cm = arena_make_shared<COMM_cm_gadget<FieldT, HashT>>(
+            pb, a_pk->bits, rho->bits, r, value, commitment);
 }
 
 template<typename FieldT, typename HashT>
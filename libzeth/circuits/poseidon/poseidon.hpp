@@ -5,8 +5,13 @@
 // License: LGPL-3.0+
 
 #include "blake2b.hpp"
+#include "libzeth/circuits/poseidon/poseidon_alt_bn128_constants.hpp"
+#include "libzeth/core/annotations.hpp"
 
-#include <mutex>
+#include <stdexcept>
+#if defined(CURVE_ALT_BN128)
+#include <libff/algebra/curves/alt_bn128/alt_bn128_init.hpp>
+#endif
 
 namespace libzeth {
 
@@ -20,6 +25,44 @@ struct PoseidonConstants
 	std::vector<FieldT> M; // `t * t` matrix of constants
 };
 
+/**
+* Constants for the optimized partial rounds (see Poseidon_PartialRounds).
+*
+* Each partial round computes `M * S(state + C_i)`, where `S` applies the
+* S-box to the first element only. Two equivalent transformations are applied
+* to the sequence of partial rounds:
+*
+*    - the round constant added to elements `1..t-1` passes linearly through
+*      the round, so it is carried forward (multiplied by `M`) into the next
+*      round. Each round then adds a single constant (to the S-box input) and
+*      the accumulated remainder is added to the output of the last round.
+*
+*    - `M` is factored as `M'' * M'` where `M' = diag(1, M_hat)` (`M_hat`
+*      being the lower-right `(t-1)*(t-1)` block). `M'` does not touch the
+*      first element, so it commutes with `S` and is moved into the previous
+*      round, leaving the sparse `M''`:
+*
+*          | M_00  M_row |
+*          | M_col   I   |
+*
+*      The `M'` of the first partial round is applied once, to the input
+*      state.
+*
+* The permutation is unchanged, but each partial round costs `O(t)` rather
+* than `O(t^2)` operations, both when building the linear combinations and
+* when computing the witness.
+*/
+template<typename FieldT>
+struct PoseidonPartialRoundConstants
+{
+	std::vector<FieldT> M_initial;  // `(t-1) * (t-1)` matrix, applied to state[1..t-1] before the first round
+	std::vector<FieldT> C_sbox;     // `P` constants, added to the S-box input of each round
+	std::vector<FieldT> M_00;       // `P` elements, M''[0][0] of each round
+	std::vector<FieldT> M_row;      // `P * (t-1)` elements, M''[0][1..t-1] of each round
+	std::vector<FieldT> M_col;      // `P * (t-1)` elements, M''[1..t-1][0] of each round
+	std::vector<FieldT> C_final;    // `t` constants, added to the state after the last round
+};
+
 template<typename FieldT>
 class FifthPower_gadget : public libsnark::gadget<FieldT> {
 public:
@@ -34,18 +77,18 @@ public:
        libsnark::gadget<FieldT>(pb, annotation_prefix)
 	{
         x2.allocate(
-                pb, FMT(this->annotation_prefix, ".x2"));
+                pb, ZETH_FMT(this->annotation_prefix, ".x2"));
         x4.allocate(
-                pb, FMT(this->annotation_prefix, ".x4"));
+                pb, ZETH_FMT(this->annotation_prefix, ".x4"));
         x5.allocate(
-                pb, FMT(this->annotation_prefix, ".x5"));
+                pb, ZETH_FMT(this->annotation_prefix, ".x5"));
 	}
 
 	void generate_r1cs_constraints(const linear_combination<FieldT>& x) const
 	{
-        this->pb.add_r1cs_constraint(libsnark::r1cs_constraint<FieldT>(x, x, x2), FMT(this->annotation_prefix, ".x^2 = x * x"));
-        this->pb.add_r1cs_constraint(libsnark::r1cs_constraint<FieldT>(x2, x2, x4), FMT(this->annotation_prefix, ".x^4 = x2 * x2"));
-        this->pb.add_r1cs_constraint(libsnark::r1cs_constraint<FieldT>(x, x4, x5), FMT(this->annotation_prefix, ".x^5 = x * x4"));
+        this->pb.add_r1cs_constraint(libsnark::r1cs_constraint<FieldT>(x, x, x2), ZETH_FMT(this->annotation_prefix, ".x^2 = x * x"));
+        this->pb.add_r1cs_constraint(libsnark::r1cs_constraint<FieldT>(x2, x2, x4), ZETH_FMT(this->annotation_prefix, ".x^4 = x2 * x2"));
+        this->pb.add_r1cs_constraint(libsnark::r1cs_constraint<FieldT>(x, x4, x5), ZETH_FMT(this->annotation_prefix, ".x^5 = x * x4"));
 	}
 
 	void generate_r1cs_witness(const FieldT& val_x) const
@@ -149,18 +192,254 @@ static const std::vector<FieldT> poseidon_matrix(const std::string &seed, unsign
 }
 
 
+/**
+* Inverts the `n * n` (row-major) matrix `in_M`, using Gauss-Jordan elimination.
+*/
+template<typename FieldT>
+static void poseidon_matrix_inverse(const std::vector<FieldT> &in_M, unsigned n, std::vector<FieldT> &result)
+{
+	std::vector<FieldT> m(in_M);
+	result.assign(n * n, FieldT::zero());
+	for( unsigned i = 0; i < n; i++ )
+	{
+		result[i*n+i] = FieldT::one();
+	}
+
+	for( unsigned col = 0; col < n; col++ )
+	{
+		unsigned pivot = col;
+		while( pivot < n && m[pivot*n+col].is_zero() ) {
+			pivot++;
+		}
+		if( pivot == n ) {
+			throw std::invalid_argument("poseidon: singular matrix");
+		}
+
+		if( pivot != col )
+		{
+			for( unsigned j = 0; j < n; j++ )
+			{
+				std::swap(m[pivot*n+j], m[col*n+j]);
+				std::swap(result[pivot*n+j], result[col*n+j]);
+			}
+		}
+
+		const FieldT pivot_inv = m[col*n+col].inverse();
+		for( unsigned j = 0; j < n; j++ )
+		{
+			m[col*n+j] *= pivot_inv;
+			result[col*n+j] *= pivot_inv;
+		}
+
+		for( unsigned i = 0; i < n; i++ )
+		{
+			if( i == col || m[i*n+col].is_zero() ) {
+				continue;
+			}
+			const FieldT factor = m[i*n+col];
+			for( unsigned j = 0; j < n; j++ )
+			{
+				m[i*n+j] -= factor * m[col*n+j];
+				result[i*n+j] -= factor * result[col*n+j];
+			}
+		}
+	}
+}
+
+template<unsigned param_t, unsigned param_P, typename FieldT>
+static void poseidon_partial_round_constants_fill(
+	const std::vector<FieldT> &in_C,
+	const std::vector<FieldT> &in_M,
+	PoseidonPartialRoundConstants<FieldT> &result )
+{
+	const unsigned n = param_t - 1;
+
+	// Carry the constants of elements 1..t-1 forward, from the first round to
+	// the last: next = C_{i+1} + M * (0, current[1..t-1])
+	std::vector<FieldT> current(param_t, in_C[0]);
+	result.C_sbox.reserve(param_P);
+	for( unsigned r = 0; r < param_P; r++ )
+	{
+		result.C_sbox.emplace_back(current[0]);
+
+		std::vector<FieldT> next(param_t, (r + 1 < param_P) ? in_C[r + 1] : FieldT::zero());
+		for( unsigned i = 0; i < param_t; i++ )
+		{
+			for( unsigned j = 1; j < param_t; j++ )
+			{
+				next[i] += in_M[i*param_t+j] * current[j];
+			}
+		}
+		current.swap(next);
+	}
+	result.C_final = current;
+
+	// Factor the matrices, from the last round to the first. `N` is the
+	// (dense) matrix of the current round, including the `M'` moved from the
+	// following round.
+	result.M_00.resize(param_P);
+	result.M_row.resize(param_P * n);
+	result.M_col.resize(param_P * n);
+
+	std::vector<FieldT> N(in_M);
+	std::vector<FieldT> N_hat(n * n);
+	std::vector<FieldT> N_hat_inv;
+	for( unsigned r = param_P; r-- > 0; )
+	{
+		for( unsigned i = 0; i < n; i++ )
+		{
+			for( unsigned j = 0; j < n; j++ )
+			{
+				N_hat[i*n+j] = N[(i+1)*param_t + j+1];
+			}
+		}
+		poseidon_matrix_inverse(N_hat, n, N_hat_inv);
+
+		// M'' = | N_00  N_row * N_hat^-1 |
+		//       | N_col        I         |
+		result.M_00[r] = N[0];
+		for( unsigned j = 0; j < n; j++ )
+		{
+			result.M_col[r*n+j] = N[(j+1)*param_t];
+
+			FieldT row_j = FieldT::zero();
+			for( unsigned k = 0; k < n; k++ )
+			{
+				row_j += N[k+1] * N_hat_inv[k*n+j];
+			}
+			result.M_row[r*n+j] = row_j;
+		}
+
+		if( r == 0 ) {
+			break;
+		}
+
+		// N = diag(1, N_hat) * M, for the previous round
+		for( unsigned j = 0; j < param_t; j++ )
+		{
+			N[j] = in_M[j];
+		}
+		for( unsigned i = 0; i < n; i++ )
+		{
+			for( unsigned j = 0; j < param_t; j++ )
+			{
+				FieldT sum = FieldT::zero();
+				for( unsigned k = 0; k < n; k++ )
+				{
+					sum += N_hat[i*n+k] * in_M[(k+1)*param_t + j];
+				}
+				N[(i+1)*param_t + j] = sum;
+			}
+		}
+	}
+	result.M_initial = N_hat;
+}
+
+template<unsigned param_t, unsigned param_F, unsigned param_P, typename FieldT>
+PoseidonConstants<FieldT> poseidon_params_derive()
+{
+	PoseidonConstants<FieldT> constants;
+	poseidon_constants_fill<FieldT>("poseidon_constants", param_F + param_P, constants.C);
+	poseidon_matrix_fill("poseidon_matrix_0000", param_t, constants.M);
+	return constants;
+}
+
+template<unsigned param_t, unsigned param_F, unsigned param_P, typename FieldT>
+PoseidonPartialRoundConstants<FieldT> poseidon_partial_round_params_derive(const PoseidonConstants<FieldT>& params)
+{
+	PoseidonPartialRoundConstants<FieldT> constants;
+	const std::vector<FieldT> partial_C(
+		params.C.begin() + (param_F/2),
+		params.C.begin() + (param_F/2) + param_P);
+	poseidon_partial_round_constants_fill<param_t, param_P>(partial_C, params.M, constants);
+	return constants;
+}
+
+/**
+* Source of the constants for a given instance. By default, constants are
+* derived at runtime (hashing, conversions and inversions). Instances used by
+* Zeth are specialized to load tables generated, in Montgomery form, by
+* scripts/generate_poseidon_constants.
+*/
 template<unsigned param_t, unsigned param_F, unsigned param_P, typename FieldT>
-PoseidonConstants<FieldT>& poseidon_params()
+struct PoseidonConstantsTable
+{
+	static const bool precomputed = false;
+
+	static PoseidonConstants<FieldT> load()
+	{
+		return poseidon_params_derive<param_t, param_F, param_P, FieldT>();
+	}
+
+	static PoseidonPartialRoundConstants<FieldT> load_partial(const PoseidonConstants<FieldT>& params)
+	{
+		return poseidon_partial_round_params_derive<param_t, param_F, param_P, FieldT>(params);
+	}
+};
+
+#if defined(CURVE_ALT_BN128) && (GMP_NUMB_BITS == 64)
+
+template<typename FieldT, size_t N>
+static std::vector<FieldT> poseidon_table_load(const uint64_t (&in_table)[N][4])
+{
+	static_assert(FieldT::num_limbs == 4, "unexpected number of limbs");
+
+	std::vector<FieldT> result(N);
+	for( size_t i = 0; i < N; i++ )
+	{
+		for( unsigned l = 0; l < 4; l++ )
+		{
+			result[i].mont_repr.data[l] = in_table[i][l];
+		}
+	}
+	return result;
+}
+
+template<>
+struct PoseidonConstantsTable<6, 8, 57, libff::alt_bn128_Fr>
 {
-    static PoseidonConstants<FieldT> constants;
-    static std::once_flag flag;
+	typedef libff::alt_bn128_Fr FieldT;
+
+	static const bool precomputed = true;
+
+	static PoseidonConstants<FieldT> load()
+	{
+		PoseidonConstants<FieldT> constants;
+		constants.C = poseidon_table_load<FieldT>(poseidon_alt_bn128_C);
+		constants.M = poseidon_table_load<FieldT>(poseidon_alt_bn128_M);
+		return constants;
+	}
 
-    std::call_once(flag, [](){
-    	poseidon_constants_fill<FieldT>("poseidon_constants", param_F + param_P, constants.C);
-        poseidon_matrix_fill("poseidon_matrix_0000", param_t, constants.M);
-    });
+	static PoseidonPartialRoundConstants<FieldT> load_partial(const PoseidonConstants<FieldT>&)
+	{
+		PoseidonPartialRoundConstants<FieldT> constants;
+		constants.M_initial = poseidon_table_load<FieldT>(poseidon_alt_bn128_partial_M_initial);
+		constants.C_sbox = poseidon_table_load<FieldT>(poseidon_alt_bn128_partial_C_sbox);
+		constants.M_00 = poseidon_table_load<FieldT>(poseidon_alt_bn128_partial_M_00);
+		constants.M_row = poseidon_table_load<FieldT>(poseidon_alt_bn128_partial_M_row);
+		constants.M_col = poseidon_table_load<FieldT>(poseidon_alt_bn128_partial_M_col);
+		constants.C_final = poseidon_table_load<FieldT>(poseidon_alt_bn128_partial_C_final);
+		return constants;
+	}
+};
+
+#endif // defined(CURVE_ALT_BN128) && (GMP_NUMB_BITS == 64)
+
+template<unsigned param_t, unsigned param_F, unsigned param_P, typename FieldT>
+const PoseidonConstants<FieldT>& poseidon_params()
+{
+	static const PoseidonConstants<FieldT> constants =
+		PoseidonConstantsTable<param_t, param_F, param_P, FieldT>::load();
+	return constants;
+}
 
-    return constants;
+template<unsigned param_t, unsigned param_F, unsigned param_P, typename FieldT>
+const PoseidonPartialRoundConstants<FieldT>& poseidon_partial_round_params()
+{
+	static const PoseidonPartialRoundConstants<FieldT> constants =
+		PoseidonConstantsTable<param_t, param_F, param_P, FieldT>::load_partial(
+			poseidon_params<param_t, param_F, param_P, FieldT>());
+	return constants;
 }
 template<typename FieldT>
 std::vector<libsnark::linear_combination<FieldT>> VariableArrayT_to_lc( const libsnark::pb_variable_array<FieldT>& in_vars )
@@ -211,7 +490,7 @@ public:
 		ret.reserve(nSBox);
 		for( unsigned h = 0; h < nSBox; h++ )
 		{
-			ret.emplace_back( in_pb, FMT(annotation_prefix, ".sbox[%u]", h) );
+			ret.emplace_back( in_pb, ZETH_FMT(annotation_prefix, ".sbox[%u]", h) );
 		}
 
 		return ret;
@@ -316,12 +595,175 @@ public:
 };
 
 
+/**
+* Applies the `P` partial rounds to `state` (of `t` elements), using the
+* constants of PoseidonPartialRoundConstants. If `sbox_inputs` is not null,
+* it receives the input of the S-box of each round.
+*/
+template<unsigned param_t, unsigned param_P, typename FieldT>
+void poseidon_partial_rounds_native(
+	const PoseidonPartialRoundConstants<FieldT>& constants,
+	std::vector<FieldT>& state,
+	std::vector<FieldT>* sbox_inputs )
+{
+	const unsigned n = param_t - 1;
+
+	// Apply M' of the first round to state[1..t-1]
+	const std::vector<FieldT> in_rest(state.begin() + 1, state.end());
+	for( unsigned i = 0; i < n; i++ )
+	{
+		FieldT sum = FieldT::zero();
+		for( unsigned j = 0; j < n; j++ )
+		{
+			sum += constants.M_initial[i*n+j] * in_rest[j];
+		}
+		state[i+1] = sum;
+	}
+
+	if( sbox_inputs ) {
+		sbox_inputs->resize(param_P);
+	}
+
+	for( unsigned r = 0; r < param_P; r++ )
+	{
+		const FieldT sbox_in = state[0] + constants.C_sbox[r];
+		if( sbox_inputs ) {
+			(*sbox_inputs)[r] = sbox_in;
+		}
+
+		const FieldT sbox_in2 = sbox_in * sbox_in;
+		const FieldT sbox_out = sbox_in2 * sbox_in2 * sbox_in;
+		FieldT x_0 = constants.M_00[r] * sbox_out;
+		for( unsigned j = 0; j < n; j++ )
+		{
+			x_0 += constants.M_row[r*n+j] * state[j+1];
+			state[j+1] += constants.M_col[r*n+j] * sbox_out;
+		}
+		state[0] = x_0;
+	}
+
+	for( unsigned i = 0; i < param_t; i++ )
+	{
+		state[i] += constants.C_final[i];
+	}
+}
+
+/**
+* The block of `P` partial rounds, evaluated using the sparse matrices and
+* constants of PoseidonPartialRoundConstants. Allocates exactly the same
+* variables as `P` consecutive partial Poseidon_Round gadgets, and produces
+* outputs equal to theirs.
+*/
+template<unsigned param_t, unsigned param_P, typename FieldT>
+class Poseidon_PartialRounds : public libsnark::gadget<FieldT> {
+public:
+	const PoseidonPartialRoundConstants<FieldT>& constants;
+	const std::vector<libsnark::linear_combination<FieldT> > state;
+	const std::vector<FifthPower_gadget<FieldT>> sboxes;
+	std::vector<libsnark::linear_combination<FieldT> > sbox_inputs;
+	std::vector<libsnark::linear_combination<FieldT> > outputs;
+
+	static std::vector<FifthPower_gadget<FieldT>> make_sboxes(
+            libsnark::protoboard<FieldT>& in_pb,
+		unsigned round_begin,
+		const std::string& annotation_prefix )
+	{
+		std::vector<FifthPower_gadget<FieldT>> ret;
+
+		ret.reserve(param_P);
+		for( unsigned r = 0; r < param_P; r++ )
+		{
+			ret.emplace_back( in_pb, ZETH_FMT(annotation_prefix, ".round[%u].sbox[0]", round_begin + r) );
+		}
+
+		return ret;
+	}
+
+	Poseidon_PartialRounds(
+            libsnark::protoboard<FieldT> &in_pb,
+            const PoseidonPartialRoundConstants<FieldT>& in_constants,
+            const std::vector<libsnark::linear_combination<FieldT> >& in_state,
+		unsigned round_begin,
+            const std::string& annotation_prefix
+	) :
+            libsnark::gadget<FieldT>(in_pb, annotation_prefix),
+		constants(in_constants),
+		state(in_state),
+		sboxes(make_sboxes(in_pb, round_begin, annotation_prefix))
+	{
+		const unsigned n = param_t - 1;
+
+		// Apply M' of the first round to state[1..t-1]
+		std::vector<libsnark::linear_combination<FieldT> > x;
+		x.reserve(param_t);
+		x.emplace_back(in_state[0]);
+		for( unsigned i = 0; i < n; i++ )
+		{
+			linear_combination<FieldT> lc;
+			for( unsigned j = 0; j < n; j++ )
+			{
+				lc = lc + (in_state[j+1] * constants.M_initial[i*n+j]);
+			}
+			x.emplace_back(lc);
+		}
+
+		sbox_inputs.reserve(param_P);
+		for( unsigned r = 0; r < param_P; r++ )
+		{
+			sbox_inputs.emplace_back(x[0] + constants.C_sbox[r]);
+
+			// The S-box output has a higher index than any variable in the
+			// state, so appending it keeps the terms sorted.
+			const libsnark::pb_variable<FieldT>& sbox_out = sboxes[r].result();
+			linear_combination<FieldT> x_0(sbox_out * constants.M_00[r]);
+			for( unsigned j = 0; j < n; j++ )
+			{
+				x_0 = x_0 + (x[j+1] * constants.M_row[r*n+j]);
+				x[j+1].add_term(sbox_out, constants.M_col[r*n+j]);
+			}
+			x[0] = x_0;
+		}
+
+		outputs.reserve(param_t);
+		for( unsigned i = 0; i < param_t; i++ )
+		{
+			outputs.emplace_back(x[i] + constants.C_final[i]);
+		}
+	}
+
+	void generate_r1cs_witness() const
+	{
+		std::vector<FieldT> x;
+		x.reserve(param_t);
+		for( const auto &lc : state )
+		{
+			x.emplace_back(lc_val<FieldT>(this->pb, lc));
+		}
+
+		std::vector<FieldT> sbox_input_vals;
+		poseidon_partial_rounds_native<param_t, param_P, FieldT>(constants, x, &sbox_input_vals);
+		for( unsigned r = 0; r < param_P; r++ )
+		{
+			sboxes[r].generate_r1cs_witness( sbox_input_vals[r] );
+		}
+	}
+
+	void generate_r1cs_constraints() const
+	{
+		for( unsigned r = 0; r < param_P; r++ )
+		{
+			sboxes[r].generate_r1cs_constraints( sbox_inputs[r] );
+		}
+	}
+};
+
+
 template<unsigned param_t, unsigned param_c, unsigned param_F, unsigned param_P, unsigned nInputs, unsigned nOutputs, typename FieldT, bool constrainOutputs=true>
 class Poseidon_gadget_T : public libsnark::gadget<FieldT>
 {
 protected:
 	typedef Poseidon_Round<param_t, param_t, nInputs, param_t, FieldT> FirstRoundT;    // ingests `nInput` elements, expands to `t` elements using round constants
-	typedef Poseidon_Round<param_t, param_c, param_t, param_t, FieldT> PartialRoundT;  // partial round only runs sbox on `c` elements (capacity)
+	typedef Poseidon_PartialRounds<param_t, param_P, FieldT> PartialRoundsT;         // all partial rounds, which only run the sbox on the first element
 	typedef Poseidon_Round<param_t, param_t, param_t, param_t, FieldT> FullRoundT;     // full bandwidth
 	typedef Poseidon_Round<param_t, param_t, param_t, nOutputs, FieldT> LastRoundT;   // squeezes state into `nOutputs`
 
@@ -334,15 +776,18 @@ protected:
 	static constexpr unsigned partial_end = (partial_begin + param_P);
 	static constexpr unsigned total_rounds = param_F + param_P;
 
+	static_assert(param_c == 1, "partial rounds only support a single sbox");
+	static_assert(nInputs >= 1 && nInputs <= (param_t - param_c), "inputs must fit in the rate");
+
 public:
     const libsnark::pb_variable<FieldT> x;
     const libsnark::pb_variable<FieldT> y;
-    const libsnark::pb_variable_array<FieldT>& inputs;
+    const libsnark::pb_variable_array<FieldT> inputs;
 	const PoseidonConstants<FieldT>& constants;
 	
 	FirstRoundT first_round;	
 	std::vector<FullRoundT> prefix_full_rounds;
-	std::vector<PartialRoundT> partial_rounds;
+	PartialRoundsT partial_rounds;
 	std::vector<FullRoundT> suffix_full_rounds;
 	LastRoundT last_round;
 
@@ -363,7 +808,7 @@ public:
 		for( unsigned i = n_begin; i < n_end; i++ )
 		{
 			const auto& state = (i == n_begin) ? inputs : result.back().outputs;
-			result.emplace_back(pb, constants.C[i], constants.M, state, FMT(annotation_prefix, ".round[%u]", i));
+			result.emplace_back(pb, constants.C[i], constants.M, state, ZETH_FMT(annotation_prefix, ".round[%u]", i));
 		}
 
 		return result;
@@ -436,6 +881,20 @@ public:
 
         return pb.val(hasher.result());
     }
+    static FieldT get_hash(const std::vector<FieldT>& in_values)
+    {
+        assert( in_values.size() == nInputs );
+
+        libsnark::protoboard<FieldT> pb;
+        libsnark::pb_variable_array<FieldT> ar;
+
+        ar.allocate(pb, nInputs, "ar");
+        ar.fill_with_field_elements(pb, in_values);
+        Poseidon_gadget_T<param_t, param_c, param_F, param_P, nInputs, 1, FieldT> hasher (pb, ar, "gadget");
+        hasher.generate_r1cs_witness();
+
+        return pb.val(hasher.result());
+    }
     static size_t get_digest_len()
     {
         return 254;
@@ -452,22 +911,51 @@ public:
         y(y),
 		inputs(make_var_array(pb, "inputs", x, y)),
 		constants(poseidon_params<param_t, param_F, param_P, FieldT>()),
-		first_round(pb, constants.C[0], constants.M, make_var_array(pb, "inputs", x, y), FMT(annotation_prefix, ".round[0]")),
+		first_round(pb, constants.C[0], constants.M, make_var_array(pb, "inputs", x, y), ZETH_FMT(annotation_prefix, ".round[0]")),
+		prefix_full_rounds(
+			make_rounds<FullRoundT>(
+				1, partial_begin, pb,
+				first_round.outputs, constants, annotation_prefix)),
+		partial_rounds(
+			pb, poseidon_partial_round_params<param_t, param_F, param_P, FieldT>(),
+			prefix_full_rounds.back().outputs, partial_begin, annotation_prefix),
+		suffix_full_rounds(
+			make_rounds<FullRoundT>(
+				partial_end, total_rounds-1, pb,
+				partial_rounds.outputs, constants, annotation_prefix)),
+		last_round(pb, constants.C.back(), constants.M, suffix_full_rounds.back().outputs, ZETH_FMT(annotation_prefix, ".round[%u]", total_rounds-1)),
+		_output_vars(constrainOutputs ? make_var_array(pb, nOutputs, ".output") : libsnark::pb_variable_array<FieldT>())
+	{
+	}
+
+	// Absorbs all `nInputs` elements of `in_inputs` (`x` and `y` are set to the
+	// first two)
+	Poseidon_gadget_T(
+            libsnark::protoboard<FieldT> &pb,
+		const libsnark::pb_variable_array<FieldT>& in_inputs,
+		const std::string& annotation_prefix
+	) :
+        libsnark::gadget<FieldT>(pb, annotation_prefix),
+        x(in_inputs[0]),
+        y(in_inputs[(nInputs > 1) ? 1 : 0]),
+		inputs(in_inputs),
+		constants(poseidon_params<param_t, param_F, param_P, FieldT>()),
+		first_round(pb, constants.C[0], constants.M, in_inputs, ZETH_FMT(annotation_prefix, ".round[0]")),
 		prefix_full_rounds(
 			make_rounds<FullRoundT>(
 				1, partial_begin, pb,
 				first_round.outputs, constants, annotation_prefix)),
 		partial_rounds(
-			make_rounds<PartialRoundT>(
-				partial_begin, partial_end, pb,
-				prefix_full_rounds.back().outputs, constants, annotation_prefix)),
+			pb, poseidon_partial_round_params<param_t, param_F, param_P, FieldT>(),
+			prefix_full_rounds.back().outputs, partial_begin, annotation_prefix),
 		suffix_full_rounds(
 			make_rounds<FullRoundT>(
 				partial_end, total_rounds-1, pb,
-				partial_rounds.back().outputs, constants, annotation_prefix)),
-		last_round(pb, constants.C.back(), constants.M, suffix_full_rounds.back().outputs, FMT(annotation_prefix, ".round[%u]", total_rounds-1)),
+				partial_rounds.outputs, constants, annotation_prefix)),
+		last_round(pb, constants.C.back(), constants.M, suffix_full_rounds.back().outputs, ZETH_FMT(annotation_prefix, ".round[%u]", total_rounds-1)),
 		_output_vars(constrainOutputs ? make_var_array(pb, nOutputs, ".output") : libsnark::pb_variable_array<FieldT>())
 	{
+		assert( in_inputs.size() == nInputs );
 	}
 
 	template<bool x = constrainOutputs>
@@ -506,9 +994,7 @@ public:
 			prefix_round.generate_r1cs_constraints();
 		}
 
-		for( auto& partial_round : partial_rounds ) {
-			partial_round.generate_r1cs_constraints();
-		}
+		partial_rounds.generate_r1cs_constraints();
 
 		for( auto& suffix_round : suffix_full_rounds ) {
 			suffix_round.generate_r1cs_constraints();
@@ -523,7 +1009,7 @@ public:
 			{
 				this->pb.add_r1cs_constraint(
                         libsnark::r1cs_constraint<FieldT>(lc, ONE, _output_vars[i]),
-					FMT(this->annotation_prefix, ".output[%u] = last_round.output[%u]", i, i));
+					ZETH_FMT(this->annotation_prefix, ".output[%u] = last_round.output[%u]", i, i));
 				i += 1;
 			}
 		}
@@ -538,9 +1024,7 @@ public:
 			prefix_round.generate_r1cs_witness();
 		}
 
-		for( auto& partial_round : partial_rounds ) {
-			partial_round.generate_r1cs_witness();
-		}
+		partial_rounds.generate_r1cs_witness();
 
 		for( auto& suffix_round : suffix_full_rounds ) {
 			suffix_round.generate_r1cs_witness();
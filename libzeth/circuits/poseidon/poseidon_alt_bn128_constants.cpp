@@ -0,0 +1,852 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+// Generated by scripts/generate_poseidon_constants. DO NOT EDIT.
+
+#include "libzeth/circuits/poseidon/poseidon_alt_bn128_constants.hpp"
+
+namespace libzeth
+{
+
+const uint64_t poseidon_alt_bn128_C[65][4] = {
+    {0xf305ba9cb9636423ULL, 0x35a29cdfadef0b0bULL, 0xa50f03af897b61fdULL, 0x071d2b0a58ba4c96ULL},
+    {0x715c102862a7c054ULL, 0x48968f2add0f4908ULL, 0xe3af103abc57fc13ULL, 0x0bdc70f3eb5ee36eULL},
+    {0x940ecd6d69c114bcULL, 0x074622cbda8b15d7ULL, 0xd644bac48bb17d72ULL, 0x179f154344e573a4ULL},
+    {0x87114797eaf23695ULL, 0x7de45b60626db66fULL, 0xe3e76182c6b7098fULL, 0x0d622ca13bf10067ULL},
+    {0x9afb27b5a5e5a371ULL, 0x2310230843a775c0ULL, 0x5ae9345367aee9e1ULL, 0x174d85de81b00505ULL},
+    {0x530f4620de134271ULL, 0xf7eb154bc8393b21ULL, 0xa51ce56f92e0c834ULL, 0x19643aef53956854ULL},
+    {0x4915c38a114972b8ULL, 0x86b090cb5b891577ULL, 0xdbadd51d658d6f90ULL, 0x275162a79b26b12aULL},
+    {0x07625f85576a9d0fULL, 0xae9916a3d7ccb4ccULL, 0xf83b53b54a1c6ae6ULL, 0x1a1bf7526caa666fULL},
+    {0x62919b0976b9878dULL, 0x427f3f8ae061e17fULL, 0xe33de032be8c7565ULL, 0x111bec769d568ff1ULL},
+    {0xf217231a8a846eb7ULL, 0x3428a1e1423c20acULL, 0x4422c03a96c8af5dULL, 0x246a46d9a7f94246ULL},
+    {0x4277da953ce9dbfaULL, 0xf78bbea010f8f716ULL, 0xef6abc9a6b1538c3ULL, 0x228396d1675cd847ULL},
+    {0x751e37f421d8bedeULL, 0x40adf92e19d706efULL, 0x6a1547f63a63a1efULL, 0x234a98d4cd05d102ULL},
+    {0xc326badced7773f1ULL, 0xab555806c7205616ULL, 0x08b882e196620535ULL, 0x176d2f676ccc9884ULL},
+    {0x656be36c59506ca4ULL, 0xc66bff14021591fdULL, 0xb1d0f4c1a428eb79ULL, 0x09e1cb54a76dd5bfULL},
+    {0x8637e4db4d12140cULL, 0x6e0a6b05b810b6f0ULL, 0x97d5c5243af47f46ULL, 0x240974a8ef21f52aULL},
+    {0xf27a396fd052f968ULL, 0xe6f9ce5cc91f9cbaULL, 0xc97a8914ac510c0aULL, 0x00ea6f983192df35ULL},
+    {0xd9c6749a0de61c12ULL, 0xb9427debaff4a72dULL, 0x8d7ded3db36e3156ULL, 0x237f93f612e3de5fULL},
+    {0x02771531dc1d9d77ULL, 0xa26448d4cba77ac5ULL, 0x984478270f217e43ULL, 0x16b162ba25fc2876ULL},
+    {0x30a811f91721154bULL, 0xa6c0818a7ddd35d2ULL, 0x78350ef35a20f284ULL, 0x1535632e042a655cULL},
+    {0x6b0d0ae1d5c9ff85ULL, 0xac41444af529d615ULL, 0x9ffe19f6ba5a0dcbULL, 0x2aa0301a7a1f458eULL},
+    {0x1c26360cf278b36cULL, 0x3eed5875303678f6ULL, 0xe8f3f261a768b529ULL, 0x24d148ac85522955ULL},
+    {0x02df5e59a99c9418ULL, 0xc552650af096e0a9ULL, 0x4216fc2f6610d7ceULL, 0x2661bd34df7268dfULL},
+    {0x9c6de042ac1142dbULL, 0x6c487233432ab56fULL, 0x063e9cbd75f6d727ULL, 0x0322a4f42b1fffd5ULL},
+    {0x67c2b916a595b59bULL, 0x15de5e6894c02877ULL, 0xac3db1912739e0e1ULL, 0x27d64afa0e5ef22eULL},
+    {0xcd99c171735fb7eaULL, 0xdd7f3911e36639f3ULL, 0x9e495f988772e42eULL, 0x0a44eb7a340e7225ULL},
+    {0xbb093a64f828e9feULL, 0x38904603ca44f28cULL, 0x94ebef1fec9a4b81ULL, 0x2629d4df66ab2be4ULL},
+    {0x1fee4fc1ade89b8cULL, 0x858db168875830d1ULL, 0x7b98f3eb622d5a49ULL, 0x27590ab5aedf0d73ULL},
+    {0xbb80059daa4edd6bULL, 0x55c2f3f4e9446d58ULL, 0xa2ea22b8c9663ef5ULL, 0x10e3df792435b779ULL},
+    {0x82c7d8c9e9f3eaaeULL, 0xcf133bc45a1ad2c5ULL, 0xdc499e262dcf7521ULL, 0x2a2aaaef7173064dULL},
+    {0x7157627d8573cd11ULL, 0x5043b0c68e3abd1fULL, 0xa24d96888cef0f15ULL, 0x1a9dc3c7615e7f08ULL},
+    {0xd0914077716afd52ULL, 0x4fcbe11c3bcad39fULL, 0x914749934148c9f3ULL, 0x04159ded57b96d65ULL},
+    {0x180ffea776bc8666ULL, 0xc534915e39ea9f40ULL, 0x453fa31443753682ULL, 0x2aecb2d11761dfcfULL},
+    {0x91c36b4d8110e928ULL, 0x3d1b238230fd039bULL, 0xee47f8568969a48aULL, 0x26c8fc728039f9a7ULL},
+    {0x4f1486660f4ab3d4ULL, 0xccdb962bb101f411ULL, 0x5cf100a6e2cc437cULL, 0x10783c938270e4bfULL},
+    {0xe6101f982195ba8bULL, 0xccd71839229aaf54ULL, 0xf34042f14ec792d7ULL, 0x1f05059bbcd74fe5ULL},
+    {0xa4d30387898e8c9eULL, 0x6e60e747b7ca9d66ULL, 0x46b131b659d36253ULL, 0x2ea528e1d4f2433dULL},
+    {0x8170c2c07ad25121ULL, 0x4ab7070cfc8b3ec6ULL, 0x4ec3206ce0318fdfULL, 0x02b3dbe03e8ab9a0ULL},
+    {0x674f9c91b9344b77ULL, 0x91c0b9b458b714a7ULL, 0x30e8a619a194d07fULL, 0x10509aa7f6fb9748ULL},
+    {0x3d4db9e85a3a33e5ULL, 0xef381c503d9c40c1ULL, 0x1670e6950c488a8dULL, 0x0d6dbb88ce765d14ULL},
+    {0x4d069730fdb9c0d5ULL, 0x6b03197ce7360313ULL, 0xa285e906150d8b1eULL, 0x1628d5d8f22c3ebaULL},
+    {0xf3c5f41cc1ac2cc0ULL, 0x3c89b34cb8dfdce1ULL, 0x510bd2ab3d21d912ULL, 0x196cbfe2333f0d88ULL},
+    {0x77b338b86ef3c619ULL, 0xbb6c3d7842396947ULL, 0x5e11fc3a3648884dULL, 0x2fda5e4742c0b0c4ULL},
+    {0xee32ccbb9ef7d5e2ULL, 0x798fd6d31ed0e8e1ULL, 0xc1675935235cbad6ULL, 0x0e398dfa4a2d2ba4ULL},
+    {0xfc0dd228a7d8f3deULL, 0xcce2d80b7185d8c0ULL, 0x82a7a396bac90677ULL, 0x234aae35d18bfe0cULL},
+    {0x85fcacae2213ac54ULL, 0xd3d002e924a184abULL, 0x965f6a4d1ce16060ULL, 0x0da9150a517c5b31ULL},
+    {0xaa93407d518a02d4ULL, 0x67b3e20e9723591dULL, 0xbaeebee8006f3d5cULL, 0x2ee764890e0f6035ULL},
+    {0x042287f027fff008ULL, 0x96ff56800e8a6c6dULL, 0x470463cfe048ed5bULL, 0x13b93b9d0b668856ULL},
+    {0x9345ce166d7c2f6cULL, 0xe48c355fac3e3c15ULL, 0x8f06426f6b762d6cULL, 0x05caf15976f2f5ccULL},
+    {0x58982ec88c4b99edULL, 0xe77cdf05bed9a8fcULL, 0x09e133394e888db8ULL, 0x06d3ca8724757727ULL},
+    {0xd922d979cee94b4bULL, 0x7070f248ec8ac135ULL, 0xa08285afe3d9b3c9ULL, 0x1c98144750b407f6ULL},
+    {0x5d790645682d60e6ULL, 0x8e95785a03c74391ULL, 0xdb295fb1c6901eabULL, 0x102f44f49549ec9aULL},
+    {0xefe5398ef410c32eULL, 0x5202ee6373a211caULL, 0x6bbeca3d7aca9abfULL, 0x20e0bc40dc14c6eaULL},
+    {0x3e39d5fb74a20f55ULL, 0x91a07fd3a6968f25ULL, 0xa984918ae53756ebULL, 0x20bab57bf25c5e47ULL},
+    {0xdf6c8ad0f44be36aULL, 0x69c1fd3f2bd9e2fbULL, 0x50880c1f18c94d80ULL, 0x2dc077df9b89cc16ULL},
+    {0x9f3515fa0620f6a0ULL, 0x9fcdf8f582873478ULL, 0x777a43124a000c5aULL, 0x148e73205df17850ULL},
+    {0xb873e47b8ef34d9bULL, 0x58b20306c0d9db58ULL, 0xd575a2aaf55d75e5ULL, 0x2fbdcd3c8d42bbffULL},
+    {0xbd42ec6f43a54d29ULL, 0xa39160da1bfd4de3ULL, 0x6cba306b84d4e5d7ULL, 0x2fd1a0c6a635e189ULL},
+    {0x37553faed8fdd870ULL, 0x1204cfd0edd971ebULL, 0x9884e09320a46026ULL, 0x155917e3ee9c3fb6ULL},
+    {0x620e94117a7f1cd7ULL, 0x37152fc5ce05022eULL, 0x28f5d99bbaf59ba5ULL, 0x1663e6c725538a59ULL},
+    {0xe837977e315d8132ULL, 0x69c05d0d6763e8aaULL, 0x18f3ca6e8e144360ULL, 0x2ccef0671962ebd6ULL},
+    {0xe5f0d5bb41606a27ULL, 0x6b2c0a734eb84666ULL, 0xf9e8a1a004db2a32ULL, 0x209db6dbc6b41916ULL},
+    {0xb9f5f2b27fa3b78cULL, 0x6dc7591f0c929bc5ULL, 0x4add747af458cb41ULL, 0x20496ccd004d68bcULL},
+    {0xc442bdf5785215d1ULL, 0xf17f1d521a78b1c6ULL, 0x9413e4a4acf14fd7ULL, 0x1738d0bc37bda044ULL},
+    {0x4e9efd734faf158fULL, 0xb666f7ae21d79782ULL, 0x78af30c92c006577ULL, 0x21a620459c164bc5ULL},
+    {0xe76379f014682019ULL, 0xbd9b65fa064efd2bULL, 0x67d5b640d47f6094ULL, 0x033c8b8c62f056d5ULL},
+};
+
+const uint64_t poseidon_alt_bn128_M[36][4] = {
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x2dc043d7f62c9284ULL, 0x04110e8b84ddb033ULL, 0x31fb4bb763925c05ULL, 0x28e08139ee143e2aULL},
+    {0xdd68ee03ae7b7660ULL, 0x4c170d7ed9768612ULL, 0xe9f312295329c00eULL, 0x0014bc4b93fad7bcULL},
+    {0x753bddb62c974362ULL, 0x0a633e46f6a87d23ULL, 0x39c3da467ee32867ULL, 0x0b4152555ce35db4ULL},
+    {0x61196088d6379488ULL, 0xaeab59a7528c0717ULL, 0x63273630fb77cd09ULL, 0x01aefe4cae15a4bcULL},
+    {0x877a4d4a187128ddULL, 0x10f00476303470a1ULL, 0x963e13f75cb2fdceULL, 0x1f99ebf365887777ULL},
+    {0xf73b92a9c0e4b612ULL, 0x3dfba5bc1c3c2e89ULL, 0x3696b65cc6bb9116ULL, 0x218e1630d185fba8ULL},
+    {0x241c6022e080aa4aULL, 0x819ce162d1959439ULL, 0x44c98063a41e7f9dULL, 0x17eed2775df17ef1ULL},
+    {0x7136ba31bd5a532aULL, 0x97fea0fe46873637ULL, 0xdbc14024d806152dULL, 0x13e198c9ffdc0539ULL},
+    {0x0b196b5c44f57c05ULL, 0x87b67fefb48fa319ULL, 0x272cf78246dbbfb8ULL, 0x0fc54145d5f9493aULL},
+    {0xc159f9dc4fed289fULL, 0x5c611ecd67100dcbULL, 0xf2a03557e180c2a2ULL, 0x2fde4f80c3db1378ULL},
+    {0xfc2d82ef88a475fcULL, 0xc70dfe413d92de00ULL, 0x4b1c9c1869fac500ULL, 0x24a59f9be62f4905ULL},
+    {0x69496a6f37455229ULL, 0x99d25feefcb6c2f7ULL, 0x5cf2fe166f4ad4c4ULL, 0x2c1dfa4eea709cc5ULL},
+    {0xf2f916c953f561f3ULL, 0x65101eb845a6e870ULL, 0x6fc1a720c4ae120fULL, 0x04d466a47d6fbd74ULL},
+    {0x8a45aef8d23a97bfULL, 0xa97f75cfd63f689dULL, 0x2327a4a1bd9ee971ULL, 0x0c33abc815a5f9afULL},
+    {0xa5a77cbdce74de26ULL, 0x0a1e7b7959bb2e05ULL, 0x488c542ca5eb91bbULL, 0x0a2fd5012fd2117aULL},
+    {0x2f7a179c15f1cf3cULL, 0xe694530222c9c495ULL, 0x3b5ea9d74a3ce24aULL, 0x2145729ea6e450d2ULL},
+    {0xe79d0277d42da3b6ULL, 0xb866a0c7f8e5b9caULL, 0x0b425f6f114fc5c1ULL, 0x2e875673a02b2f80ULL},
+    {0xc124c9a4b24bef7fULL, 0xeed23c36fa87277eULL, 0xf985df818e1162d4ULL, 0x073f3f0f8f27bfe1ULL},
+    {0x99ec0a305f4071c8ULL, 0x0c3f20a470567b6cULL, 0x0c49ae1d8cb4423fULL, 0x063059c3da6a6e51ULL},
+    {0xd54bded39ba6826aULL, 0xf9af1f3fbd823eb2ULL, 0xcdab7763004ae035ULL, 0x0a04e914b04e3ef2ULL},
+    {0xd0380085e871c9b5ULL, 0xbbd2c55149740ab4ULL, 0x3d21cd933c1723daULL, 0x2bb589c839448c77ULL},
+    {0xe586ba98b6ab7c31ULL, 0x6df29addacb5247cULL, 0xf5ade20a3c949d64ULL, 0x2ab6afbe3e1f2e2cULL},
+    {0xad4c3c22834de6a0ULL, 0x981c9656f3375a8aULL, 0x161000b4384ff1b6ULL, 0x0ce1d4ce7ca1b06eULL},
+    {0xa8a34329964a656eULL, 0x5d63ef107772fc57ULL, 0x2225c7e080e80208ULL, 0x2b6be511caf79895ULL},
+    {0xe752d53f5d78e220ULL, 0xa1912d23af62ac51ULL, 0x3068eb0a2a01b91eULL, 0x2c2d6b768953d337ULL},
+    {0x93678163b10524beULL, 0x4b188b04d7c11af1ULL, 0x8047779659f026e8ULL, 0x0cf1cb8023d548dcULL},
+    {0xedf5e6b8bf09a8a1ULL, 0xa500e2e40a2229eeULL, 0x80551df584c7070eULL, 0x0e58e2f843ee9a62ULL},
+    {0xed80f3fbabff3c10ULL, 0xdf46be903753dcd0ULL, 0x3652d361f6ff3d73ULL, 0x19a80a07bd4b92b3ULL},
+    {0x4c6aa65ce0a62083ULL, 0xcdba556650a1da21ULL, 0xb5a064314da9e1b2ULL, 0x1f05832b21d96113ULL},
+    {0xe3b1af9c4bd30c68ULL, 0x78fd7c38ee9976fdULL, 0x695020853f333cd9ULL, 0x09f5f229ee4c4dd9ULL},
+    {0x88ea49fdc63b80a9ULL, 0x0f3ecc464862aad3ULL, 0x7bd47aa8117d12fbULL, 0x06e9c425d05e710bULL},
+    {0xfacb62ffa6d0867eULL, 0xf11548ad4cb3eab2ULL, 0xb99ca21c99995d49ULL, 0x1b73c51117b7d413ULL},
+    {0x6d32c3888be29f6aULL, 0x90bcbb81fd6fd5c4ULL, 0x292c44093859006dULL, 0x01bb5de65658fab0ULL},
+    {0x64e48e9804e188f2ULL, 0x93f9e51d9015e98fULL, 0xc57ccf4765d49542ULL, 0x24f99372bb052c41ULL},
+    {0x3190655383860cc9ULL, 0xb08a67f13c9a157fULL, 0x16ff5a3a2c8331b4ULL, 0x14dc5cc10c3b37b0ULL},
+};
+
+const uint64_t poseidon_alt_bn128_partial_M_initial[25][4] = {
+    {0x39daba3444d0e7e1ULL, 0xb8eb933f27b249e4ULL, 0x42e3c36140c41015ULL, 0x18f549cfeaccda3eULL},
+    {0x0b989a066108e86eULL, 0x9c03460c4363fec1ULL, 0x000df5c9cacdc306ULL, 0x1fadf5e0c6af26aeULL},
+    {0xa845bf2ff398625cULL, 0x528782c6bc9c9860ULL, 0xc2a0b71400f8087eULL, 0x2f64458ae2b2f67fULL},
+    {0x4951790b3afad887ULL, 0x5255b38486dde85bULL, 0xad9d039cf2036193ULL, 0x21800fd6d95e68d4ULL},
+    {0xfad8f59435b02f52ULL, 0x86ece2aecce7ed1fULL, 0x96dfebc4fca3b5e4ULL, 0x1729270fb2b04d9dULL},
+    {0x0fff41551e691e3aULL, 0x928168e03629bc25ULL, 0xfd5d52e1a9fd8243ULL, 0x2523daf5ee33f736ULL},
+    {0x5aaeb0aa08383002ULL, 0x892b7cd4aeeeedbeULL, 0xd748d2829b59917fULL, 0x208cbb3a5ef9ecd8ULL},
+    {0xfbef1f02078cbd5cULL, 0xec529fa06cee6789ULL, 0x65ee06320001396eULL, 0x00bd951589b395f0ULL},
+    {0x13dc6a0bfc951a0aULL, 0x04c92e8e2fd3faf1ULL, 0x40682282c0122b5aULL, 0x0a8900575da634c5ULL},
+    {0x7bfa0e7ea6184489ULL, 0x343aae14192359a0ULL, 0x066710fd8452c4f9ULL, 0x2217d2659220a857ULL},
+    {0x1dd503a9b5887f09ULL, 0xefa4899097d002ebULL, 0x9e85a01442b2561dULL, 0x13adc0acc980353fULL},
+    {0xa0ecacf343cfb73bULL, 0x20bd922f6bef80a9ULL, 0xaa4ed0f78af415c8ULL, 0x23bf951bce16ac9cULL},
+    {0xb25874225e182416ULL, 0x320dc9d52d89a471ULL, 0xd6866ae553db2889ULL, 0x09565e285a7154ecULL},
+    {0x45a363fc1d9b0302ULL, 0xe093bc2752bb84f8ULL, 0x4d4dab8afdfb823aULL, 0x28575ad14e92183cULL},
+    {0x8d5c6b5530732078ULL, 0xdb5313c4197435cdULL, 0x128f057954039a04ULL, 0x2e301ef535328bc2ULL},
+    {0x3638c32ef00af98bULL, 0x42a135550f78f9faULL, 0xe689018e5676d29fULL, 0x2df2670b160f73e8ULL},
+    {0x5a367790b2b19d4cULL, 0xf589fd06afb76c6eULL, 0x07e7e9daa3c96215ULL, 0x0535a64f8011f60fULL},
+    {0x93f0e4dae891e73aULL, 0x6ba358309a980d24ULL, 0xed3f0d6ec1fedc33ULL, 0x17cd14a297e56a40ULL},
+    {0xe0e1087ebd634182ULL, 0x9707d4d847e347bfULL, 0x90428e13d8ec2e66ULL, 0x09100cd9f175ec53ULL},
+    {0x771df160a4b108aaULL, 0x59633c7f9b56da89ULL, 0x08a52a916048ee78ULL, 0x0cdf23e8145d4917ULL},
+    {0x866d91bb984d1679ULL, 0xe6165b93a3835c70ULL, 0x7a31b336ccabfde5ULL, 0x0071dfee400c0dd5ULL},
+    {0xc824eb6a6d8cf576ULL, 0x09c0986ec25123a4ULL, 0x025b605741550475ULL, 0x2b8eda690e256e22ULL},
+    {0x88464a79a91413d4ULL, 0x6207f8d6db1ea27fULL, 0xe10e1590065111d6ULL, 0x0e87b666bd030f3cULL},
+    {0xc1b59a53f04b602cULL, 0x33ebc929a49cc5abULL, 0x8354abd30a35ae39ULL, 0x126db4328f9e5231ULL},
+    {0x75bf55e5fa78a723ULL, 0x14c7e813fb5addddULL, 0x9972ad3bbd202622ULL, 0x2a6b70b8d4ec5738ULL},
+};
+
+const uint64_t poseidon_alt_bn128_partial_C_sbox[57][4] = {
+    {0x9afb27b5a5e5a371ULL, 0x2310230843a775c0ULL, 0x5ae9345367aee9e1ULL, 0x174d85de81b00505ULL},
+    {0x035190f2975dd046ULL, 0x4b63c925b18ff09fULL, 0x95e187a8afdd5ab7ULL, 0x2c1ad6ad67f170d6ULL},
+    {0x90da1660c9a5a50eULL, 0xce79822c94e32789ULL, 0x47500810726bbf85ULL, 0x1ae6110ffc58fddcULL},
+    {0xad7132d908bd0b79ULL, 0xf6e86549534e592cULL, 0xf3b98fd0366a6d3aULL, 0x1e1dbaf7d5628edfULL},
+    {0xab09f9a8d79d67f1ULL, 0x525375d0ffc3ff3cULL, 0x91b6b7ed4ed6d677ULL, 0x24f9339aed9952e6ULL},
+    {0x061f9b3c641e0fa2ULL, 0x1cc031b643ebc9c9ULL, 0x2cf3807b735f9b1cULL, 0x295d4d0aed791d52ULL},
+    {0x4eaabcd92c49f147ULL, 0x3d9e5d3a54c6ed5eULL, 0xce7ecf15873d5843ULL, 0x303826574a6ad48cULL},
+    {0x0c7f754694d6a69fULL, 0x44d30af7ec5f06baULL, 0xbd58112fdc62966fULL, 0x2c25ceeb7a07f44dULL},
+    {0x7daa1bda253dd083ULL, 0x980e2fd4c5d3d542ULL, 0xe2255d0c0d54f821ULL, 0x0eb5bd78247dbac7ULL},
+    {0x73cd05b201b8b1b2ULL, 0x1b51b24e587f538aULL, 0xc46c7570eebee33fULL, 0x27ea6626150c3104ULL},
+    {0x09c72cd33e5f9799ULL, 0x0f08e7de4fa4992cULL, 0x82d94d3b31350d3cULL, 0x1cdf877b6f5ee30cULL},
+    {0xc2f60b7b3194f10eULL, 0xdccbf3fda4af9529ULL, 0x04244089484f6b56ULL, 0x1f66a810822920d2ULL},
+    {0x1c92cd846e5666d9ULL, 0x6b6dae7d92efe97cULL, 0xa897782ae3a28248ULL, 0x0e9035a1396577e4ULL},
+    {0x68008c8c81c47701ULL, 0xc3f6fc7738eb4c94ULL, 0x542354fbc4af3874ULL, 0x22ec301dab72b71eULL},
+    {0x44ff0e4930bc56cdULL, 0xb6bfffad02f171f2ULL, 0xad964d8fb3fdff78ULL, 0x0994a387404d2f2aULL},
+    {0x70e0ed84135bc11aULL, 0x90ed3448855b9d3fULL, 0x030cb6280fda4b09ULL, 0x0add08ca3f108645ULL},
+    {0x3aba4897904b6e89ULL, 0x94c27d5851350531ULL, 0x07f6f75beb382d6cULL, 0x0ed21dd63a8c75fcULL},
+    {0x92c01e7b6f6e7f8cULL, 0x20fbe57ca1671766ULL, 0xafcc1bf99c54f9c9ULL, 0x01c3621eaa4528ebULL},
+    {0xe2544860ac9c3c8eULL, 0xff3f1ef367efc580ULL, 0x6933b1008bbe1151ULL, 0x29289120925eac04ULL},
+    {0x741bccf0aac24b5dULL, 0xfe090f5a35b93d57ULL, 0xe7e6fcd55382cf05ULL, 0x265af49bf1bfd198ULL},
+    {0x3d549af73fccad84ULL, 0x6a04e7bdca3393b6ULL, 0xef2ecd560119c15bULL, 0x1403c5f5a5fde317ULL},
+    {0x8c001c8ebb83a250ULL, 0x98b2a7e338f44d58ULL, 0xe0e3174b5cad90b4ULL, 0x2dae2790e20ff130ULL},
+    {0xdded0fa634ea2fb2ULL, 0x4d565aff8a9e9ef2ULL, 0x6ee20b340b8ae16bULL, 0x1b7e5647a96ff0a6ULL},
+    {0x74717d8ebf80a3c0ULL, 0x4c4b468345625fdfULL, 0x1ae9e5e20ae441f3ULL, 0x01c8586cb40c5cc4ULL},
+    {0xc883a2bcc06de26dULL, 0x13e77ce885d8fce2ULL, 0x89933c1ecf3ac722ULL, 0x2414b07bd4aa7fa1ULL},
+    {0x1cd49d88c4fdf2d8ULL, 0x78dd182230d7c142ULL, 0xda0196a91a6a2761ULL, 0x0b9b2805d554c5e0ULL},
+    {0x11aa3662cf004909ULL, 0x251b5e76a464a547ULL, 0x19781f8a3d47fbdbULL, 0x2f2a983365c23fe4ULL},
+    {0x6e15bcb1fa73ebd0ULL, 0x0d708c6be115511cULL, 0x488da13c8ffbbd1dULL, 0x18d9319dfd88cae1ULL},
+    {0xce1a471464dfc43eULL, 0x5191d6669c5ce546ULL, 0x810ea7080ad6580dULL, 0x0ced29cdb1d98b4bULL},
+    {0x2c12f2c293c70a81ULL, 0x4f9464f6789cec7fULL, 0xa2a0acc938a7fd7eULL, 0x15cac05563ce1d18ULL},
+    {0x6ca98e37492f557cULL, 0x6e2b553e27ac98c7ULL, 0xaf6cda567135e300ULL, 0x12c0852e0854debcULL},
+    {0xf6b74bf4be54e794ULL, 0x030aae66f30ea81cULL, 0x44077336c72b7433ULL, 0x2a6186f41afe5d37ULL},
+    {0xd78b746e9e2dd9a3ULL, 0xfe3a527329729f30ULL, 0xbdc425dddebcfca7ULL, 0x1d318c97382e6843ULL},
+    {0x597ec1f78e9305caULL, 0x852e711621458fb7ULL, 0x77eaae707cf9ee73ULL, 0x219b32b4edeeee77ULL},
+    {0x0a70ac5660c7e698ULL, 0x9ac026407ca61a16ULL, 0x763189f138a32465ULL, 0x1b3d5ad5ac80daf9ULL},
+    {0x360c8dce8ec2e269ULL, 0xf3a0a855584f6033ULL, 0x689c35a6811628dbULL, 0x2a9b1fc3e593cedeULL},
+    {0x90e3686defa3e4a3ULL, 0xf18b0a2d7573db2fULL, 0xc7d55fae4641412bULL, 0x23e599abf7263a03ULL},
+    {0x6cebdfb32ce5203fULL, 0x0ca01ae1c48fbd72ULL, 0x2982dda7dad90b1cULL, 0x1a99b36b70123e21ULL},
+    {0x216061f4d923cee5ULL, 0x49841946d71c47d5ULL, 0x1f6728027522a567ULL, 0x14e15433829e36bfULL},
+    {0xdd10a98cfd6e1bdcULL, 0xa1aa06a4d6599d5aULL, 0x184470ef08185375ULL, 0x2d8bec2b59fb14eeULL},
+    {0x999a72f61ef47775ULL, 0x1cb3f164eeec0a2bULL, 0x5fc86e497f55aba1ULL, 0x120b90ac85f6249dULL},
+    {0x6acd6ae69dedac62ULL, 0x661b4fe773ed78e9ULL, 0x064e76109b61e0c2ULL, 0x2d186c3b676b3a72ULL},
+    {0x7770c187037f46d0ULL, 0x9b1c42fca15d15a7ULL, 0xf241867a4c8db7efULL, 0x22525bee56b11209ULL},
+    {0xea5475493d965a62ULL, 0xde81b92e0d5bc869ULL, 0x01b64cc0ed278e2eULL, 0x16a893e2c88fd897ULL},
+    {0xedeb03a3381bfc34ULL, 0x6179825f997a9cccULL, 0x6c31b6a74f555a2fULL, 0x085fa77782ca6527ULL},
+    {0xa4c468604030d50fULL, 0xd1a924b83cddf62fULL, 0x9984a03bbc97df3eULL, 0x1fdc693e330eb09fULL},
+    {0x62f45f2278a22916ULL, 0x090fb239153a57b4ULL, 0x7b989b64c62b4fa3ULL, 0x161aad63b117a7f3ULL},
+    {0xbd7d9c94ab5b78d5ULL, 0x4b8ad6986c7d9ff6ULL, 0x725a9db36aec6c74ULL, 0x0eaaad5c4aebd307ULL},
+    {0x819d371af2bd7c10ULL, 0x36a725de53e28ad5ULL, 0x0db6cc986816b2e5ULL, 0x0f7e20206fafddfdULL},
+    {0xf936c66ebaab014cULL, 0x56ac8e8b1276375eULL, 0xc334eecc1065556cULL, 0x256a15a70f3e16cdULL},
+    {0x44e10f173354fe80ULL, 0x4a1d54d2f3fce367ULL, 0x047c1e94d1a465dbULL, 0x0667fd5d1f006c23ULL},
+    {0x8d7124cf1f4b33f5ULL, 0x7ce70cc8a7e4ee09ULL, 0xcf342159fac63bebULL, 0x1b4dd6d5c2ed77f9ULL},
+    {0xb083179666e7a619ULL, 0xaf127e536155c0d9ULL, 0x3990ef23af1c3b96ULL, 0x246b61bfff3db626ULL},
+    {0x5f08c6e41e1b80e2ULL, 0x8b10845fad59fac9ULL, 0x9d104ddf1600e0e1ULL, 0x2dc1e1301011e7c5ULL},
+    {0xe888124cbaee9fe2ULL, 0xe776bca0ae309b7aULL, 0x1b6f1a91d1d7ff56ULL, 0x22101a715c3b297cULL},
+    {0x4e54864a78ff3051ULL, 0x2b7e98c4f7a2df77ULL, 0x618206bbe5266f1fULL, 0x2831a62c435e58d7ULL},
+    {0x16f1e1d29a41d42dULL, 0xe64acaabd938feb9ULL, 0x3adcd8b71245b967ULL, 0x1d5315c46bebadf0ULL},
+};
+
+const uint64_t poseidon_alt_bn128_partial_M_00[57][4] = {
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+    {0x21d68f50cb74ac48ULL, 0x3e0b049316304f38ULL, 0x1dcda650dbc3e6deULL, 0x11f9d53cc0d1963eULL},
+};
+
+const uint64_t poseidon_alt_bn128_partial_M_row[285][4] = {
+    {0xf7229cf6c695a976ULL, 0xa91032899cc7cd0cULL, 0x254be23ef91592c4ULL, 0x1bc817f1e811e583ULL},
+    {0xdf638e83fb518f4cULL, 0xe3f7a1ed820fb7c0ULL, 0x48c83949083d7b98ULL, 0x206f917aea355fb0ULL},
+    {0x78cb2c895b36fb1dULL, 0x8a581c76b6f9fd26ULL, 0x5badc44355de9b83ULL, 0x013767e49d50e036ULL},
+    {0x6a3d6156d9ab573bULL, 0xe7c50e4dc21f4ee9ULL, 0x2eddd89f99b858f8ULL, 0x2f1f29c7a1ee0890ULL},
+    {0xcc3a1dd435b95618ULL, 0x8ffe7f39cb504c47ULL, 0x3123469cedbc6b3cULL, 0x2cb25e402951bcbfULL},
+    {0xbe9786b24fcdac11ULL, 0x7a33ecfe535c8d39ULL, 0xb67d0f1dff0eeb8bULL, 0x11a329340703c75bULL},
+    {0x083df24c2e3316ccULL, 0x6162dba145a4bf8eULL, 0x37a8bfd825d6a809ULL, 0x23f0ed563dadea6cULL},
+    {0x1879e2f597996d56ULL, 0x5f9c4cb8473629c6ULL, 0xd93943e14b66bdfeULL, 0x0e2e45168f8aac14ULL},
+    {0xd252418c18feeb4eULL, 0xcbc36b268b48ca60ULL, 0xd46540e8e6ff3dd9ULL, 0x10157bd8efc9ab1fULL},
+    {0xf0542cb622233f5eULL, 0x8c9eb4d766ba238fULL, 0x9a63fed6171aebc5ULL, 0x0a70b9a582115eb4ULL},
+    {0x02c335b51078a598ULL, 0xe7e562c1ac8bb554ULL, 0x59ef11da2a7b3b29ULL, 0x25160c0977a8756aULL},
+    {0x8fddc44489b63265ULL, 0x69fcb4c75ada8777ULL, 0x7e66f08cd9ea3da3ULL, 0x0b1cd03f12148008ULL},
+    {0x74dc7df36c21d744ULL, 0x7e7b244a461a8e1eULL, 0xb8f51a2e8de74690ULL, 0x26703b07ca933c6fULL},
+    {0x20827c6c4752c7f3ULL, 0xe27d6161c1cf31beULL, 0x849e8def2293f338ULL, 0x021e899e6850fec1ULL},
+    {0xb1a3e244ff710134ULL, 0x7ec022d103c30817ULL, 0x8ca0da4034805348ULL, 0x02e25ad0cfe04e6cULL},
+    {0xfbaddc29a0159d84ULL, 0x79368422340e7f3dULL, 0x58733e9e48e26f82ULL, 0x11d0e2760a9a075eULL},
+    {0x15d472ad503cdfddULL, 0xdb3e777f42ffc8f9ULL, 0x409df707c7a05f46ULL, 0x028639aded3238b9ULL},
+    {0x599114fe3690636aULL, 0x6483f476317257cdULL, 0x219d7af342051bd9ULL, 0x2c2f857abf225644ULL},
+    {0x776722cab360efecULL, 0xb107e459892a72afULL, 0x1ee88ce5690b0c39ULL, 0x110e221aa933d367ULL},
+    {0xfe98a3f7b4c06b6dULL, 0x69d20d6d9ab8c3c0ULL, 0x67aaf113206fc6b3ULL, 0x2ae3b2ad92b48a7aULL},
+    {0x7aa4093d725368d4ULL, 0xf3417c52eebe8a22ULL, 0x9ad846e3e213dba7ULL, 0x156da253e2b671d8ULL},
+    {0x1413c7ead811a6abULL, 0x7c507146754383c4ULL, 0x01bb2023c3ea55c5ULL, 0x2d8a8ca53a4aa6e3ULL},
+    {0xef48979d242fa9c0ULL, 0x56d2d4b3f8a12a87ULL, 0x028a08d1ce4117c9ULL, 0x0e4ef86e6d7e921eULL},
+    {0xbf617c506ac81ab8ULL, 0x3ccc9aec3076c1beULL, 0xaeb8b3265467cca1ULL, 0x24f294cda38e964cULL},
+    {0x68195addead4b8e2ULL, 0x4b45b758712e7bfcULL, 0xaf974e25a5f6f031ULL, 0x2f159e78f7647754ULL},
+    {0x78157a75f1633feeULL, 0x1de5038197d5cc41ULL, 0x5200dfd6646c6caaULL, 0x29c34affe3ec1ea7ULL},
+    {0x77d19398010c3329ULL, 0x92aaaeda1b8a4bceULL, 0x49a67f33653cec47ULL, 0x3011ba132e627d3dULL},
+    {0xc355974482dea9f5ULL, 0xce449723899096e9ULL, 0xc6b8b85dddda27f2ULL, 0x0da7dca6d97fe7e5ULL},
+    {0x364fd7bf6331ede2ULL, 0x8a5b3e013e117314ULL, 0x567d911d1563a589ULL, 0x0827c2550e6b9d1dULL},
+    {0x5937e64dedcae6daULL, 0x1f2b53a5272798efULL, 0xa0a09197d04a9dfeULL, 0x25ffeab632caf0e9ULL},
+    {0xfce68ea5879514e6ULL, 0x71221989a41de1bfULL, 0x4c2a64285efdfa1bULL, 0x0f3668c8bcfb8230ULL},
+    {0xd5147d8c39b36015ULL, 0xcaaa7bc3afeef48bULL, 0x667e11f303570cb5ULL, 0x1d51c6b15c20843bULL},
+    {0x4ce749595308e1cbULL, 0x8ff6d1545a719794ULL, 0xf01cd53bcf674d6fULL, 0x2b1fecf8760019b2ULL},
+    {0xd389fae25cb8ed44ULL, 0xcc899e2e2ba6d75dULL, 0x7cc5b19af6ce05feULL, 0x1b71843d641396d6ULL},
+    {0x6afce36d68686f08ULL, 0x2d8d636ca5d06077ULL, 0x34c0441c46a64f34ULL, 0x18608d75dcae53caULL},
+    {0x1f6b3df505472301ULL, 0x0916912425cb88a8ULL, 0x90dd5e54f8463682ULL, 0x22d732197dd32092ULL},
+    {0x5143603508a4ba07ULL, 0xda3952dae34637b8ULL, 0xb7959102093d9adeULL, 0x09640e3cb1c17e23ULL},
+    {0x619eb69923bb1d19ULL, 0x9f5eecb6dafbae0eULL, 0xf60db8c7822b5397ULL, 0x1728e241e1c3ddc9ULL},
+    {0x16e6a8c2f538e456ULL, 0x1fafb39f15e5dd29ULL, 0xe1fbf845a229d5a9ULL, 0x0dbd67344a49c6b8ULL},
+    {0xf2e936a497024f9cULL, 0x3239a71a8454a988ULL, 0x995e3f19df17489fULL, 0x293ace710aab5f8eULL},
+    {0x4424856119ed8f12ULL, 0x50c5bfd5f7eaf345ULL, 0xe9621fbdf2156b16ULL, 0x213205de0dcd7f5eULL},
+    {0xdc60758cac836d26ULL, 0x14172cf837b02f55ULL, 0x747019d014f36234ULL, 0x298a0f02b9250be4ULL},
+    {0xeea173ddba00bef4ULL, 0x202f6434003c6078ULL, 0x9e55bfa10d67fba9ULL, 0x19fd4b2a2e14881eULL},
+    {0x364e252b9d68d480ULL, 0xe0503b1043dc9c3dULL, 0xc5ce12725d1146bdULL, 0x057857d90018efccULL},
+    {0x6b22fa0c6b57f2f7ULL, 0x1074fd6179920435ULL, 0xd88369136d15a224ULL, 0x27c94156f5f6da77ULL},
+    {0x0cb2c404915dd732ULL, 0x01c12fac7da1f308ULL, 0x2b6e4bf90498106fULL, 0x19eeb4961ec3764bULL},
+    {0x408d905acd6932ecULL, 0x489c89d9629ff562ULL, 0x1c2ca346767121a9ULL, 0x0062a7b92784df65ULL},
+    {0xa5198df28f3954a5ULL, 0x7be820e68334d441ULL, 0x514426eca624bb6fULL, 0x0011eb3e03711551ULL},
+    {0xd77ae709f35810f9ULL, 0x398702f543ddef1cULL, 0x40eeab88603a5218ULL, 0x143144495a4cacbeULL},
+    {0xe353d16c8d69c93eULL, 0x93a20eb3baa07e32ULL, 0x13f51b6c81f1bff9ULL, 0x06ab14f14ca1fadaULL},
+    {0x39113d7977d39511ULL, 0x593e70a8e6b75a48ULL, 0x5f105da7cd2aff94ULL, 0x273f4914a7009f76ULL},
+    {0x9d61f2c9cbb6354dULL, 0xfe8327f2683b9bf2ULL, 0xaf44d0a63793f9a1ULL, 0x19f2afc477080723ULL},
+    {0x87f2b6215f863ec5ULL, 0x85ae172a8098c4e3ULL, 0xa6d4c90766d95adfULL, 0x0ee1b7e46c3f7cc0ULL},
+    {0xf583bcb5a796eb9cULL, 0x7d6ba5c2effa59d5ULL, 0xe0c5de718609b07bULL, 0x20989a8e99078adeULL},
+    {0xea21ea4525f88c12ULL, 0xa1874c5926af3d9cULL, 0x44f152d895dad9abULL, 0x23b0926e8f0fc9f4ULL},
+    {0x34c9346be73bcff5ULL, 0x223ae6b03b496e13ULL, 0xe8a280396849c666ULL, 0x1922ae1eeec51d2aULL},
+    {0x4f2e8ff922290ddfULL, 0x0e5629f2d06e8518ULL, 0xcbdeef94becb9c31ULL, 0x12aba97955c2b7edULL},
+    {0x544ac12e16377924ULL, 0x8d3ee02fec4dc57cULL, 0x3b69682abfee66d3ULL, 0x2ab69bbe0dc10a1cULL},
+    {0xe7a346919fcbf11cULL, 0x1c501b9a0ef89174ULL, 0x7429fbba9a2a1010ULL, 0x1ec002d608303cb5ULL},
+    {0xec74c85feafc3f2fULL, 0xf2a82207e773b603ULL, 0x153cf511b6f2ec49ULL, 0x0d28ce54dc6d5cceULL},
+    {0x1410ebe33a821be9ULL, 0xe92b3e6dc9286d11ULL, 0xee8387efc4b1f9eeULL, 0x0714e9a5d4f2bf0fULL},
+    {0x810a5a26551657cfULL, 0xb67206837c4c91d1ULL, 0xa807d80b9c5a4373ULL, 0x02d412929572e00cULL},
+    {0x605a798307406911ULL, 0x887e3cf278b98483ULL, 0x6d0859b4784ebc0eULL, 0x0c9e87ba15d29734ULL},
+    {0x93550d807c12d6c6ULL, 0xbe3f347f6601a300ULL, 0xfb0619af6a8b7ebaULL, 0x0472346fb1eb8dd4ULL},
+    {0x98ca86a8dda136deULL, 0x7d0b9dce3264e148ULL, 0x5d1060aaf5cd2f5dULL, 0x198bcf45ad99d25aULL},
+    {0x3eec7d7f69830592ULL, 0x7f93643bdafee94fULL, 0xad44b457ffca2364ULL, 0x04980da0860643d5ULL},
+    {0xf3aa3cbcd2d2c49fULL, 0x5a0f6edb2d950540ULL, 0xa66c48b24ebf07deULL, 0x28d2db1fcd948cdbULL},
+    {0xa3224f3e8bbe27c5ULL, 0xd767f6e24580757cULL, 0xec345a7b5c2f8967ULL, 0x220edf4ec79abc3cULL},
+    {0x0fec8aec37766568ULL, 0xc06d9c0a09bb4c93ULL, 0x4d25174cebcdb94dULL, 0x209fa5ac626e6fb2ULL},
+    {0x950a12019174e04dULL, 0xea1fb61f3eae9742ULL, 0x2c2810473c13a6d6ULL, 0x0b8619fdc8f6913dULL},
+    {0xff21a581142ec275ULL, 0x50f6abe8460a2261ULL, 0x386f33d1d35ad65eULL, 0x28d517548e19e508ULL},
+    {0x4514367aeef66daeULL, 0x7b87d890030dbc59ULL, 0xfc08b44a8c08f45bULL, 0x2545e4d88c222a70ULL},
+    {0x80ea7b130d562d62ULL, 0x4b98b6d5e654d682ULL, 0x4a00b95e603706d2ULL, 0x2f13d868de8561edULL},
+    {0xb572d06004594425ULL, 0xe75e8d38d16c12aaULL, 0x6d63e971395368bcULL, 0x278dd5924416a8d4ULL},
+    {0xfce0e0eb8d856822ULL, 0x90e237f2a21624c6ULL, 0x73ee4d643d9a3846ULL, 0x1a4e8ed761b8d361ULL},
+    {0xb027c46665d775c9ULL, 0x288229d394ec8112ULL, 0xf4cf74957dd5edbaULL, 0x2b35a50ba24438bfULL},
+    {0x38cdd3ac9040b2b1ULL, 0x5cdddac000062b47ULL, 0xb3dd6db56e41be9aULL, 0x23aaed4914608404ULL},
+    {0xe66f26a54b028951ULL, 0xcd0a3e744b6f3a62ULL, 0xaec6860e2f7e65abULL, 0x12d2b3f2cf7c01faULL},
+    {0x0cee7bde4ac09f4cULL, 0x4d80649559b6dc85ULL, 0xc4556759d10ac1f5ULL, 0x222905f805e7dfc6ULL},
+    {0x6e48c92058ea1045ULL, 0xce845c7a15882e04ULL, 0x774a4b3f51a4c0d6ULL, 0x036526fb85b7c27eULL},
+    {0x8fa81480a8e15aefULL, 0x737875526c93b4d5ULL, 0xaf580e0221b76428ULL, 0x04f9c09d34b9068dULL},
+    {0x4d74f88dd7fae3baULL, 0x712a656deffae8e1ULL, 0x604c88c2b6b4c604ULL, 0x1c4b485a800424adULL},
+    {0xea3d76322f8a8eb9ULL, 0x72f6742067d40792ULL, 0x1b615dec96c83c14ULL, 0x17fb547b7e5e7750ULL},
+    {0x7eac0ca4f56f39a6ULL, 0xfd4c530f253dd846ULL, 0x2f47c87f27506df4ULL, 0x105ac91f7680d591ULL},
+    {0x8e7f94e9c96f98d6ULL, 0x2e4bb3c89b2ee50bULL, 0x771a1fac1f806466ULL, 0x1b42be257b8af858ULL},
+    {0x7fbdc33d51eee41cULL, 0x7711ec33f6eb296aULL, 0xc53371b3558e57deULL, 0x268c5d2eba2b6bd4ULL},
+    {0xd315c9f46cc9cf4aULL, 0xe85363782572aee7ULL, 0x04aee5a19e3ef080ULL, 0x1ed1c916d4a57fefULL},
+    {0x7fb8c7c8ef6ebc49ULL, 0xe3588bfa068cfca3ULL, 0x0d9558435a560db9ULL, 0x1d27bf77555dff15ULL},
+    {0xb4be4f06c315a1f0ULL, 0x6241b02f82947cebULL, 0xacd7d829a1be95dcULL, 0x1bc7a70b6e7d4639ULL},
+    {0xc7db9fa94e16ec86ULL, 0x227631227795c95cULL, 0x36d885abeeb2a69bULL, 0x12d3bd8cc0c0b222ULL},
+    {0x82fdc41050ec33d5ULL, 0xa088cc9c22057978ULL, 0x1681aa4c0f4032e4ULL, 0x09ad6965335d1b26ULL},
+    {0xdbdfa9dbbd33359bULL, 0x8a647aea15cfb730ULL, 0x4880c81e796fe817ULL, 0x25ced4148bb7e37cULL},
+    {0xe4dc8b49b207274fULL, 0xcbde8b25e692e10aULL, 0x2a0fcde0b390afc7ULL, 0x0ee40aaae024e035ULL},
+    {0x2f3662d4b54eea96ULL, 0x757e642c70abef15ULL, 0x198014de2771a07dULL, 0x0d3c88e3d556d829ULL},
+    {0xb1af18c8a0d27747ULL, 0xb28978e197252fe9ULL, 0xac1afa4f92d8b2d2ULL, 0x2101b570c8318f36ULL},
+    {0xa86101a0b0cdc987ULL, 0x48ffd2a266d57647ULL, 0x2b5dde563827ea66ULL, 0x14a94ddee4a2ee1eULL},
+    {0x0c41a835e3cb7707ULL, 0xd2b75e1ab4dbfaccULL, 0x69619a1c4c519fa2ULL, 0x1df69defb1a49760ULL},
+    {0x04d1d8789a4cf269ULL, 0xdc22ddfecae508b7ULL, 0xb2ac73d7c08f2048ULL, 0x2ff9a4ed58ce0e4dULL},
+    {0x6d6f31c631ff8b4fULL, 0x7017936728857957ULL, 0x55b02dea84bf1dd6ULL, 0x1704a7dabe0f5871ULL},
+    {0x277192b6a53c71dbULL, 0x284ff6307c335e04ULL, 0x0f5cd8abb628bd9bULL, 0x2023b0e3d035f287ULL},
+    {0x663ccebb3f29f88cULL, 0x1a52bf52de7e59dcULL, 0xc03911f2fac109e9ULL, 0x013de715010be125ULL},
+    {0x164c8ae76d19c9f6ULL, 0xb8414fd53e9e6d7aULL, 0x8cce1405bec442c4ULL, 0x20821095a81a6a4aULL},
+    {0xf98cf8989c228d4dULL, 0xf5f6369acf599642ULL, 0xdd4882d08a63e70fULL, 0x2ca37df18b7a7d3aULL},
+    {0xde7d871039c9e843ULL, 0xec308105b963e5d5ULL, 0x25056100770bea0bULL, 0x18f7e1c025904c11ULL},
+    {0x7e26b711db402604ULL, 0xb831a61193dd9851ULL, 0x5c288e5544bcb52fULL, 0x04ac7e9413e7eb46ULL},
+    {0xa6faab2e3dd72f3fULL, 0x5ec6277affa23e7dULL, 0x19b68dab9a1ea41fULL, 0x17fa76659d85486dULL},
+    {0xbf1176a6c916650bULL, 0xb3102f5d3196fe3aULL, 0x4a8c58d37c174277ULL, 0x089628c4bb370e15ULL},
+    {0x91c116e6683d792bULL, 0xf009114833518a5bULL, 0xb1fd883e481b63b4ULL, 0x0382134ed01d1ba0ULL},
+    {0x25b5264f5e20a58fULL, 0x3a0725a9ee21b048ULL, 0x9481e334fd9c4b4dULL, 0x2c525cc3d57f99a5ULL},
+    {0xe071fdcaf9a99bd2ULL, 0xc6da52c06355d52aULL, 0x77a505aff5752663ULL, 0x0b43735c8b4d5cf7ULL},
+    {0x3b9fb4344288ea0bULL, 0x3543b59309d09f79ULL, 0x0636e8ad499eba47ULL, 0x1581cdf3c7b74ac0ULL},
+    {0xbecc0b182a5560cdULL, 0x3fce37fe6292e78cULL, 0x420fb23c3b806c98ULL, 0x20d8138f77fbf36bULL},
+    {0x4af01caddcc21bdaULL, 0xd6331f394cb9e83dULL, 0x07d8e3349bfed606ULL, 0x14a3738a8249ebc9ULL},
+    {0x0b9c779e60ff60f0ULL, 0xcb428bfba2983353ULL, 0x1ddd5b6d5d6e5ddfULL, 0x09eb951f7ece4250ULL},
+    {0xba7ef8602fd86955ULL, 0xf4d7e94d4725707cULL, 0x180b0c19511b1057ULL, 0x1fdff6bad4cd82d4ULL},
+    {0x20289f5f447a9ce1ULL, 0x7e8eb1e219c9669bULL, 0x432be902df87ad6bULL, 0x206eabaa16cccac0ULL},
+    {0x058706d5dd1d8b19ULL, 0x47a23da2cfb97c85ULL, 0x3862396ececbbf14ULL, 0x0cc04051f36f9dd3ULL},
+    {0x718517e3d1790cc0ULL, 0x65385afdd469fefdULL, 0xb2abd7e2731df237ULL, 0x1d9ccf28cd8fc0acULL},
+    {0x978afbe1994fa632ULL, 0x2336d3bde84b66a7ULL, 0x88007ecabb9de637ULL, 0x13edd0e539399fbbULL},
+    {0x883e75272e4e5585ULL, 0xabdec9831312ab03ULL, 0xb63e5678257cff97ULL, 0x0ef13d7bcf0f7d8eULL},
+    {0xa30c3da5f05a6385ULL, 0x46501431cea4483eULL, 0x3edd46f3ecb97a9dULL, 0x19bb81b8f6d91558ULL},
+    {0x0eca2b0fd6c802eeULL, 0x5af7a0ff5c61cec6ULL, 0xbef0e51dff00203aULL, 0x1f3efb076cc8ff20ULL},
+    {0x59a1a3f4b9732b76ULL, 0xd40cdc95de695030ULL, 0x37e96a837a7ffd0cULL, 0x0f29b8bf96671349ULL},
+    {0xd754748d93d68202ULL, 0x2e147fba4375e951ULL, 0x313a802c38a1bd94ULL, 0x219043d39e9bd887ULL},
+    {0x90f2b2a56e974d65ULL, 0x9de9619419da8b65ULL, 0x8da76488ad3d24b1ULL, 0x0a730aee5d5f6f46ULL},
+    {0x469493e0d61d7b32ULL, 0xe7128d6f323b99a2ULL, 0x0da450af1b6ffbfeULL, 0x2d838c621a4dc13fULL},
+    {0xd3a37a0d43505892ULL, 0xc1b3349f355304eaULL, 0x02b3f3b22a15040aULL, 0x084efbf8c7634251ULL},
+    {0x06232991fc278febULL, 0xc5c0fecfe87f7685ULL, 0x08a8a3ff8af7074bULL, 0x1082249ef675ef49ULL},
+    {0xafa7273bbdd0df9dULL, 0x59ec6fa843c91ff7ULL, 0x54e5dcf7c051e5adULL, 0x0d2fb9b231b5f1ffULL},
+    {0xc734d706b141737eULL, 0x17e6389eac558a10ULL, 0x21fcfaf899bd3e15ULL, 0x2f5c4c31fab5b3fbULL},
+    {0x6243f9359957d136ULL, 0xa6428e13c23354d2ULL, 0x3ca6dfe89b6f243eULL, 0x23254902fc8f942eULL},
+    {0xdb1080217bf1376cULL, 0x326fafdddcbd052bULL, 0x4162111a11c3aba3ULL, 0x21416d392505e337ULL},
+    {0xc69ce4a1ab1cf526ULL, 0x6f2f125fced7fe9cULL, 0x7cde381c0e5f08b7ULL, 0x091474cd79307e2cULL},
+    {0xf9f319fa74c7bedaULL, 0xa38209b0329592cfULL, 0xf937b4ccf3c76fcbULL, 0x152227ac88c3c02cULL},
+    {0xa69147bb5a094e65ULL, 0x5aaac770d4e9128aULL, 0x46819a5d53bd65b9ULL, 0x2cd3a70626464fb7ULL},
+    {0xfbeb9deebff9de7dULL, 0x48fcc4ce83c345b2ULL, 0xfa8ed9933e2cd247ULL, 0x2d9b11b3241a034dULL},
+    {0x6c618047c495ec41ULL, 0xe3451b5e9d5bfc28ULL, 0x943daad81e0cf5b4ULL, 0x03278e531582307dULL},
+    {0x48c3d95fa5900ebeULL, 0x3c5a8e896fc5a312ULL, 0x3ca49bcfae210706ULL, 0x2afcb568b1c73687ULL},
+    {0x4882737e80a5b9f3ULL, 0x9eaa61eb99222226ULL, 0xa879f8787bbaa585ULL, 0x25d1739086f63effULL},
+    {0x865adf423abccb40ULL, 0xf2bbd69e5d33bbbcULL, 0x6b9858d762f0cdedULL, 0x239f33b209a9659fULL},
+    {0xfc4e583eca0658e5ULL, 0x5590977f95730fa1ULL, 0x79a2fd4f78efbf69ULL, 0x2b1a1c0368fec68cULL},
+    {0xd9d0515dad3a7b46ULL, 0x500abfa25f75e3e8ULL, 0x6ead74a994dc2879ULL, 0x2289c5fe2192405cULL},
+    {0x3f72e2f7a3f7e426ULL, 0x14a2b1c74a646b0dULL, 0xbf2894683e6630caULL, 0x03254390d3674895ULL},
+    {0x0423fe17ba64de83ULL, 0x61b747421f043e57ULL, 0x86d900fc5a0db75aULL, 0x2ae367cbd355f16cULL},
+    {0x2641e2ca68eea1b3ULL, 0x7aaf9a4328e5352fULL, 0x059b24c8b101c314ULL, 0x0a3edf3ef5cb27baULL},
+    {0x53ce2a0834a32d8fULL, 0x4a14470e474f69f8ULL, 0x13b5730a930224feULL, 0x09da708ab143fd6bULL},
+    {0x832554a8d7873101ULL, 0x7306b1ea7dce9568ULL, 0xfe692c0a05fb9efcULL, 0x227146674c8b729cULL},
+    {0x91adc923b5a0fb5eULL, 0x84fc3b44e79da54aULL, 0xc2c8fd72916c0987ULL, 0x1f39820a024972b2ULL},
+    {0xb15af7e833adc037ULL, 0x78ec28d65814d702ULL, 0xdf1b0beb9604ca18ULL, 0x2e501ebd32993400ULL},
+    {0xb5575bc3263986d2ULL, 0xc8f59ae91b6f27b0ULL, 0xc2a1e999d84a33ccULL, 0x1535708a250f433fULL},
+    {0xf4021855ea590689ULL, 0x6482fb37d419abbfULL, 0xe24ff616151735f0ULL, 0x21ed51f673c5ed1bULL},
+    {0xce2abda38c3f779eULL, 0x10a60f0abe7afba1ULL, 0xc7c2a3cc1f7cb2d6ULL, 0x06363f1019533d84ULL},
+    {0x86f742f5b36a75d4ULL, 0xce5740a0b989e2c4ULL, 0xd590837fccf4dd01ULL, 0x152ed0da88305d83ULL},
+    {0x3bf75abfa676ff44ULL, 0x1b88bd2c2e3af469ULL, 0xafdbe8c9b2e3295aULL, 0x183acd0aa4e2a181ULL},
+    {0xecc5cd9c8a4657b4ULL, 0x1506cdb66f700de6ULL, 0x686455fc46eba733ULL, 0x05793ce1e599aad2ULL},
+    {0x9f6b2195c25f26b3ULL, 0xce9d3c352b173961ULL, 0x941bf1598920c0efULL, 0x042e8663e519ab0cULL},
+    {0x7944652f490afcccULL, 0xb2d6da59897cde71ULL, 0x262a1a07a2d570b3ULL, 0x1b43f5e5b3a74399ULL},
+    {0x0ffeee01d8c7d849ULL, 0x3eb285c01580b80cULL, 0x2948fb14074fee15ULL, 0x150a15b608aa9704ULL},
+    {0x1edab4fd9c77fd26ULL, 0xb16e92625b8834b6ULL, 0xf1dc497f11fd8a1fULL, 0x12f3bd29981e8cf8ULL},
+    {0xbbc9bb66c494f7f7ULL, 0xf6ce0ed7499e7abcULL, 0xb9866a724e219577ULL, 0x1a673db897a5b206ULL},
+    {0x8e1fd112a3a2e33cULL, 0xe5b5729e07f25425ULL, 0xe104e41c52b6a43dULL, 0x065f81b550f92470ULL},
+    {0x41602f6a58642140ULL, 0x1a95d7db174930c3ULL, 0x6d073a3bc6908c2eULL, 0x0763788a501b1cb3ULL},
+    {0x3a6dc1786d5fa6e2ULL, 0x9e3c3481c0d801b9ULL, 0x80cbe455181e24e3ULL, 0x155ab60b54fe0032ULL},
+    {0xcf5c16009227c141ULL, 0xd881c71f517aca35ULL, 0x9eef656b565028abULL, 0x2f6c1d40db8fe7f7ULL},
+    {0x782fbafd4857eba7ULL, 0x63e30d6c8b4429beULL, 0x9ed88b6542ff7d57ULL, 0x2fb95295c086900aULL},
+    {0x72245c1b4fc2b62fULL, 0x6c32b3c414b454a0ULL, 0x5aa9c020d91a30beULL, 0x12125996ec1472c4ULL},
+    {0xaa5d49410411a52cULL, 0x868fc34afc44f632ULL, 0x9126354072ecf52fULL, 0x105b84a8edfaab2eULL},
+    {0xebae1cdf7995e09eULL, 0x1c943355387f5b63ULL, 0x51df4ecc794b82a5ULL, 0x23fbbc0dcdafdb52ULL},
+    {0x5eb6db9e52f9bfc4ULL, 0x62852d3d6621cbf2ULL, 0x4d7534b9af658b71ULL, 0x0d70f67f20492482ULL},
+    {0x3cd018323c593a43ULL, 0x1cda3675927f5056ULL, 0x3771f327a74ed226ULL, 0x0e9fab37021487cbULL},
+    {0x8fd22c65a7800e1cULL, 0x36f9ed317c1adf64ULL, 0x1da6b2e931f52ef4ULL, 0x23cad764fe2e9d45ULL},
+    {0x417a327c2e5d8ab5ULL, 0xbd56db20fbacb847ULL, 0x9f2db4554d1edb94ULL, 0x06e2fc5f9c6c4ddcULL},
+    {0x6bf1fbafed3206afULL, 0xbc6f16e5e94f7810ULL, 0xfed45702e4b4fa91ULL, 0x02dab03e433c71f9ULL},
+    {0xeba3931adfe02734ULL, 0x4661a6bb825d5039ULL, 0xf653ed8c8f41b9f8ULL, 0x1d1ecd33c6eb505fULL},
+    {0x46c5532c868914ffULL, 0xd9ed39b68856ee30ULL, 0x65256da1aeee2c66ULL, 0x019fc8e39b22152fULL},
+    {0x3ae781bd75409497ULL, 0x084e40686e4556e7ULL, 0x1b3bc7a512f74e3cULL, 0x10e01f519d685f9dULL},
+    {0xa3349b87f86bda25ULL, 0xfabdb8e751c10b6cULL, 0x8d0b6856fb7daa93ULL, 0x163e10bd7937ef61ULL},
+    {0x42e31334ad4f22d3ULL, 0x16ea97ef462cb7cdULL, 0x973e49d76203bc49ULL, 0x2802bc22ef88aee5ULL},
+    {0x5130353494724487ULL, 0x24728937115cf496ULL, 0xc3f55c0c79244088ULL, 0x2a5a0d76c4ecb290ULL},
+    {0x6e6c75decde39349ULL, 0x0697f02d8fb96fc0ULL, 0xf5d13cb92e9467a0ULL, 0x2e1d72a5e9baf3b6ULL},
+    {0xade40f1b5d99be99ULL, 0x5ec086512a36517cULL, 0x0b5bf7ed8ace3553ULL, 0x11ef69d33d1b8f6dULL},
+    {0x9c98a8246bae1956ULL, 0x70314cac4745b7ceULL, 0x33de6dcdf3c25bacULL, 0x0e31248b3f065eadULL},
+    {0x8408ace0bbc160d7ULL, 0x4b833f2f297d3145ULL, 0xbd1c5d8808c26211ULL, 0x069b377a6f6a2f55ULL},
+    {0x959995104f438c09ULL, 0x4484517a42517810ULL, 0xa4921073d0b3dee8ULL, 0x11d3bd6020f48daeULL},
+    {0x3ec1e20df3cf9a11ULL, 0xf39c63d4793ca94fULL, 0xaff047ac9e9a3854ULL, 0x2ceca74d273a69fbULL},
+    {0xb695f4b2861673caULL, 0x6b5d40829037a1edULL, 0x49e8be192322df41ULL, 0x03f45b273737228aULL},
+    {0x46f3a835212a3507ULL, 0xbd30e96692cdafa3ULL, 0x25908a7ea7090a79ULL, 0x2dad36cd35cc7d5dULL},
+    {0xdf7ead08af11e8edULL, 0x553b6ab074823a6cULL, 0x9ca2c4799ead2b70ULL, 0x0a172216c144a88aULL},
+    {0xb90ebb894aa5d716ULL, 0xb5cd2abe427501f5ULL, 0x7e4af58351bf6919ULL, 0x156e6bf4bafc3b57ULL},
+    {0x4099008761b75290ULL, 0x9b98042d15bf6bd8ULL, 0x85175e02f628910dULL, 0x25a746f8296b7ad0ULL},
+    {0x720920af620f6737ULL, 0xfa929e34cecea803ULL, 0xac59be02e43b2a8bULL, 0x1033945046beb4a2ULL},
+    {0x7a2e12c237ea9051ULL, 0x913e9fee208bc5feULL, 0x1cd931ca38417a48ULL, 0x24a90e68e02525e2ULL},
+    {0x6a709e237a1354ffULL, 0x934674f49eb0a110ULL, 0x46c44f9b9ae76ffaULL, 0x07d5bd6af9a4a640ULL},
+    {0x81dda96e9e3c0d83ULL, 0x78036f128a9a60f9ULL, 0xa8dfc4473b838b7bULL, 0x0889ce6573d7c739ULL},
+    {0xe15cd72541e73632ULL, 0x99a3073d8105ac61ULL, 0x026a1c1870524eb0ULL, 0x05e126d00db98109ULL},
+    {0x7001be9a35660588ULL, 0xb7165a796e3cbfe9ULL, 0x2f13504617391dffULL, 0x157a2da12fbc6da6ULL},
+    {0x19ec10adc122d41cULL, 0x08be6e57142e5fe3ULL, 0xdddb834eec2933b8ULL, 0x0a9c17bfb0e8b9f1ULL},
+    {0x6e55e0075b3e8083ULL, 0x409db328dc48adceULL, 0xd447ab66cd9fdf09ULL, 0x11baa808cc160779ULL},
+    {0x9d4cc09820c0c83fULL, 0x9e546a241b0b92f4ULL, 0x170067d704faa861ULL, 0x088102e7819339d7ULL},
+    {0x629ce59dc0f05568ULL, 0x16e38e048d6da984ULL, 0x5cff1cef280abe46ULL, 0x01258dc44122b8a6ULL},
+    {0x489d1b25ca9595a1ULL, 0x36c0f492cdfb3a90ULL, 0x9023aa837e37483bULL, 0x24156bcbd09bb289ULL},
+    {0xdb7e157964c393f2ULL, 0x027f0e1d73314a9aULL, 0x29cebae1f9ccf4b7ULL, 0x1b06ee9acaba8dbfULL},
+    {0x7eb643483528a855ULL, 0x27a39f7a4776d97eULL, 0xbb644151a9b910c4ULL, 0x2e25626c7ac88295ULL},
+    {0x6d59af4144d2c9d9ULL, 0xa9945bcbf43353e2ULL, 0x76d715ef405603b4ULL, 0x299210fa5ac92fedULL},
+    {0x93ca6d580b181f5bULL, 0xa1050e9bdbe58562ULL, 0x2c2d028a85bb16b0ULL, 0x24e31a0ac76f0e24ULL},
+    {0x4eb997b41dc455a7ULL, 0x352e279235ee3540ULL, 0x26d81c1d614c4dd0ULL, 0x1ac56e4740fa2f8bULL},
+    {0x39eae15557ac2797ULL, 0x0f1c086ff5947dc1ULL, 0x094f4e061da1507bULL, 0x234f4764bd7ba40aULL},
+    {0x52effa287abd46e8ULL, 0x9f1fb3fc2d556ddcULL, 0x7d2222a54612f1e8ULL, 0x11fd5338c0aa211cULL},
+    {0xe958c67569a07201ULL, 0xe0fb9eaf0a364707ULL, 0xd3a396c140bb9412ULL, 0x03e1b9f22e69a903ULL},
+    {0xa5161adf944b9a23ULL, 0x886a02011d83e534ULL, 0x331cbc2c0949a8b0ULL, 0x2acb3c3a6b0a6307ULL},
+    {0x1db81cbcbaab5f6aULL, 0x7fed12043283e7e9ULL, 0x314b4a1383cb4522ULL, 0x09dd33154f1f7cd6ULL},
+    {0xa2baa2167f61a564ULL, 0xae00f9a53b84f456ULL, 0xb4a5f90bf2a0f7c0ULL, 0x2b8dfa6fab751253ULL},
+    {0x2ed92864b30e432aULL, 0xcba89c82c9ce7313ULL, 0x415fa26f39f264f8ULL, 0x03d553e771c09212ULL},
+    {0xf1caea749ccdfc03ULL, 0xcf400d9a2de3749cULL, 0x2b220787c2dae02bULL, 0x05dac001589b1c6aULL},
+    {0x0cbe154ee0daa351ULL, 0x801f1dfb86829ef7ULL, 0xe0aa3d8400248f96ULL, 0x2d5926ffd35bd093ULL},
+    {0x8f8932c6b6534052ULL, 0x43484236e0b14e8dULL, 0x3c37ab423a6c0c32ULL, 0x0ee39d47e6ede136ULL},
+    {0x55282c4f8928c83cULL, 0x715183ff3eef5383ULL, 0xf34f8ccc72b51e69ULL, 0x11903060ac4d0ffcULL},
+    {0xacb0bc73bb30c133ULL, 0xb8c26b5b491a4e79ULL, 0x930a7719d011a15cULL, 0x0b72388b3c1d3865ULL},
+    {0xf1fec9615c34b62eULL, 0x0f3d2ed85e9d0119ULL, 0xac2c6c0ad0697124ULL, 0x1b63e75775d69c2eULL},
+    {0xc58d878e7efcf242ULL, 0x23bb0e2cc35a2483ULL, 0xb89c6336f10d6ad6ULL, 0x1d6817b858a01eeeULL},
+    {0xfa83a21c512f63aeULL, 0x985e0d6580b73c38ULL, 0xa34faac9f20c6cf9ULL, 0x0aeffdc906950c88ULL},
+    {0x79a11b90f708e147ULL, 0x5fd0148d2560c77eULL, 0xed0c5c1820e6b17cULL, 0x2de249f72a2b3b62ULL},
+    {0x4a52bd12b5eb36e4ULL, 0x9f5aa145a6410c5cULL, 0x8defccc4ef1eb1d7ULL, 0x152be5755f6802d8ULL},
+    {0x44c545613d2f5431ULL, 0xe735775fcc11725bULL, 0x890b58d541288d5fULL, 0x27e2ea9db6b6abfaULL},
+    {0x82a2593a60abdc2cULL, 0xe3b09ef4b092bc6bULL, 0xe7998bf35f6fb983ULL, 0x2cb7c06a936ec03eULL},
+    {0xdc98ed816c8d8488ULL, 0xe7e96898a7db9dbeULL, 0x2b352139e5d378dfULL, 0x12b1e5178a0367c4ULL},
+    {0xf33dba7ee5a566b9ULL, 0xe3a96e2bc13381ffULL, 0x90090f180f960cddULL, 0x05ca6765676f2152ULL},
+    {0xe21d41a3d4530965ULL, 0xfc5cf0583be78c03ULL, 0x0a7754ab2a9b68c1ULL, 0x0780300135ce6676ULL},
+    {0x152d0f1f131fbe53ULL, 0x5bb58d4b7008c8d8ULL, 0xf65d40b45431bd2dULL, 0x1a9dfa112e3cb574ULL},
+    {0xe49c9f6bd3a5e30aULL, 0xc884c143f50d83e1ULL, 0x1a13b63a6ee8ce10ULL, 0x1f661dbfff488b28ULL},
+    {0x284277923e78ef0cULL, 0xc1697d6dbc12bf0eULL, 0x33173b6b6600b421ULL, 0x17edfb6fba5bc230ULL},
+    {0xc8ce999d40292ac0ULL, 0x7e58500250ec1553ULL, 0xa048ca98a658145fULL, 0x2dbfddc355b5bb32ULL},
+    {0x5a17040fa32bc513ULL, 0x55c24ae5ccd206b5ULL, 0xd32bf07d2e7a0f1dULL, 0x10c9206895924878ULL},
+    {0xb6f0f5962694f610ULL, 0xb39022ae718a7e11ULL, 0xc3188fd7eb80aeb8ULL, 0x0952742a6af0bad6ULL},
+    {0x28a554a5a1199452ULL, 0xd3b6041c9d3bb311ULL, 0x9fd3a8cfafc91353ULL, 0x077393885c649cd2ULL},
+    {0x1895ea9302c664c5ULL, 0xf012f74a8210633aULL, 0x066c81dad5698ab0ULL, 0x242ea4508231ac9cULL},
+    {0xd5570fb5a690b581ULL, 0x9b61b80326d72e47ULL, 0x78f807aa5b0ce10aULL, 0x0181595742660e05ULL},
+    {0xe3e7fc4527287035ULL, 0x171d001fd3df6b20ULL, 0x6e0a4a655c491553ULL, 0x0ff9ed13c90e8f73ULL},
+    {0x8cd5b7078c4fcbdbULL, 0x470db2d54f920273ULL, 0xd4e6dfda1472157bULL, 0x29b77004b1f77882ULL},
+    {0x77e948d7c5a07cb5ULL, 0x1bb1f5d392c7f403ULL, 0xba77d75d71a78e8eULL, 0x138249e617d49f11ULL},
+    {0xe9fd03a43044a69dULL, 0x6752346feaec5ef8ULL, 0xa134646cf13886edULL, 0x23e3c6da0ba88664ULL},
+    {0x270220b7e275682fULL, 0xa75ef1e5a335814dULL, 0x9cc952f58f1a00baULL, 0x0aa2c02b5dcbb45cULL},
+    {0xce980790e60f3133ULL, 0x1ece1c8b5c2702c2ULL, 0x125071f87e46fe57ULL, 0x1223a99648fa3ad6ULL},
+    {0x826dd4f243d74a53ULL, 0x8063a16c5096b5f8ULL, 0xb63bb45e0101d535ULL, 0x1f7f4f3eab50ae52ULL},
+    {0x52b87839630a6dc8ULL, 0x5da7de6628b2c8f0ULL, 0xf888fbcac516ee94ULL, 0x25f1864f4a79e969ULL},
+    {0xa55bedc29f677452ULL, 0xd5644a43700f897cULL, 0x0edb768d51b839f4ULL, 0x30629d0c2dd86d0bULL},
+    {0xea8ed0fcd22b0be5ULL, 0x78433a3e97245fbfULL, 0x28b39bf7f1f64f22ULL, 0x1828b780d69fe11eULL},
+    {0x213cd75c7e51f7a0ULL, 0x94d6195fc49c59fbULL, 0xd19bf9c7bed76327ULL, 0x2ce8e9b098d67fd1ULL},
+    {0x73b64b355112a55bULL, 0x4dd727b413efb0f3ULL, 0x56156e8b24bfd780ULL, 0x1270aa6cb599d662ULL},
+    {0x3a2f2f1749ae8f8dULL, 0xd129bf8f10e20c72ULL, 0xafdc580812ffaa4fULL, 0x0deb03f3a0328a42ULL},
+    {0x0f8b323e228400e7ULL, 0x4ddfcf1f0266a766ULL, 0x36309d6841f42084ULL, 0x2bdbcd89d83fdca7ULL},
+    {0x7d619c2d2b686330ULL, 0x68cfedc0e7cbaaa5ULL, 0x2612a9afe3ca6aeeULL, 0x255a7ea26d54f336ULL},
+    {0x9251ea9a122221c5ULL, 0xd6a1b5a67b7fbe97ULL, 0x3b43f444c6d82017ULL, 0x0b787fd720d7d950ULL},
+    {0x2a2b3de5304fa07eULL, 0x3f7207b6d4feea55ULL, 0x5d4e551e3f4c723cULL, 0x17ce01225f666f82ULL},
+    {0x43eda581bd5706dbULL, 0x7e74aae1cd34df1fULL, 0x0db82c8abefaa50eULL, 0x0ae728d81e61747bULL},
+    {0x21411d0191b65b9dULL, 0xaadc0a1138c097dcULL, 0x94e03bbb99ec4f9bULL, 0x24d2f7489657da48ULL},
+    {0x23aa376269ec6b1bULL, 0x0300e6387c2c7f90ULL, 0x923ce3e239c7e12bULL, 0x2dcaf3ab91004a5cULL},
+    {0x0bec0db850064d9fULL, 0x12decf9f5198f1aaULL, 0x9ae6f059e983cf89ULL, 0x052e23da14e2fe66ULL},
+    {0x3971bf0237b72cfdULL, 0x3257009464cf0335ULL, 0x1d296e0738d169baULL, 0x29832bf733f0d73fULL},
+    {0xe256444521d678d7ULL, 0x722923b28eca1f3eULL, 0x0cde5f36f1390c48ULL, 0x07063e7ec2fbcef4ULL},
+    {0xeb1a554a6065ee83ULL, 0x8b9ed4868afd0259ULL, 0xad872d97de402ac7ULL, 0x0206b74ee959ecc4ULL},
+    {0xa32a34b08a0b53b3ULL, 0x8537ee0d81d165d0ULL, 0x954deff7a4dd8b6dULL, 0x2744e7feeab37a63ULL},
+    {0x0728e39e7f46ff86ULL, 0x9b04f9430b0cde71ULL, 0x6466d384800cc31aULL, 0x2244258265e86d00ULL},
+    {0x69ed06fcba027dc4ULL, 0x15b144688a6ee729ULL, 0x31f1035decce8ca6ULL, 0x1f01e1914c141061ULL},
+    {0xd4c944a625c23751ULL, 0x5d1982843ad97287ULL, 0x1752fad9a528fa91ULL, 0x2a25dbf6fd785b01ULL},
+    {0xd5698d571a819ef4ULL, 0x76bd2fa71855db02ULL, 0xb2202a28dab1702aULL, 0x170cea0ab8b69d74ULL},
+    {0xb844c973a21f376dULL, 0x20e14dc18092dc06ULL, 0xf13e265226459bd5ULL, 0x248e477f15bae78aULL},
+    {0xc0768ff2945ebd0bULL, 0x10cfd520459e5f89ULL, 0x2b0bb567c43e79b2ULL, 0x1841b5f49021a89cULL},
+    {0x40ca9d29033ba026ULL, 0xdcc4bf5158c47f24ULL, 0x139d9eb65ff860bbULL, 0x1ce95478d7dad294ULL},
+    {0xdffd96d9e700469cULL, 0x2bf4528c0d08ab61ULL, 0x2a6048e84ebeb7a1ULL, 0x11db3bbf7c5a141fULL},
+    {0x0638f126fc251bd8ULL, 0x5ccd6b366a63af40ULL, 0xfd4a4b80d2db9532ULL, 0x277ddf9e5a7f8cacULL},
+    {0xbc22941a82a33615ULL, 0xe9ccd877171eb9e9ULL, 0xecc04776dc5d5134ULL, 0x07a6542c5b2f9eefULL},
+    {0x55e4edeae5c789cfULL, 0x1aeba73fbc00f509ULL, 0x97ac91972a8bfc49ULL, 0x049c5e1d77fa87d2ULL},
+    {0x26e0852f152254a9ULL, 0x59c795fb57871a6eULL, 0xb853fed1756e3668ULL, 0x101b969707be0230ULL},
+    {0xe22baa39758a2802ULL, 0xe245f3be2f8c42d3ULL, 0x52adde6ed6d05bcaULL, 0x2c139cad8854a89aULL},
+    {0xa35d6f1333377d79ULL, 0x8a74026cd39b7a6bULL, 0x74a520c73143c19cULL, 0x17164f9d1a7439c2ULL},
+    {0x409e0232a9675a09ULL, 0xe685548c1743fbf8ULL, 0xaa0e5feebba050b0ULL, 0x1bb92e36fd40c8e1ULL},
+    {0x6e0a2f03868fed86ULL, 0x3cce4124eaa3ab14ULL, 0xc4a0eeeb55891d8fULL, 0x2c3b80bd229aa1a7ULL},
+    {0x74fc6c8526a70b77ULL, 0xeaf66d8ae8ae4d62ULL, 0xf979c4b5dd2cf90cULL, 0x2bda44f1d961eb31ULL},
+    {0x8c0b39b68f4b9b73ULL, 0x151eea856b1b2825ULL, 0x95e5ded3f198d867ULL, 0x133a0fa9cbfa3b5bULL},
+    {0xad2391b8fa5bf7e5ULL, 0x09927fa49c67ffdaULL, 0xaa57da5375cdecbdULL, 0x0f0c3d941d81ee35ULL},
+    {0xaf0a06f727abb4bbULL, 0x18d736c831d9160dULL, 0x32e33b8118110bf7ULL, 0x1db08a505ef67b69ULL},
+    {0x1e54b38c7ce4b3f0ULL, 0xe77f8b6e41cbdd94ULL, 0xb7e859714215e793ULL, 0x08a07b4dfee186e5ULL},
+    {0xe27cea76492152c1ULL, 0xffbf6f31b14e3ab9ULL, 0x4c703b8f0503a55bULL, 0x0fd59fd651c328edULL},
+    {0xc055a2b0ea51f7b5ULL, 0xe1327b007be2d34cULL, 0x0ef5dd87d9c8ee8fULL, 0x086163b167a4b7a0ULL},
+};
+
+const uint64_t poseidon_alt_bn128_partial_M_col[285][4] = {
+    {0x56cf632e23c3cf35ULL, 0xc89627ef8aad5f80ULL, 0x99b3057b01e0710cULL, 0x2364bd96e19e5a09ULL},
+    {0x75c2f7996fca8cc3ULL, 0x548ead83b12e6d20ULL, 0x3c5283a34fae4e3bULL, 0x2a6035d7d51c39e6ULL},
+    {0x3c681dc91008919dULL, 0x9a1746ee1b177ee9ULL, 0xbd1bbe6ff9feea9bULL, 0x0d1eb37136254781ULL},
+    {0x92c48eb5f43ec60bULL, 0xa8eec16460c0c6cdULL, 0xaf2dc6b87df68a1fULL, 0x054e68c46947a5c0ULL},
+    {0xb4271e6e11556d5fULL, 0x64644746130c450bULL, 0x2a3640f40abe3e9eULL, 0x0adbb789eeb14802ULL},
+    {0x085871dccd75c3a3ULL, 0xe80372ab8167a8b8ULL, 0xd00cc55f83e9fb08ULL, 0x289faf174317058fULL},
+    {0xec92bfdeaf5bba73ULL, 0x76c4fb6b0afa23e5ULL, 0xba901a60effe1f72ULL, 0x292b28e8f4ffe22dULL},
+    {0x9acf278ef4abf0b4ULL, 0x01fd7393c3929a10ULL, 0x354664e0f399f395ULL, 0x0cb54e20af82054cULL},
+    {0xb2bf0da99c02f755ULL, 0x5858ac028a1a7329ULL, 0x39d01ef6ef71a8e5ULL, 0x1d469df6cf0b87c1ULL},
+    {0x9cf2bbea12919661ULL, 0xf8d0d7a67d4e6f6aULL, 0x284351b55ac38de1ULL, 0x0f2daf13d64be1ecULL},
+    {0xef52c23e8cd2b162ULL, 0xfdc92bbe490574e0ULL, 0xba71f628e6e17642ULL, 0x090d2fcd7e2bb235ULL},
+    {0xda8b7b2ce2befba0ULL, 0xc8293c664d7b7684ULL, 0x018b0b01fd4f2fd0ULL, 0x302881f211f3d95bULL},
+    {0xa121e987dbad4459ULL, 0x47351b068df1585bULL, 0xeb3abbda73c45fa3ULL, 0x2cf08c330cca169fULL},
+    {0x3fdfef8b7af9a470ULL, 0xd7eda955f06f8044ULL, 0xa6c96d0eb4d6835aULL, 0x1dd6676f11e6c842ULL},
+    {0xdeae8360b27ab883ULL, 0x1e1ea7cb50669680ULL, 0x940fa36ce7ee7a9fULL, 0x0779ea087b76f398ULL},
+    {0x2ff0e6c8c42b57f7ULL, 0x241eee001b71407aULL, 0x07a1f6400b1c6f9fULL, 0x2b18007a7c2321a6ULL},
+    {0x1d859ddec3462fd8ULL, 0xccaa30fdf5fca89cULL, 0x2721649caa0aaf17ULL, 0x01ea797116602c52ULL},
+    {0x88306be5c4ef3956ULL, 0xa9d74421470584a2ULL, 0x30f6f429d0fa24b3ULL, 0x10ae56e8850bb41bULL},
+    {0xfecd97e605e7b2e9ULL, 0x000c3737c92ae4ccULL, 0xeebc8cd896a560efULL, 0x07b9f869f749db0cULL},
+    {0xb34911c64955f65bULL, 0x9962c4ab86d1b784ULL, 0xeecc58c9d289254cULL, 0x2296910cbdccb168ULL},
+    {0x14f57a38f4fbdcfbULL, 0x2017463e0c515e3fULL, 0x2a281aac088a87baULL, 0x1ff11132575bebf7ULL},
+    {0x738643d2a3de570eULL, 0x233dad3b383d8218ULL, 0x1f95f139ddc57c3dULL, 0x04326dd3940dd205ULL},
+    {0x46ae8c0d59f210c0ULL, 0x84ee364569968585ULL, 0x60ce81a568e63cf1ULL, 0x080a1389e6a97804ULL},
+    {0xc07cecb3e0591d18ULL, 0xbbd3b5233211ad8bULL, 0x19026e8c2ad7a6e6ULL, 0x0de7540b9cac22d7ULL},
+    {0x13d0803072e57ba9ULL, 0xb853eba0e5258d09ULL, 0x251a24587fad37b0ULL, 0x168cff8d0f92f811ULL},
+    {0x3dcc33b269250398ULL, 0x71b95666293876f8ULL, 0x4aa91243c23e4e7eULL, 0x0b579931fc9b0681ULL},
+    {0xb3bb135f482cee08ULL, 0xca06f24527829d74ULL, 0x9f5f2e01672f6d7fULL, 0x22ffc7f8635962e0ULL},
+    {0xc163527e0e342c33ULL, 0x3a29ce9213e5ab6bULL, 0xb9804f664b64b61bULL, 0x110dbe0b9c0b025dULL},
+    {0xbf0530a86268bc37ULL, 0xbaa0c28df0624cebULL, 0x896b20c2bb9b7d66ULL, 0x23f3a4f07a7d08d5ULL},
+    {0xdc592f93a059f8cbULL, 0xda71061e1232e0ceULL, 0x46566a70594bad31ULL, 0x170d10f72c7bb5ceULL},
+    {0x556492768c040c35ULL, 0x366681fb97b5d566ULL, 0x2ecc6bb21cc083e5ULL, 0x10710409adac57c2ULL},
+    {0xa7954ac591d6305cULL, 0x7d390478cb4c0edcULL, 0x0e0fe18fcd8224e1ULL, 0x16b528fb93c97cd8ULL},
+    {0xab7970794d9da2dbULL, 0x57a46dc51566fb2bULL, 0x526c531c6a87319aULL, 0x2491ff1b10124c7dULL},
+    {0x27c72206f802d2a6ULL, 0x2ee668b56c178096ULL, 0xeaaf9faff849b415ULL, 0x0e2a9fced59f66fcULL},
+    {0xf0f21f0b180ac09cULL, 0x9cb3e91e5e924a4bULL, 0x75e28c355c18b0d5ULL, 0x113520772183c60eULL},
+    {0xa9bcb197f1ef28baULL, 0x532b2b224a1eeff3ULL, 0x2c3fe43320cd1447ULL, 0x038d3edfa85c377dULL},
+    {0xdd4d834a608007c2ULL, 0x2ae32ab195eba941ULL, 0x15cd1c7e4179c0baULL, 0x29b3d073a661453cULL},
+    {0x898c5acfbdd41649ULL, 0x7bab5e87547c3800ULL, 0x3734dfb59228de28ULL, 0x183d48da134c0595ULL},
+    {0x5959330cb3dcee5eULL, 0xf7f424bb947a0d0aULL, 0xa4de26b68eea6466ULL, 0x1caad105877cf23fULL},
+    {0xd038383429cd8ba5ULL, 0x135769ce163c8502ULL, 0x8a5e94554d6e5d9aULL, 0x2b0fd13df5aac489ULL},
+    {0x4f676970933bf92cULL, 0xf8ed8543acab2799ULL, 0xa03a9136fccf46d8ULL, 0x128edfe282d494eaULL},
+    {0x500cc5b5bb8bfafcULL, 0x3173bc73f838fca7ULL, 0xe1cb80c34bcea032ULL, 0x29fe2cb3c4275c9aULL},
+    {0xd68e9d6fab59710aULL, 0xb4f36b63c53f7fc9ULL, 0x9107070c956f9628ULL, 0x03ca57d292c9ea5fULL},
+    {0xc9bffb7bd8713fceULL, 0xb0de7bce083c5535ULL, 0x4a6df1e6c5350030ULL, 0x0398e513046b2fcfULL},
+    {0x8ef3dc9573649880ULL, 0xe5af2753735254ceULL, 0x20d2c7abfb3df824ULL, 0x0fea56b446289536ULL},
+    {0x552566d855f42e1dULL, 0xcc266e65c2f13f4eULL, 0x3f85b1b5d2130ba4ULL, 0x2e7f3501ada90147ULL},
+    {0x042a2f5cb71fb935ULL, 0x3cc93843fc393b56ULL, 0x4ad6f1afd40ad8c0ULL, 0x2daaee97843dc9c3ULL},
+    {0x4efc58e15fbe6ab1ULL, 0xf8995807d2b202bfULL, 0xa3bf69d0747854e3ULL, 0x111e79d17e82877fULL},
+    {0x7261c47219879408ULL, 0x830386d57366bd7cULL, 0xe69bb1443b1e879cULL, 0x18d315ecdd665e5fULL},
+    {0x8360448c2e55001dULL, 0xf610083b4b00b537ULL, 0x6867d57c3b123604ULL, 0x2c57a4d39efc80b1ULL},
+    {0xc472b64deef8a94fULL, 0xd81e6ca86e772f1aULL, 0xe941482e1a559c76ULL, 0x113e284f8b8f4891ULL},
+    {0x5dae07af067dbe88ULL, 0x372c5f48b6cd89d7ULL, 0x195fad7c63314313ULL, 0x03dc68b0f07fa9b5ULL},
+    {0x8bc7d6960343f373ULL, 0xbc561068f0d93553ULL, 0xa2a14ba8a3210055ULL, 0x00a0ea7e95612924ULL},
+    {0x13f9761acd88df2cULL, 0xa80a45d77723e053ULL, 0x82987b53e8068c01ULL, 0x11eed3da899f2775ULL},
+    {0x6fc7d04fa2621184ULL, 0x95acd2b0772127b1ULL, 0x02ae405d5d1ef06eULL, 0x13d6bb01ac7f568cULL},
+    {0x487b6bd87c04a41aULL, 0x6ecc7411ee9e63e3ULL, 0xf5f8c9137414649bULL, 0x02f8ce9924991351ULL},
+    {0x0a4fa5ea7818546eULL, 0xb30f8e4a0d2dcce1ULL, 0x5c93af8a7d905542ULL, 0x00e832c76179d8beULL},
+    {0xd8c2ddae7fdd2e2aULL, 0xa2c38b53b22e2966ULL, 0xa5670c1e8496441eULL, 0x25e5aed91602981bULL},
+    {0xbc165833f38deaf4ULL, 0x86966ea233371d89ULL, 0xf44b20e80a085774ULL, 0x2a770174eca56983ULL},
+    {0x8fcb4ad22fbe00d7ULL, 0x9af17880a560132aULL, 0xe12128822e3b00c8ULL, 0x2661eff27a379878ULL},
+    {0x3f45cd8cad52bc45ULL, 0x21b84d90154106b3ULL, 0xfa6b9fa5abc4a18dULL, 0x0dfaf0bb3a354cd6ULL},
+    {0xd5ed74ec0c1f4e0fULL, 0x5ab8dce58539c5cfULL, 0xb3c3d5f2080406ebULL, 0x12881eb83d0fabd3ULL},
+    {0xf4f46560ab30b9d2ULL, 0xd54009206a0990f0ULL, 0x657864652682de38ULL, 0x22b88f34b8d95ce5ULL},
+    {0x384baa951f51ae65ULL, 0xcbea4bda2040ed21ULL, 0x4e9ba227a85c80ccULL, 0x0aee8e25a7c5b51cULL},
+    {0x411444e01dbe0be2ULL, 0xbfb82b9309ded6d1ULL, 0xa67f3f7f28903145ULL, 0x1898a6987b9be256ULL},
+    {0x94be0e73ba26c304ULL, 0xe370a2bed4a19929ULL, 0xe9ac5d266acdcc48ULL, 0x1b44966ea3a12646ULL},
+    {0xdca8c28c06fbad17ULL, 0xc5151514c4778331ULL, 0x69d1eb7dc550f589ULL, 0x10a9ea866f771b14ULL},
+    {0xd06a000a73d3f75cULL, 0x08f562191fdd0772ULL, 0xb2d4a8d141416bbaULL, 0x296551f077117aacULL},
+    {0x42bbca8731ff6f01ULL, 0x24db5313915700f7ULL, 0xafe8aaaa597f3dc7ULL, 0x2f3259d383eede8cULL},
+    {0x56acb1ab03e2bd14ULL, 0x287cf2aa3c81c1e8ULL, 0x270751a50993598cULL, 0x223d7741594ca4d7ULL},
+    {0x3baebd8f9bd83c43ULL, 0x77ab93ec97c742d2ULL, 0x2ea68fe543c53580ULL, 0x2dfd25c64c11b308ULL},
+    {0xd636e560cf36111bULL, 0x9b69acbc643ed5d3ULL, 0x569f53796166008eULL, 0x064b8dc042498bd3ULL},
+    {0x886bf57dbb869756ULL, 0xb4e292d27701b358ULL, 0x438e6fd68f5a49c9ULL, 0x23ae3e0f2c067d2dULL},
+    {0x5a75a1585efa39a3ULL, 0x5f0264330c357dcbULL, 0xa902c47e04fe5818ULL, 0x17dd03d16c7fd597ULL},
+    {0xddd93f93eaa4cd4eULL, 0xd180623d037aae5aULL, 0x53149c6d1bd83c41ULL, 0x12f7e56367bf2d5cULL},
+    {0xfb5945718141f06cULL, 0xe227a65f61430aebULL, 0xc691b83ad1a317b5ULL, 0x1d90b93ac5e481f5ULL},
+    {0xfee03307aec80014ULL, 0xc85884ef8d94ad1fULL, 0x0bd560185e294f79ULL, 0x1c4f07367d5e436eULL},
+    {0x59970d21a15086b1ULL, 0xc728bc4c237196edULL, 0xa19b1ad4edd28d4fULL, 0x19c81ea8856d457cULL},
+    {0x28c56e7f9a2e6f07ULL, 0x05cb76c5b25e337dULL, 0xc9f04d6b232e86bbULL, 0x24b1e9f57aff014fULL},
+    {0xc47b0fdd0193d742ULL, 0x79e3e4bc0003f9bcULL, 0x7c209141a512a150ULL, 0x2571c9adb9361d8eULL},
+    {0xd49c2019f6f14baeULL, 0x31a534f9564862ecULL, 0x2150b7c8d66b7f06ULL, 0x0a6b0086996cd367ULL},
+    {0x8782cefb367c7e6fULL, 0x4396ac8c4a09e342ULL, 0xedbe1c13d4608c6fULL, 0x123a651e361df9beULL},
+    {0x6a035869c9533e03ULL, 0x20ac2add27c78b5dULL, 0x5b3acfaa5d8e0525ULL, 0x168c5e5769f5c8acULL},
+    {0x83e4a2fe66a53654ULL, 0x5e7dfc5d6bf63986ULL, 0x419b7ea42a32d083ULL, 0x14f9977dda1fc1acULL},
+    {0x5f52f7a459c745a3ULL, 0x8b23f271d353c408ULL, 0xc88430b72f19cc41ULL, 0x0a4849a03da4304eULL},
+    {0x030090ff982c13a1ULL, 0x28217d82855850d8ULL, 0x83c6eefcadf0e5a9ULL, 0x10f442db6a570344ULL},
+    {0xd116e557499219a6ULL, 0xce94d9c6d26c7082ULL, 0x93cb5a0ff2121b19ULL, 0x2287e3e72da0410fULL},
+    {0x641a6349b75f3f67ULL, 0x725e49576007417dULL, 0xf0d0b640159280f9ULL, 0x21f71c5a17d3256bULL},
+    {0xee724d4a85df1431ULL, 0x80ecb392922a9223ULL, 0x42dd228f2b163c2aULL, 0x218e0b1c11d2b6e3ULL},
+    {0xbb5b2dff4edcdd5cULL, 0xccc5bf9822da8e84ULL, 0xdfeaf79369aaffd2ULL, 0x26390cec4047f94dULL},
+    {0x2e95682a033df017ULL, 0x6b73726d0f48d96eULL, 0xf9d62390ebf48cfdULL, 0x23e18d512af468c3ULL},
+    {0x85f1814a09687bebULL, 0xd88cb84dd3e71213ULL, 0xf4591aa839347834ULL, 0x0ef2fd4f9bbffbd2ULL},
+    {0xcca2481204a0b3dcULL, 0xa81c2d8c69efab19ULL, 0xaa36fcc52c7eed4dULL, 0x05a2a6b14cade647ULL},
+    {0x09d00c9c71098aa4ULL, 0x992b455eb96c15daULL, 0xdbef68d6f2f4145eULL, 0x1d6585a6cbeadd12ULL},
+    {0x9c8e6b3299d22954ULL, 0x6b5d138115d03832ULL, 0xfede21b86ae70556ULL, 0x205e28b696628de3ULL},
+    {0x4bd82b876b149e01ULL, 0xd7e8adde8c6373cbULL, 0x0697eff3c1922bbdULL, 0x24be5b85cfc2c639ULL},
+    {0x952e19ef3d88c5b6ULL, 0x5caa708131e3c3e9ULL, 0x9e257a5b071ad297ULL, 0x2f42efdea16294afULL},
+    {0x476eb560b18dfa4bULL, 0xf7a0e3b21fddda9dULL, 0x397cc37f3716bd62ULL, 0x1897afd82b425c20ULL},
+    {0x0d77a3ec2788dcaeULL, 0x2a93e7a34dd0e912ULL, 0xa145660ee21ceb9aULL, 0x04f6694be66eef1fULL},
+    {0x146862b653fe5b41ULL, 0x1c280e3bd5237353ULL, 0x1c9c8beb757da38cULL, 0x2daeafd5dfffb588ULL},
+    {0x7b85191247d82538ULL, 0xcf908f8475a89db8ULL, 0xd48dcc2e9fbd8833ULL, 0x09e21d2a5d5fa8cfULL},
+    {0xdf7683082250ffbcULL, 0x6d66cbdfae930ec1ULL, 0x83f486daa708a277ULL, 0x2bb2b359448c11c4ULL},
+    {0x2b8af1d1225dd716ULL, 0x772573899ea218a5ULL, 0x420483d9be7ee38dULL, 0x14a65614a9264713ULL},
+    {0x5f0372d710ddfa43ULL, 0x54f4a73f105b9c01ULL, 0x4090a98f61de17b9ULL, 0x190d9ffe78d6fe50ULL},
+    {0xb2c9a762b0fdba1cULL, 0x1bd3c9c4ba49f793ULL, 0x53c60f32f155c82dULL, 0x00dbc915a3271380ULL},
+    {0xbbb8bdd3ab30106bULL, 0x67ad2fc7d1ccc10fULL, 0x52a3d8b0e30b34adULL, 0x09c1c133fe4ae7d8ULL},
+    {0xe5134865ef54ab8dULL, 0x2f4c72107f7406bbULL, 0xfd26520e00ac429eULL, 0x23c795a66895875bULL},
+    {0xccc50ada39d27f45ULL, 0x8ba82f6ac74d4e2eULL, 0x00c5a57625da5f5bULL, 0x1e488cfac280f93bULL},
+    {0x1140de331e556662ULL, 0xabb7c38a4577b064ULL, 0xb697606c044f2875ULL, 0x1556a0edc685dff0ULL},
+    {0x6231ed18c23f2898ULL, 0x4edcc9ccb33469daULL, 0xe53ef3bb6730dee1ULL, 0x13d4f9de31c6560eULL},
+    {0x2c190ba9e94d90caULL, 0x34edadb1242c624bULL, 0x6e24bfd94d1d9b88ULL, 0x24c66ca58520a6fcULL},
+    {0x84c366a16be4b631ULL, 0x53b495342191aaf2ULL, 0xa811ab614d28f5f4ULL, 0x160626f29f4242dcULL},
+    {0xac2fdf404ef3734dULL, 0x7a638a3b086ac838ULL, 0xcc3fb73ff87aa86eULL, 0x22466dbe8c7f4a19ULL},
+    {0xea2341026cf55a69ULL, 0xfbeac4aa397b9067ULL, 0x8e0cca8e48bf1ca1ULL, 0x0d9f496a4d5489b7ULL},
+    {0x942867d1591ea63bULL, 0xebdd1bdfb750ee78ULL, 0xe13ea268780d85ecULL, 0x079c13960fcb8168ULL},
+    {0xfc3946e77b39efc5ULL, 0x8b495584995a3f8aULL, 0x4efbb905c009a350ULL, 0x2e6afb2de4c5c097ULL},
+    {0x0ff4ba2442fb097dULL, 0x4e52105fa37f1399ULL, 0xd76a411937db5bcfULL, 0x0d678239d2b2a859ULL},
+    {0x46abc5e324f816e4ULL, 0x658a3b4d7efe7321ULL, 0x9c60eb16f0551fa7ULL, 0x2bd4abc12a5a1e3eULL},
+    {0x47b88dfde5c30d11ULL, 0x4ce70bd326b831d8ULL, 0x06af55728997b996ULL, 0x010e62234cfdf6edULL},
+    {0x7e7e0ee8e8065894ULL, 0x305b622189361d87ULL, 0x53e939c8658683d5ULL, 0x1ea7b557d39bf354ULL},
+    {0xf5224711c94cb942ULL, 0xa8bec9b79da73cf3ULL, 0xa0895bc353cb5082ULL, 0x1b2b2b5bb907e324ULL},
+    {0x6256e027db1e421cULL, 0x654a5be684e7a162ULL, 0xd6ad91fa9a138e3dULL, 0x26e9ab7bfe1dfc4eULL},
+    {0x5992385340c80ef6ULL, 0xc97bd9a2016f3d7eULL, 0x28aaf47057ff9441ULL, 0x2030a618f24c65abULL},
+    {0xe47b0e8cd396fa70ULL, 0xfa6a763fbcae5f56ULL, 0xeb60303053af24f5ULL, 0x2dc50c157fc4f689ULL},
+    {0xebe7a357646231b9ULL, 0x91b8bd4e27af2d14ULL, 0x7120857751e1dad3ULL, 0x25cba6d927a17288ULL},
+    {0x1e4c0d5d47c6b2aeULL, 0xe08b4c50f134ed52ULL, 0x6b8f63fdf78fbda9ULL, 0x09b834ae7fabb523ULL},
+    {0x549ba4bf4f964025ULL, 0xcfd3e17aa1936b62ULL, 0x7bbafbe6745c0dc0ULL, 0x28d5195b38fa0acdULL},
+    {0xa7548af9b5418107ULL, 0x9e4bd99130fbfdd3ULL, 0xe91529c55a5c18e1ULL, 0x264b8274787bd587ULL},
+    {0x69486aa913e26cb5ULL, 0x87dc5d13ddb72fe3ULL, 0x25923de1aa535fb8ULL, 0x0de3ddf3d55a3f64ULL},
+    {0xf805d8b253f56330ULL, 0x97350ebd50f667edULL, 0x2411abb39116c1c0ULL, 0x1415819f5247e886ULL},
+    {0xc3c28e6df04da7ceULL, 0xf6b71859732f04daULL, 0xe6c21c962c1a63d8ULL, 0x247183b2f76a4589ULL},
+    {0x4e5d734cf3520973ULL, 0x141b6e3c43ee377fULL, 0x8458f2f8b293463cULL, 0x28dc299f1244c24bULL},
+    {0x4b935ac0c537dc6dULL, 0x6c7c49e4de58d497ULL, 0x36dfa29c5d4fc537ULL, 0x2b471500668e4d37ULL},
+    {0xda533dfa7007a928ULL, 0xced6cf7a81ef90c9ULL, 0xf59dc3875bed3382ULL, 0x026095133902e59dULL},
+    {0xad860ce53f5244d3ULL, 0x764926a72527f16eULL, 0x8b949871db98792cULL, 0x1dca40bcf0d7e036ULL},
+    {0x89dd8fd391e40b86ULL, 0x6ab38f21e6afa277ULL, 0x78d686b1762e1a90ULL, 0x0363ec6f2d259adcULL},
+    {0xea933601e6bfc9b8ULL, 0x281f475876749027ULL, 0x26ffd16cfc41c706ULL, 0x25bcf9ed40a160c1ULL},
+    {0x1d48a9f1e9cebee3ULL, 0xe56ab81275f6bcb1ULL, 0x86904e97bbdc81b7ULL, 0x0fe611f0d2070ddaULL},
+    {0x88a6917d2cc34cc7ULL, 0xfefc5175e8a545b1ULL, 0xfa1261cabc6a9bf1ULL, 0x11892c68e7ba27b1ULL},
+    {0xd4cebade4208a06fULL, 0x55448a6eca816877ULL, 0xe2ea598565d71cd5ULL, 0x231b96ace4ec65e0ULL},
+    {0x9b86fc7739e12abaULL, 0x0284acda2d1fb5e1ULL, 0xfe72d77e39d106cdULL, 0x02d598d3e8d5aeedULL},
+    {0x957eab8241f87664ULL, 0xcb7cfcb32f3b8998ULL, 0xd1612db7256efbf8ULL, 0x12b4fe3194fdbde3ULL},
+    {0x228d56fbedd5712fULL, 0xd05e3986c957b107ULL, 0x9f48ad18b1c76ef5ULL, 0x02584d019521a5edULL},
+    {0xdc98c35ff8e0d74fULL, 0x539be677f6a7fb02ULL, 0x2084366795f33a1aULL, 0x2d6396aed322cd3fULL},
+    {0xd9b442abebcf6269ULL, 0x408100c9f8295b04ULL, 0xe8b1af5b53ec9c99ULL, 0x223cea80e30e7d9cULL},
+    {0x0ccdedb1a2c7199eULL, 0x416f734d5dcf9c3fULL, 0xddcf0224e779543bULL, 0x11a3dc62aa9ef5a5ULL},
+    {0x6085f09d4c49aefcULL, 0xe259483421cbb95bULL, 0xdf9c5c05f5ab0d33ULL, 0x012bebd088f1f6cfULL},
+    {0x2f031754f027afaeULL, 0x792d10af16542ae6ULL, 0x7540c4300b08960dULL, 0x0c1c1d00bd868deeULL},
+    {0xa89fcaaab7a1c5ebULL, 0xacfcb34d68f45540ULL, 0x9702b2414312e8b8ULL, 0x15891f0a62d03849ULL},
+    {0x7fa91c961e5daf57ULL, 0x465ccbe600788862ULL, 0x286e53d48c4a60b9ULL, 0x2c981f70658d3f6eULL},
+    {0xa6d17a3b30236a0aULL, 0x4ec798467547e937ULL, 0x825b0c13a04fbac5ULL, 0x135c2525ba53d496ULL},
+    {0xa4db0ed870a1eedbULL, 0x4c7fbd9e5334ac73ULL, 0x3f1cd4230fa29581ULL, 0x087a30196db047adULL},
+    {0x7754edfbf13c2a9aULL, 0x5380fd537549de6cULL, 0x6315752c37d8ce3eULL, 0x132deedcc5f18ba0ULL},
+    {0x02eb59048cd883a9ULL, 0x825b3272fcae41f6ULL, 0xf20cdf9ad5cf3a3cULL, 0x2af377b425eb6f6fULL},
+    {0xbbc3a4f85617b8d7ULL, 0xededc5e3184c64ddULL, 0x489d1404804887d6ULL, 0x2fba109668d09b4eULL},
+    {0x1df27d50aeeb9ab3ULL, 0x9a8dc7c170f8dfe0ULL, 0x3a7e0d35c78b2e20ULL, 0x2072f62024b0bb50ULL},
+    {0x9eea1b3c188ff7dfULL, 0xf467b3abb07b4653ULL, 0xf766c381309652a5ULL, 0x1d791b8e25a8e2c6ULL},
+    {0xee1bab8ca90ae7f1ULL, 0xda3c2c2db2e276d1ULL, 0xc3c0fe8d2f40df74ULL, 0x0c7fed4ba1b07ad1ULL},
+    {0xdaefb12d4aadad7fULL, 0xa3827cf2ef0cc766ULL, 0xf0de25a3053b4977ULL, 0x05a396d8e8d685f9ULL},
+    {0x7798f87a941ec862ULL, 0x04c4b92ee4c982e3ULL, 0x327aad96f4ea4edfULL, 0x1e1bffd8e82359ffULL},
+    {0xd74e0af9af9cca89ULL, 0x6f62fe032dc2ab28ULL, 0xc2ebf5fb55de4e61ULL, 0x01e2b6a695375bd8ULL},
+    {0xf1cdc78260c55076ULL, 0x3008675445943d30ULL, 0x7ec2f07f1fb0e1a3ULL, 0x22308b9905c8270dULL},
+    {0xb51f88257a9a61e5ULL, 0x55352f537b5c7064ULL, 0xab5ca1ff18efee5fULL, 0x23e85b27e1d28cb4ULL},
+    {0xda738333ee1f2171ULL, 0x56910cb792e1e54cULL, 0xd0c54cd341a5fd52ULL, 0x1f423e2907460d5eULL},
+    {0x93bb137c47ea0ecbULL, 0x365265f3bf58e194ULL, 0x1bb9cb1867fd97d7ULL, 0x167085e7de445fc8ULL},
+    {0xf553f6481dc14dc4ULL, 0xb0525bdd92a521cfULL, 0x3cbca8cbf0e6da6fULL, 0x15563a682d5a0d77ULL},
+    {0x6e35dad5fc607f80ULL, 0xc7152f0973c0fcdbULL, 0xe50e0f3c1869f70aULL, 0x270971327d459980ULL},
+    {0x765e75bd594c1c41ULL, 0xce4106edebf6ed9fULL, 0xa48c0967a7823571ULL, 0x1507d2ad38360d39ULL},
+    {0x479397128474362dULL, 0xeca12ac4f4e98d7dULL, 0xa0de25256f1014e8ULL, 0x2ec26ac9eef69b23ULL},
+    {0xf5f347d067670142ULL, 0x075cf34ab3282c3bULL, 0xa92f9de9eb6e3fe3ULL, 0x218b316693b60272ULL},
+    {0xf0f9d5964bca5914ULL, 0x2a6ee11af75c56daULL, 0x99fd6a93a9eff8d5ULL, 0x1e76d9036de43375ULL},
+    {0x16e5950294f1a7b1ULL, 0x45502d302cb9639dULL, 0xda63c6e40f7df560ULL, 0x0e3aec250651d75eULL},
+    {0x3811774aba8803dbULL, 0xa31b65a8922f1db5ULL, 0x870c7eafc118cb55ULL, 0x287e01116f5d606eULL},
+    {0xc36eea4efd71b2b7ULL, 0x4d0c1709247c6ea3ULL, 0x34925efa3dc59c10ULL, 0x0804dca27633d9c8ULL},
+    {0xa4772f9d8bfcef35ULL, 0x6249b5b6594c5171ULL, 0xb6f452ffd631a607ULL, 0x1e026c48f52e044aULL},
+    {0xe70bf30e31f81b6aULL, 0x3f9246a8bd87dc1cULL, 0xedeec17ad9f62280ULL, 0x24bab9d68903cce7ULL},
+    {0x9bc4f2dfc56249afULL, 0x9a10a90dc9655168ULL, 0xd668588e34bd6700ULL, 0x0569cf09a3954b9bULL},
+    {0xfd56e34221715c34ULL, 0xbaadf95d94b48785ULL, 0x98a92894ec3a16b4ULL, 0x2f71776883652c0bULL},
+    {0xf664593d1d95aaafULL, 0xaf5c49754a40ca6aULL, 0x672071abacd5adc9ULL, 0x2468be7ac446b0a0ULL},
+    {0x677378e4d6f5fa25ULL, 0xdeb6d83d16aff5a9ULL, 0x431c4d86e41ae338ULL, 0x2f107cc51c7b3dd5ULL},
+    {0xa8ae61695caa33d5ULL, 0xe2441b26183b14daULL, 0x0d6281387cecaf5eULL, 0x12d4ffcf1a440cc9ULL},
+    {0xe5c6a5f6a1df5c6fULL, 0xb3aef2d7bed7c153ULL, 0x4dd2415aa6920a32ULL, 0x1d4987df527ca508ULL},
+    {0x684947a43e7c7ab1ULL, 0x98a4fc6c0d42def3ULL, 0x2039740a9328d687ULL, 0x09105344ce34f57cULL},
+    {0xadf607fee8fcb667ULL, 0x5fd4658ad3b76016ULL, 0x35d893f15d192ffeULL, 0x2eb286c6ee99c838ULL},
+    {0xb53d5b538370dcc6ULL, 0xb40c62d95f2249feULL, 0xf4aa83a2034f44f6ULL, 0x2d55fac8b346f028ULL},
+    {0x0e97639645a63976ULL, 0x183d125f0a742c00ULL, 0x43009dc096570eadULL, 0x2ed975d94635e721ULL},
+    {0x8a0b316a6a2cf8f5ULL, 0x03dae7156e534443ULL, 0x72642885e3472216ULL, 0x293c006d6b01af6cULL},
+    {0x429401f287cdc1a5ULL, 0x08b2b14c53f2f479ULL, 0xa5367cac88add922ULL, 0x04794d152fff4f71ULL},
+    {0x14310a5ad66c8fb4ULL, 0xdfb0986a4153512aULL, 0x37311821adb28dd2ULL, 0x0b1774c780a0f728ULL},
+    {0xe12760c39a8bdc6aULL, 0x90c4fdb3305dbc1dULL, 0xc476d8c65805a797ULL, 0x1a574704759e3eceULL},
+    {0x5d0940d9214842e3ULL, 0x99de45ac5d84410dULL, 0x541ccff0fcae6bd8ULL, 0x0fb7b4874acc6b97ULL},
+    {0x93fceb6d698e3981ULL, 0x0eda7b2de0517ff6ULL, 0x67abe620966c6165ULL, 0x2532b28545067aa9ULL},
+    {0xb1c690f2b47191fbULL, 0xf98e6e0b5626eae2ULL, 0x4712fdbd9f8070cdULL, 0x08e399ab87e774dfULL},
+    {0x7a8945937e2cfea6ULL, 0x3c0dd0082af0f105ULL, 0x39ef362930079534ULL, 0x10a0351d9d37e8a1ULL},
+    {0xf325629e925b288dULL, 0xf82f765163904889ULL, 0x22c49413532de089ULL, 0x226f4f300cb12a79ULL},
+    {0x13968af48d766585ULL, 0x815cf6dac79a4646ULL, 0x02269b264b6bb8c6ULL, 0x1336a067c4e590acULL},
+    {0xe183aeeadbf0b898ULL, 0xe2103ca6b10b9c73ULL, 0x72cceabdcfa29427ULL, 0x21cedfd6f1813819ULL},
+    {0x7e4402e09e84be59ULL, 0xc736bcacd30de24aULL, 0xa17c5bca889fca31ULL, 0x1e3b749d5e239e4fULL},
+    {0xa100552121c671e0ULL, 0xf95058ec4ac30c29ULL, 0x9ac5ba01f5781d66ULL, 0x1751d8a16f27fdabULL},
+    {0x650c7876c623581cULL, 0xe3433c15604ad33eULL, 0x7f605c9107c279a6ULL, 0x0540e64662aff4e8ULL},
+    {0x273b888094d232e8ULL, 0x6d6ba76f80dbc161ULL, 0x8a0a2fd87e7b2dddULL, 0x20680d88972852a6ULL},
+    {0x957ceebc7f1fcb90ULL, 0xd647da0cf8b3ec71ULL, 0x3e25419cbb4431a5ULL, 0x1d2bd2f1297c232eULL},
+    {0x4d4f76c96c8d5f9eULL, 0xbe2ab979775dbb76ULL, 0x97f8d06fe8bc3980ULL, 0x0cd8016abaada9d8ULL},
+    {0xd78cc6a70d87d802ULL, 0x2fdce3fafb281751ULL, 0xeecc0d0a21330af7ULL, 0x2edd335efdffb4a0ULL},
+    {0x66d81ac8c8905704ULL, 0x4acfea89e2e52d7cULL, 0x17816ce90b4100b7ULL, 0x00c70d89248da811ULL},
+    {0x5e2af660861290f4ULL, 0x48713115f91b7e9aULL, 0xa8e55c85b39c4676ULL, 0x1383a80a61d6926dULL},
+    {0xb94b3279b5e17712ULL, 0x55a4e211ab599432ULL, 0xb8219b8d175a7c67ULL, 0x1a5282af1bd14a9cULL},
+    {0x93e754e92c907a38ULL, 0xb1e4472c6a1e1733ULL, 0xd864d67f3a9d9cdbULL, 0x16b75f2c928efe9bULL},
+    {0xd93346f0e40fc06cULL, 0x2a48728bd77485aaULL, 0x7ec1f7ee69cb7aefULL, 0x03311be086a8a227ULL},
+    {0xe246322951435841ULL, 0x825c80f463047434ULL, 0x0bdee15dda25bbf6ULL, 0x0ecd1423f74a29d1ULL},
+    {0x3df1f5f5a4982e90ULL, 0xcf1dfad92bf729a5ULL, 0xbf61dba4d8bf2a81ULL, 0x20a56fef3d6a7632ULL},
+    {0x9274697cc7ca5334ULL, 0x272f07b5f24a5be3ULL, 0x9af1a1c1a52fba6bULL, 0x1935df7bb40835fdULL},
+    {0xf8a841696f496d30ULL, 0x66a24cc4959a7e69ULL, 0x403eebd5af17b97cULL, 0x2bbbc52a8f3f1d97ULL},
+    {0xe548bca9e62312ffULL, 0xeb950579cbef223aULL, 0x0bfa53e673e1b325ULL, 0x0ae486a324e92466ULL},
+    {0x6d03a69fdd8389feULL, 0xfe832b28f5ed138cULL, 0xe1139ef45a31c091ULL, 0x239581423a17d358ULL},
+    {0xf2f64b9c3a1ef359ULL, 0xa32a1ff6dd2d28c6ULL, 0xa25ae7df05275172ULL, 0x1a06623e1335fa8cULL},
+    {0x983e4823bf0de992ULL, 0xbc239e64bc781c2bULL, 0x8c3b9b14a9642b32ULL, 0x24d1ef85a9683790ULL},
+    {0x0629070d2a7d3ba9ULL, 0xeeb6c5da5a67c49aULL, 0xd21cd14923a3d334ULL, 0x17e14dfe278f99ebULL},
+    {0x212c4a3273589d0eULL, 0xbd01e67421dbb86bULL, 0x876b5885d96caef2ULL, 0x21c50f44a48ddaa0ULL},
+    {0x951fe218a36bb6beULL, 0xb05852cf326fc718ULL, 0x0ff23fd5f8ff8636ULL, 0x0955fd90b303b64fULL},
+    {0x1614c658430c7f9cULL, 0x4f3abc39e2f2e775ULL, 0x3821b4894c1c7edbULL, 0x08fdf355a79205f6ULL},
+    {0xa822ac44ac2c36a5ULL, 0x1e4bc45a4a80151dULL, 0x5eea1308557903cbULL, 0x1806de9d3c4464b3ULL},
+    {0x68c80fc2225387e3ULL, 0xf4a3182a97b8ffcfULL, 0x8a7811e7495b8b08ULL, 0x09109de0cfb0bcc0ULL},
+    {0xed9446e3dd94ac84ULL, 0x9f52009c968a66d4ULL, 0xef3174ace0b8cedbULL, 0x2178eeed80c8cbbeULL},
+    {0xf0d29f900436a1b4ULL, 0x5e770757fbbde865ULL, 0x2f06df6298471a25ULL, 0x2c602fd369d4af5eULL},
+    {0x29901b6472d945eaULL, 0xbe6183ed501c7194ULL, 0x7ebd8453d2ccf5deULL, 0x1f164b57fb23bd5dULL},
+    {0x584cc0580f1aae6bULL, 0xb97bc589c8b24c01ULL, 0x8817a215745aceaaULL, 0x2a0af14511da0514ULL},
+    {0xa84fbc92296ad8f9ULL, 0xd02ffc1365376f9dULL, 0x88745ad72f61a4c1ULL, 0x1df02fc3b5e7ca5bULL},
+    {0x1ef0a4310db95eaeULL, 0x2f8ae54fe1fc9f21ULL, 0x56241d9aa90663f2ULL, 0x0a41d819ad0c2311ULL},
+    {0xa1b7003e27a5f6a4ULL, 0x64c9a59a8f627097ULL, 0x04560152fd11d6c9ULL, 0x00e3c595d9740a9fULL},
+    {0x81aa6c7988275882ULL, 0x4a9c8594c04e8fbaULL, 0x746a6c45a04e845fULL, 0x245af3441dfda916ULL},
+    {0x266c3a8b4606f2dbULL, 0xc7211b9adc5b8e21ULL, 0x56709c6330cc7813ULL, 0x0f34d19d35a612c5ULL},
+    {0x3ef0b0f361abd49aULL, 0xdecd5d6f9ddf3cdbULL, 0x35e9b8472779f26fULL, 0x0fc888ec43e70068ULL},
+    {0x8adbd1c65c9ab3a7ULL, 0xb4fcad0d5a0ea043ULL, 0x30f18e8c54596122ULL, 0x0c6ce7a0e82d79dfULL},
+    {0xacf6805cc1c261d4ULL, 0x28ce3e74e17aeee0ULL, 0xad40d563df8e4912ULL, 0x0a4da1ad5bac1765ULL},
+    {0xd1b8c7b4eade8d02ULL, 0x82b4c3118ede2cbeULL, 0x79785bce54913544ULL, 0x136139411cc1a735ULL},
+    {0x3579e52660b99929ULL, 0xcccf785781a24214ULL, 0x50a0073131b96b88ULL, 0x02042ea580749b2bULL},
+    {0x535bf7f9ab060545ULL, 0x411ae6d9637048fdULL, 0x0245c92079c9ddcfULL, 0x1ed2c30e4ece0a61ULL},
+    {0x5a5686393b0e542eULL, 0xdd3ad790f28c214cULL, 0x57e76bcd421c4b43ULL, 0x145eca92fc4d609eULL},
+    {0x285fb83be783c093ULL, 0x903a4089aaf18c6fULL, 0xa1f82d0789e60b64ULL, 0x2f62681ad6040fe5ULL},
+    {0x6724969eaa2469acULL, 0x60fc35dc4722e34fULL, 0x9c6e1ee20180bdd3ULL, 0x21859d2da738b0baULL},
+    {0x547f96cdc11223d7ULL, 0x2ef00793cb54b28bULL, 0x1a801a1c8cb1e108ULL, 0x0f517b4ef5a3f0c6ULL},
+    {0xa2cf05dbaf424ce6ULL, 0xaff26360401a9735ULL, 0x63faddf8b0e57008ULL, 0x09fc19654b04d577ULL},
+    {0xe909efcbc06982f0ULL, 0xabf7de033c74919bULL, 0x2b98aa80dc72c8b0ULL, 0x1c431028f45d9d23ULL},
+    {0xfc4923ae68dbcec3ULL, 0x4ec9d9eb6305a4f0ULL, 0x4d5d208cc98f9852ULL, 0x09b44c4bd01e28e2ULL},
+    {0x35647b1de17e5d52ULL, 0x8f10c5ca362f45c3ULL, 0x5554f42280198a1bULL, 0x22e26ecc997faf29ULL},
+    {0xd7a8985dd88e7c5bULL, 0xd9bf5a384636a4e9ULL, 0x9c3cf8f0938a1590ULL, 0x17beec3a7f334baeULL},
+    {0xcb908ec26bf70134ULL, 0xb6633bbb2e61a94eULL, 0xcb0bb41f12efad6aULL, 0x0792aaec7bd2ecc4ULL},
+    {0xf6014ec11493c5c7ULL, 0xd6eca15a7b89eaebULL, 0x757aa644d81c2a63ULL, 0x150b447c1dae9aa2ULL},
+    {0xf52f8875c441d81eULL, 0xe8023f92ef14f2d5ULL, 0x9c349c27116da6d9ULL, 0x1a8a6bc49615e9c3ULL},
+    {0x1766645d576c34d5ULL, 0x4b5ab5fbc28d1c0aULL, 0x2121d3574c636b46ULL, 0x06444199c2a90e48ULL},
+    {0xeb56e146976654aaULL, 0xb009f8c4d84bc9e2ULL, 0x9998d61fb6398211ULL, 0x25762164bdc10878ULL},
+    {0x1a2889e71f193364ULL, 0xfbce1dbd192071c9ULL, 0x379801ea270f2cbdULL, 0x1be379520f4845c5ULL},
+    {0x6a289aa22aa58c06ULL, 0xfb22d8153d80c772ULL, 0xa34c0b958243f3bcULL, 0x03fd2297b443370fULL},
+    {0xc95986c1f162aeb7ULL, 0x9a95172304da3830ULL, 0x27ddb9b1017c6b5eULL, 0x0014790a68ccebc9ULL},
+    {0xa6e6344b5210405dULL, 0x9eb6e968ddc6896cULL, 0x11d05aceb31a84ffULL, 0x00521feeaa51b593ULL},
+    {0x2662d9626c10860cULL, 0x34e319cc98c23fd6ULL, 0x060796a46aa84cdeULL, 0x07cf207d1a819aabULL},
+    {0x54ce6213c875caf8ULL, 0xe34127d107342c9bULL, 0xf7ef013507054330ULL, 0x07ddc66b8878c3cdULL},
+    {0x73f8c411dd3049e3ULL, 0x3fdcad2dcf7883afULL, 0x24ef7627c1f89700ULL, 0x097bc8564a9bf412ULL},
+    {0x11bf26a3e1a3d005ULL, 0xe7f8a56fd5952a9bULL, 0x96a39785684025adULL, 0x283122641743cbbaULL},
+    {0x5eb1e59ca1730e51ULL, 0xae1bcf740671ce0dULL, 0x7befdac6e889cf07ULL, 0x198c17b444a210b6ULL},
+    {0xc2402aaac26619ffULL, 0x2428780e9389281cULL, 0x1d81f10e6aaeb9ebULL, 0x2f45cf1db3a0b7b4ULL},
+    {0x61f2202e6d867c85ULL, 0x3d396f846776d57cULL, 0x8a0023952577ec40ULL, 0x18e05b7086a5da26ULL},
+    {0x2d30f076d5045dfcULL, 0xe0a34fc7bca4d46bULL, 0x9d64023643c4975aULL, 0x17afc2da63fd2259ULL},
+    {0x756f40e8166c2b3cULL, 0x65b23156b474ff00ULL, 0xf566547b725d0765ULL, 0x0f9c4c8181864d47ULL},
+    {0x404a91341c8759a5ULL, 0xc5b3f33b6c1a113eULL, 0xc5e898daabeffdd1ULL, 0x2f463040a141e0e2ULL},
+    {0x0c1787796add1127ULL, 0x6573025ff3ddc1dfULL, 0x0c20f157ccc6dfe2ULL, 0x06e0e9f45057d4a9ULL},
+    {0x4b61194f9f198543ULL, 0x3d144f585985b3e5ULL, 0xf2907a5c363b78c8ULL, 0x0c3f3c23a2b11d18ULL},
+    {0xd5a2bc8a210e34e2ULL, 0xfa430443586092caULL, 0x065809d922ad88e1ULL, 0x13aed47c71a33703ULL},
+    {0x43e38b1d0cf05758ULL, 0xb51aac27bd623559ULL, 0x935340a6fe5e8184ULL, 0x1792ae414415758cULL},
+    {0xe6fd96e7b2b87101ULL, 0xa9c810bad6739d00ULL, 0xd4e67ffe65bca426ULL, 0x16f18f20ecea3d8aULL},
+    {0xd6bd039c978a59ccULL, 0x587a38333cb1db4aULL, 0x0d2013399e14f217ULL, 0x0890e33d727f8070ULL},
+    {0x5b8496b72c40397dULL, 0x31c67ec24ec0ea52ULL, 0xda3b2ac9af584cbeULL, 0x28f6e8cc4a1e33cbULL},
+    {0xa824fc3d625b9e25ULL, 0x175c20b3bc1d8370ULL, 0xc9cf7cc5c575d75fULL, 0x13f675a2c9a36f0cULL},
+    {0x6397d16efed1d9aaULL, 0x5e9b99bd47de5aa0ULL, 0xceff7464a80b97f9ULL, 0x16165431382600beULL},
+    {0x9757d6e245c41093ULL, 0x5bbed01fd0829413ULL, 0xb1b8073ece9ff9f3ULL, 0x0b89e6f6d20a991dULL},
+    {0x233942f49ee3e607ULL, 0xb756a65bbea89717ULL, 0x07caf8df2cd391ecULL, 0x0e10524c2963e781ULL},
+    {0xb2d7a8f950c7233fULL, 0x8da259b2cecc1373ULL, 0x13dbeab969b72980ULL, 0x1dca3f8e9ba547ccULL},
+    {0x0f5ae53cd3818d07ULL, 0xf9fbff5b14b37369ULL, 0xbacf446d0ecc9070ULL, 0x17b9c9b4b6aa1b1cULL},
+    {0x9fadfc229c2e14e3ULL, 0x2534895e43932154ULL, 0xf34140fb540033a1ULL, 0x1cf64b25e5344231ULL},
+    {0xf73b92a9c0e4b612ULL, 0x3dfba5bc1c3c2e89ULL, 0x3696b65cc6bb9116ULL, 0x218e1630d185fba8ULL},
+    {0x69496a6f37455229ULL, 0x99d25feefcb6c2f7ULL, 0x5cf2fe166f4ad4c4ULL, 0x2c1dfa4eea709cc5ULL},
+    {0xc124c9a4b24bef7fULL, 0xeed23c36fa87277eULL, 0xf985df818e1162d4ULL, 0x073f3f0f8f27bfe1ULL},
+    {0xa8a34329964a656eULL, 0x5d63ef107772fc57ULL, 0x2225c7e080e80208ULL, 0x2b6be511caf79895ULL},
+    {0xe3b1af9c4bd30c68ULL, 0x78fd7c38ee9976fdULL, 0x695020853f333cd9ULL, 0x09f5f229ee4c4dd9ULL},
+};
+
+const uint64_t poseidon_alt_bn128_partial_C_final[6][4] = {
+    {0x27e5740f7d488870ULL, 0xd8e951de8fb091ceULL, 0x6aa2ade70dea6175ULL, 0x0924d37783bcb9ebULL},
+    {0xda860e4682e03d0eULL, 0x2dd9fb617090bc9cULL, 0x33b46efb75ae9b36ULL, 0x19a30e6212f1cdcfULL},
+    {0x7f5e93aa277d0541ULL, 0x0eddfc08c6c4e630ULL, 0xf47d60721b893be0ULL, 0x03e69fcc97ae6d94ULL},
+    {0xc00a269a52ed9e6cULL, 0x81d84d585518468cULL, 0x0e7c9c274bad5069ULL, 0x28ed0ab013b4afa4ULL},
+    {0x788947bbb74077f7ULL, 0x88f636aabb1a64beULL, 0x1ee0c56167bdab86ULL, 0x088eefe19b3b1bb0ULL},
+    {0x7ffb7a8decf9ce6eULL, 0x2ae900cc038b462bULL, 0xb45e643123cf3893ULL, 0x130b0cb3fc882f8dULL},
+};
+
+} // namespace libzeth
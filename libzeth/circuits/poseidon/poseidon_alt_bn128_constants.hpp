@@ -0,0 +1,29 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+// Generated by scripts/generate_poseidon_constants. DO NOT EDIT.
+
+#ifndef __ZETH_CIRCUITS_POSEIDON_ALT_BN128_CONSTANTS_HPP__
+#define __ZETH_CIRCUITS_POSEIDON_ALT_BN128_CONSTANTS_HPP__
+
+#include <cstdint>
+
+namespace libzeth
+{
+
+/// Constants of Poseidon128 (t=6, F=8, P=57) over the alt_bn128
+/// scalar field, as the 64-bit limbs (least significant first) of their
+/// Montgomery form. See PoseidonConstants and PoseidonPartialRoundConstants.
+extern const uint64_t poseidon_alt_bn128_C[65][4];
+extern const uint64_t poseidon_alt_bn128_M[36][4];
+extern const uint64_t poseidon_alt_bn128_partial_M_initial[25][4];
+extern const uint64_t poseidon_alt_bn128_partial_C_sbox[57][4];
+extern const uint64_t poseidon_alt_bn128_partial_M_00[57][4];
+extern const uint64_t poseidon_alt_bn128_partial_M_row[285][4];
+extern const uint64_t poseidon_alt_bn128_partial_M_col[285][4];
+extern const uint64_t poseidon_alt_bn128_partial_C_final[6][4];
+
+} // namespace libzeth
+
+#endif // __ZETH_CIRCUITS_POSEIDON_ALT_BN128_CONSTANTS_HPP__
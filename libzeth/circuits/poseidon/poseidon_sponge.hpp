@@ -0,0 +1,331 @@
+#ifndef __ZETH_CIRCUITS_POSEIDON_SPONGE_HPP_
+#define __ZETH_CIRCUITS_POSEIDON_SPONGE_HPP_
+
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/circuits/poseidon/poseidon.hpp"
+
+namespace libzeth {
+
+/**
+* Native Poseidon permutation of a full state of `t` elements. Computes the
+* same values as Poseidon_permutation_T.
+*/
+template<unsigned param_t, unsigned param_F, unsigned param_P, typename FieldT>
+void poseidon_permute_native(std::vector<FieldT>& state)
+{
+	assert( state.size() == param_t );
+
+	const PoseidonConstants<FieldT>& constants = poseidon_params<param_t, param_F, param_P, FieldT>();
+	std::vector<FieldT> sboxes(param_t);
+
+	const auto full_round = [&constants, &state, &sboxes](unsigned round) {
+		for( unsigned i = 0; i < param_t; i++ )
+		{
+			const FieldT x = state[i] + constants.C[round];
+			const FieldT x2 = x * x;
+			sboxes[i] = x2 * x2 * x;
+		}
+		for( unsigned i = 0; i < param_t; i++ )
+		{
+			FieldT sum = FieldT::zero();
+			for( unsigned j = 0; j < param_t; j++ )
+			{
+				sum += constants.M[i*param_t+j] * sboxes[j];
+			}
+			state[i] = sum;
+		}
+	};
+
+	for( unsigned r = 0; r < param_F/2; r++ )
+	{
+		full_round(r);
+	}
+
+	poseidon_partial_rounds_native<param_t, param_P, FieldT>(
+		poseidon_partial_round_params<param_t, param_F, param_P, FieldT>(), state, nullptr);
+
+	for( unsigned r = param_F/2 + param_P; r < param_F + param_P; r++ )
+	{
+		full_round(r);
+	}
+}
+
+/**
+* Native Poseidon sponge. Computes the same values as Poseidon_sponge_T.
+*/
+template<unsigned param_t, unsigned param_c, unsigned param_F, unsigned param_P, unsigned nOutputs, typename FieldT>
+std::vector<FieldT> poseidon_sponge_native(const std::vector<FieldT>& in_inputs)
+{
+	const unsigned rate = param_t - param_c;
+
+	std::vector<FieldT> state(param_t, FieldT::zero());
+	state[rate] = FieldT(in_inputs.size());
+
+	size_t absorbed = 0;
+	do
+	{
+		for( unsigned j = 0; j < rate && absorbed < in_inputs.size(); j++ )
+		{
+			state[j] += in_inputs[absorbed++];
+		}
+		poseidon_permute_native<param_t, param_F, param_P, FieldT>(state);
+	}
+	while( absorbed < in_inputs.size() );
+
+	return std::vector<FieldT>(state.begin(), state.begin() + nOutputs);
+}
+
+/**
+* The Poseidon permutation of a full state of `t` linear combinations,
+* producing `t` linear combinations (unlike Poseidon_gadget_T, which only
+* ingests `nInputs` elements and produces `nOutputs`).
+*/
+template<unsigned param_t, unsigned param_F, unsigned param_P, typename FieldT>
+class Poseidon_permutation_T : public libsnark::gadget<FieldT>
+{
+protected:
+	typedef Poseidon_Round<param_t, param_t, param_t, param_t, FieldT> FullRoundT;
+	typedef Poseidon_PartialRounds<param_t, param_P, FieldT> PartialRoundsT;
+
+	static constexpr unsigned partial_begin = (param_F/2);
+	static constexpr unsigned partial_end = (partial_begin + param_P);
+	static constexpr unsigned total_rounds = param_F + param_P;
+
+public:
+	const PoseidonConstants<FieldT>& constants;
+
+	std::vector<FullRoundT> prefix_full_rounds;
+	PartialRoundsT partial_rounds;
+	std::vector<FullRoundT> suffix_full_rounds;
+
+	static std::vector<FullRoundT> make_rounds(
+		unsigned n_begin, unsigned n_end,
+        libsnark::protoboard<FieldT>& pb,
+		const std::vector<libsnark::linear_combination<FieldT> >& inputs,
+		const PoseidonConstants<FieldT>& constants,
+		const std::string& annotation_prefix)
+	{
+		std::vector<FullRoundT> result;
+		result.reserve(n_end - n_begin);
+
+		for( unsigned i = n_begin; i < n_end; i++ )
+		{
+			const auto& state = (i == n_begin) ? inputs : result.back().outputs;
+			result.emplace_back(pb, constants.C[i], constants.M, state, ZETH_FMT(annotation_prefix, ".round[%u]", i));
+		}
+
+		return result;
+	}
+
+	Poseidon_permutation_T(
+            libsnark::protoboard<FieldT> &pb,
+		const std::vector<libsnark::linear_combination<FieldT> >& in_state,
+		const std::string& annotation_prefix
+	) :
+        libsnark::gadget<FieldT>(pb, annotation_prefix),
+		constants(poseidon_params<param_t, param_F, param_P, FieldT>()),
+		prefix_full_rounds(
+			make_rounds(
+				0, partial_begin, pb,
+				in_state, constants, annotation_prefix)),
+		partial_rounds(
+			pb, poseidon_partial_round_params<param_t, param_F, param_P, FieldT>(),
+			prefix_full_rounds.back().outputs, partial_begin, annotation_prefix),
+		suffix_full_rounds(
+			make_rounds(
+				partial_end, total_rounds, pb,
+				partial_rounds.outputs, constants, annotation_prefix))
+	{
+		assert( in_state.size() == param_t );
+	}
+
+	const std::vector<libsnark::linear_combination<FieldT> >& outputs() const
+	{
+		return suffix_full_rounds.back().outputs;
+	}
+
+	void generate_r1cs_constraints() const
+	{
+		for( auto& prefix_round : prefix_full_rounds ) {
+			prefix_round.generate_r1cs_constraints();
+		}
+
+		partial_rounds.generate_r1cs_constraints();
+
+		for( auto& suffix_round : suffix_full_rounds ) {
+			suffix_round.generate_r1cs_constraints();
+		}
+	}
+
+	void generate_r1cs_witness() const
+	{
+		for( auto& prefix_round : prefix_full_rounds ) {
+			prefix_round.generate_r1cs_witness();
+		}
+
+		partial_rounds.generate_r1cs_witness();
+
+		for( auto& suffix_round : suffix_full_rounds ) {
+			suffix_round.generate_r1cs_witness();
+		}
+	}
+};
+
+/**
+* Poseidon sponge, absorbing an arbitrary number of inputs:
+*
+*    - the state has a rate of `r = t - c` elements, followed by `c` capacity
+*      elements
+*    - the first capacity element is initialized to the number of inputs,
+*      all other elements to zero. This separates inputs of different
+*      lengths, so the last block is simply padded with zeros
+*    - inputs are added to the rate elements, `r` at a time, each block being
+*      followed by a permutation (at least one permutation is applied, even
+*      with no inputs)
+*    - the `nOutputs` (at most `r`) outputs are the first elements of the
+*      final state
+*
+* Each permutation costs the same as one Poseidon_gadget_T hash, so `n`
+* inputs cost `ceil(n / r)` permutations (1 permutation for up to 5 inputs
+* with Poseidon128), rather than one per pair of inputs when chaining 2-input
+* hashes. poseidon_sponge_native computes the same function natively.
+*/
+template<unsigned param_t, unsigned param_c, unsigned param_F, unsigned param_P, unsigned nOutputs, typename FieldT>
+class Poseidon_sponge_T : public libsnark::gadget<FieldT>
+{
+protected:
+	typedef Poseidon_permutation_T<param_t, param_F, param_P, FieldT> PermutationT;
+
+	static_assert(param_c >= 1 && param_c < param_t, "invalid capacity");
+	static_assert(nOutputs >= 1 && nOutputs <= (param_t - param_c), "outputs must fit in the rate");
+
+public:
+	const std::vector<libsnark::linear_combination<FieldT> > inputs;
+	std::vector<PermutationT> permutations;
+	libsnark::pb_variable_array<FieldT> outputs;
+
+	static std::vector<PermutationT> make_permutations(
+            libsnark::protoboard<FieldT>& pb,
+		const std::vector<libsnark::linear_combination<FieldT> >& in_inputs,
+		const std::string& annotation_prefix)
+	{
+		const unsigned rate = param_t - param_c;
+		const size_t n_blocks = (in_inputs.size() == 0) ? 1 : (in_inputs.size() + rate - 1) / rate;
+
+		std::vector<libsnark::linear_combination<FieldT> > state(param_t);
+		state[rate] = libsnark::linear_combination<FieldT>(FieldT(in_inputs.size()));
+
+		std::vector<PermutationT> result;
+		result.reserve(n_blocks);
+		for( size_t b = 0; b < n_blocks; b++ )
+		{
+			if( b > 0 ) {
+				state = result.back().outputs();
+			}
+
+			for( unsigned j = 0; j < rate && (b * rate + j) < in_inputs.size(); j++ )
+			{
+				state[j] = state[j] + in_inputs[b * rate + j];
+			}
+
+			result.emplace_back(pb, state, ZETH_FMT(annotation_prefix, ".permutation[%zu]", b));
+		}
+
+		return result;
+	}
+
+	static std::vector<libsnark::linear_combination<FieldT> > make_lcs(
+		const libsnark::pb_variable_array<FieldT>& in_inputs)
+	{
+		return std::vector<libsnark::linear_combination<FieldT> >(in_inputs.begin(), in_inputs.end());
+	}
+
+	/**
+	* Absorbs arbitrary linear combinations, e.g. a constant domain separation
+	* tag or a value packed from bits, without allocating a variable for each.
+	*/
+	Poseidon_sponge_T(
+            libsnark::protoboard<FieldT> &pb,
+		const std::vector<libsnark::linear_combination<FieldT> >& in_inputs,
+		const std::string& annotation_prefix
+	) :
+        libsnark::gadget<FieldT>(pb, annotation_prefix),
+		inputs(in_inputs),
+		permutations(make_permutations(pb, in_inputs, annotation_prefix))
+	{
+		outputs.allocate(pb, nOutputs, ZETH_FMT(annotation_prefix, ".output"));
+	}
+
+	Poseidon_sponge_T(
+            libsnark::protoboard<FieldT> &pb,
+		const libsnark::pb_variable_array<FieldT>& in_inputs,
+		const std::string& annotation_prefix
+	) :
+		Poseidon_sponge_T(pb, make_lcs(in_inputs), annotation_prefix)
+	{
+	}
+
+	static std::vector<FieldT> hash(const std::vector<FieldT>& in_values)
+	{
+		return poseidon_sponge_native<param_t, param_c, param_F, param_P, nOutputs, FieldT>(in_values);
+	}
+
+	template<unsigned n = nOutputs>
+	static typename std::enable_if<n == 1, FieldT>::type
+	get_hash(const std::vector<FieldT>& in_values)
+	{
+		return hash(in_values)[0];
+	}
+
+	const libsnark::pb_variable_array<FieldT>& results() const
+	{
+		return outputs;
+	}
+
+	template<unsigned n = nOutputs>
+	typename std::enable_if<n == 1, const libsnark::pb_variable<FieldT>&>::type
+	result() const
+	{
+		return outputs[0];
+	}
+
+	void generate_r1cs_constraints() const
+	{
+		for( const auto& permutation : permutations ) {
+			permutation.generate_r1cs_constraints();
+		}
+
+		const std::vector<libsnark::linear_combination<FieldT> >& final_state = permutations.back().outputs();
+		for( unsigned i = 0; i < nOutputs; i++ )
+		{
+			this->pb.add_r1cs_constraint(
+                    libsnark::r1cs_constraint<FieldT>(final_state[i], ONE, outputs[i]),
+				ZETH_FMT(this->annotation_prefix, ".output[%u] = state[%u]", i, i));
+		}
+	}
+
+	void generate_r1cs_witness() const
+	{
+		for( const auto& permutation : permutations ) {
+			permutation.generate_r1cs_witness();
+		}
+
+		const std::vector<libsnark::linear_combination<FieldT> >& final_state = permutations.back().outputs();
+		for( unsigned i = 0; i < nOutputs; i++ )
+		{
+			this->pb.val(outputs[i]) = lc_val<FieldT>(this->pb, final_state[i]);
+		}
+	}
+};
+
+
+template<unsigned nOutputs, typename FieldT>
+using PoseidonSponge128 = Poseidon_sponge_T<6, 1, 8, 57, nOutputs, FieldT>;
+
+// namespace libzeth
+}
+
+#endif
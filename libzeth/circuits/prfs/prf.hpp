@@ -10,6 +10,8 @@
 // https://github.com/zcash/zcash/blob/master/src/zcash/circuit/prfs.tcc
 
 #include "libzeth/circuits/circuit_utils.hpp"
+#include "libzeth/core/annotations.hpp"
+#include "libzeth/core/arena.hpp"
 
 #include <libsnark/gadgetlib1/gadget.hpp>
 #include <libsnark/gadgetlib1/gadgets/hashes/hash_io.hpp>
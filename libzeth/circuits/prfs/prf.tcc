@@ -7,6 +7,7 @@
 
 #include "libzeth/circuits/prfs/prf.hpp"
 #include "libzeth/core/field_element_utils.hpp"
+#include "libzeth/core/logging.hpp"
 #include "libzeth/core/utils.hpp"
 // DISCLAIMER:
 // Content Taken and adapted from Zcash
@@ -26,10 +27,13 @@ PRF_gadget<FieldT, HashT>::PRF_gadget(
 {
         /*
     block.reset(new libsnark::block_variable<FieldT>(
-        pb, {x, y}, FMT(this->annotation_prefix, " block")));
+        pb, {x, y}, ZETH_FMT(this->annotation_prefix, " block")));
 
     hasher.reset(new HashT(
-        pb, *block, *result, FMT(this->annotation_prefix, " hasher_gadget")));
+        pb,
+        *block,
+        *result,
+        ZETH_FMT(this->annotation_prefix, " hasher_gadget")));
          */
     reverse_x.allocate(pb, 254, "reverse_x");
     reverse_y.allocate(pb, 254, "reverse_y");
@@ -41,13 +45,15 @@ PRF_gadget<FieldT, HashT>::PRF_gadget(
         pb.val(reverse_y[i]) = pb.val(y[254-1-i]);
     }
     this->pb.val(left) = reverse_x.get_field_element_from_bits(pb);
-    std::cout << "left: " << std::endl;
-    this->pb.val(left).print();
+    ZETH_LOG(trace) << "PRF left: " << field_element_to_hex(this->pb.val(left));
     this->pb.val(right) = reverse_y.get_field_element_from_bits(pb);
-    std::cout << "right: " << std::endl;
-    this->pb.val(right).print();
-    hasher.reset(new HashT(
-            pb, left, right, FMT(this->annotation_prefix, " hasher_gadget")));
+    ZETH_LOG(trace) << "PRF right: "
+                    << field_element_to_hex(this->pb.val(right));
+    hasher = arena_make_shared<HashT>(
+            pb,
+            left,
+            right,
+            ZETH_FMT(this->annotation_prefix, " hasher_gadget"));
 }
 
 template<typename FieldT, typename HashT>
@@ -61,7 +67,7 @@ void PRF_gadget<FieldT, HashT>::generate_r1cs_constraints()
     this->pb.val(re) = result->bits.get_field_element_from_bits(this->pb);
     this->pb.add_r1cs_constraint(
             libsnark::r1cs_constraint<FieldT>(1, re, hasher->result()),
-            FMT(this->annotation_prefix, " lhs_rhs_equality_constraint"));
+            ZETH_FMT(this->annotation_prefix, " lhs_rhs_equality_constraint"));
             */
 }
 
@@ -69,9 +75,8 @@ template<typename FieldT, typename HashT>
 void PRF_gadget<FieldT, HashT>::generate_r1cs_witness()
 {
     hasher->generate_r1cs_witness();
-    std::cout << "hash result: " << std::endl;
-    this->pb.val(hasher->result()).print();
-    std::cout << "hex: " << field_element_to_hex(this->pb.val(hasher->result())) << std::endl;
+    ZETH_LOG(trace) << "PRF result: "
+                    << field_element_to_hex(this->pb.val(hasher->result()));
     result->generate_r1cs_witness(libff::bit_vector(
             bits254_to_vector(bits254_from_hex(field_element_to_hex(this->pb.val(hasher->result()))))));
 }
@@ -116,8 +121,9 @@ libsnark::pb_variable_array<FieldT> get_tag_addr(
 
     // Check that we correctly built a 254-bit string
     assert(tagged_a_sk.size() == 254);
-    std::cout << "PRF_addr_a_pk_gadget inputs: " << std::endl;
-    tagged_a_sk.get_field_element_from_bits(pb).print();
+    ZETH_LOG(trace) << "PRF_addr_a_pk_gadget input: "
+                    << field_element_to_hex(
+                           tagged_a_sk.get_field_element_from_bits(pb));
     return tagged_a_sk;
 }
 
@@ -144,8 +150,9 @@ libsnark::pb_variable_array<FieldT> get_tag_nf(
 
     // Check that we correctly built a 254-bit string
     assert(tagged_a_sk.size() == 254);
-    std::cout << "PRF_nf_gadget inputs: " << std::endl;
-    tagged_a_sk.get_field_element_from_bits(pb).print();
+    ZETH_LOG(trace) << "PRF_nf_gadget input: "
+                    << field_element_to_hex(
+                           tagged_a_sk.get_field_element_from_bits(pb));
     return tagged_a_sk;
 }
 
@@ -181,8 +188,9 @@ libsnark::pb_variable_array<FieldT> get_tag_pk(
 
     // Check that we correctly built a 254-bit string
     assert(tagged_a_sk.size() == 254);
-    std::cout << "PRF_pk_gadget inputs: " << std::endl;
-    tagged_a_sk.get_field_element_from_bits(pb).print();
+    ZETH_LOG(trace) << "PRF_pk_gadget input: "
+                    << field_element_to_hex(
+                           tagged_a_sk.get_field_element_from_bits(pb));
     return tagged_a_sk;
 }
 
@@ -216,8 +224,9 @@ libsnark::pb_variable_array<FieldT> get_tag_rho(
 
     // Check that we correctly built a 256-bit string
     assert(tagged_phi.size() == 254);
-    std::cout << "PRF_rho_gadget inputs: " << std::endl;
-    tagged_phi.get_field_element_from_bits(pb).print();
+    ZETH_LOG(trace) << "PRF_rho_gadget input: "
+                    << field_element_to_hex(
+                           tagged_phi.get_field_element_from_bits(pb));
     return tagged_phi;
 }
 
@@ -0,0 +1,138 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CIRCUITS_PRFS_PRF_FIELD_HPP__
+#define __ZETH_CIRCUITS_PRFS_PRF_FIELD_HPP__
+
+#include "libzeth/core/annotations.hpp"
+
+#include <libsnark/gadgetlib1/gadget.hpp>
+
+// Field-native variants of the PRFs of prf.hpp. The keys, inputs and outputs
+// are single field elements (given as linear combinations, so that a value
+// packed from bits can be used directly) rather than 254-bit arrays, so no
+// bits are allocated or reversed and the witness is computed without any
+// conversion through hexadecimal strings.
+//
+// The 4-bit tags of prf.hpp are replaced by a domain separation tag, absorbed
+// as the first input of the hash:
+//
+//   tag = 4 * index + domain
+//
+// where `domain` identifies the PRF (see prf_field_domain) and `index` is the
+// index of the joinsplit input or output (0 for PRF_addr and PRF_nf). The tag
+// is a constant of the circuit, so it costs no constraint.
+//
+// `HashT` must be a sponge-like gadget with a single output (e.g.
+// `PoseidonSponge128<1, FieldT>`), constructible from a vector of linear
+// combinations, and providing `result()` and a static `get_hash` computing
+// the same value natively.
+
+namespace libzeth
+{
+
+enum prf_field_domain : size_t {
+    prf_field_domain_addr = 0,
+    prf_field_domain_nf = 1,
+    prf_field_domain_pk = 2,
+    prf_field_domain_rho = 3,
+};
+
+/// Returns the domain separation tag for the PRF `domain`, and the joinsplit
+/// input or output `index`.
+template<typename FieldT>
+FieldT prf_field_tag(const prf_field_domain domain, const size_t index);
+
+template<typename FieldT, typename HashT>
+class PRF_field_gadget : public libsnark::gadget<FieldT>
+{
+public:
+    // Hash gadget absorbing the tag followed by the inputs
+    HashT hasher;
+
+    PRF_field_gadget(
+        libsnark::protoboard<FieldT> &pb,
+        const FieldT &tag,
+        const std::vector<libsnark::linear_combination<FieldT>> &inputs,
+        const std::string &annotation_prefix = "PRF_field_gadget");
+
+    void generate_r1cs_constraints();
+    void generate_r1cs_witness();
+
+    // Returns the output of the PRF
+    const libsnark::pb_variable<FieldT> &result() const;
+
+    /// Computes the output of the PRF natively
+    static FieldT get_hash(
+        const FieldT &tag, const std::vector<FieldT> &inputs);
+};
+
+// PRF to generate the public addresses
+// a_pk = HashT(tag_addr, a_sk)
+template<typename FieldT, typename HashT>
+class PRF_addr_a_pk_field_gadget : public PRF_field_gadget<FieldT, HashT>
+{
+public:
+    PRF_addr_a_pk_field_gadget(
+        libsnark::protoboard<FieldT> &pb,
+        const libsnark::linear_combination<FieldT> &a_sk,
+        const std::string &annotation_prefix = "PRF_addr_a_pk_field_gadget");
+
+    static FieldT get_hash(const FieldT &a_sk);
+};
+
+// PRF to generate the nullifier
+// nf = HashT(tag_nf, a_sk, rho)
+template<typename FieldT, typename HashT>
+class PRF_nf_field_gadget : public PRF_field_gadget<FieldT, HashT>
+{
+public:
+    PRF_nf_field_gadget(
+        libsnark::protoboard<FieldT> &pb,
+        const libsnark::linear_combination<FieldT> &a_sk,
+        const libsnark::linear_combination<FieldT> &rho,
+        const std::string &annotation_prefix = "PRF_nf_field_gadget");
+
+    static FieldT get_hash(const FieldT &a_sk, const FieldT &rho);
+};
+
+// PRF to generate the h_i
+// h_i = HashT(tag_pk(i), a_sk, h_sig)
+template<typename FieldT, typename HashT>
+class PRF_pk_field_gadget : public PRF_field_gadget<FieldT, HashT>
+{
+public:
+    PRF_pk_field_gadget(
+        libsnark::protoboard<FieldT> &pb,
+        const libsnark::linear_combination<FieldT> &a_sk,
+        const libsnark::linear_combination<FieldT> &h_sig,
+        size_t index,
+        const std::string &annotation_prefix = "PRF_pk_field_gadget");
+
+    static FieldT get_hash(
+        const FieldT &a_sk, const FieldT &h_sig, size_t index);
+};
+
+// PRF to generate rho
+// rho_i = HashT(tag_rho(i), phi, h_sig)
+template<typename FieldT, typename HashT>
+class PRF_rho_field_gadget : public PRF_field_gadget<FieldT, HashT>
+{
+public:
+    PRF_rho_field_gadget(
+        libsnark::protoboard<FieldT> &pb,
+        const libsnark::linear_combination<FieldT> &phi,
+        const libsnark::linear_combination<FieldT> &h_sig,
+        size_t index,
+        const std::string &annotation_prefix = "PRF_rho_field_gadget");
+
+    static FieldT get_hash(
+        const FieldT &phi, const FieldT &h_sig, size_t index);
+};
+
+} // namespace libzeth
+
+#include "libzeth/circuits/prfs/prf_field.tcc"
+
+#endif // __ZETH_CIRCUITS_PRFS_PRF_FIELD_HPP__
@@ -0,0 +1,171 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CIRCUITS_PRFS_PRF_FIELD_TCC__
+#define __ZETH_CIRCUITS_PRFS_PRF_FIELD_TCC__
+
+#include "libzeth/circuits/prfs/prf_field.hpp"
+
+namespace libzeth
+{
+
+template<typename FieldT>
+FieldT prf_field_tag(const prf_field_domain domain, const size_t index)
+{
+    return FieldT(4 * index + domain);
+}
+
+// The tag is absorbed as a constant linear combination, followed by the
+// inputs.
+template<typename FieldT>
+std::vector<libsnark::linear_combination<FieldT>> prf_field_hash_inputs(
+    const FieldT &tag,
+    const std::vector<libsnark::linear_combination<FieldT>> &inputs)
+{
+    std::vector<libsnark::linear_combination<FieldT>> hash_inputs;
+    hash_inputs.reserve(inputs.size() + 1);
+    hash_inputs.emplace_back(tag);
+    hash_inputs.insert(hash_inputs.end(), inputs.begin(), inputs.end());
+    return hash_inputs;
+}
+
+template<typename FieldT, typename HashT>
+PRF_field_gadget<FieldT, HashT>::PRF_field_gadget(
+    libsnark::protoboard<FieldT> &pb,
+    const FieldT &tag,
+    const std::vector<libsnark::linear_combination<FieldT>> &inputs,
+    const std::string &annotation_prefix)
+    : libsnark::gadget<FieldT>(pb, annotation_prefix)
+    , hasher(
+          pb,
+          prf_field_hash_inputs(tag, inputs),
+          ZETH_FMT(this->annotation_prefix, " hasher_gadget"))
+{
+}
+
+template<typename FieldT, typename HashT>
+void PRF_field_gadget<FieldT, HashT>::generate_r1cs_constraints()
+{
+    hasher.generate_r1cs_constraints();
+}
+
+template<typename FieldT, typename HashT>
+void PRF_field_gadget<FieldT, HashT>::generate_r1cs_witness()
+{
+    hasher.generate_r1cs_witness();
+}
+
+template<typename FieldT, typename HashT>
+const libsnark::pb_variable<FieldT> &PRF_field_gadget<FieldT, HashT>::result()
+    const
+{
+    return hasher.result();
+}
+
+template<typename FieldT, typename HashT>
+FieldT PRF_field_gadget<FieldT, HashT>::get_hash(
+    const FieldT &tag, const std::vector<FieldT> &inputs)
+{
+    std::vector<FieldT> hash_inputs;
+    hash_inputs.reserve(inputs.size() + 1);
+    hash_inputs.push_back(tag);
+    hash_inputs.insert(hash_inputs.end(), inputs.begin(), inputs.end());
+    return HashT::get_hash(hash_inputs);
+}
+
+template<typename FieldT, typename HashT>
+PRF_addr_a_pk_field_gadget<FieldT, HashT>::PRF_addr_a_pk_field_gadget(
+    libsnark::protoboard<FieldT> &pb,
+    const libsnark::linear_combination<FieldT> &a_sk,
+    const std::string &annotation_prefix)
+    : PRF_field_gadget<FieldT, HashT>(
+          pb,
+          prf_field_tag<FieldT>(prf_field_domain_addr, 0),
+          {a_sk},
+          annotation_prefix)
+{
+    // Nothing
+}
+
+template<typename FieldT, typename HashT>
+FieldT PRF_addr_a_pk_field_gadget<FieldT, HashT>::get_hash(const FieldT &a_sk)
+{
+    return PRF_field_gadget<FieldT, HashT>::get_hash(
+        prf_field_tag<FieldT>(prf_field_domain_addr, 0), {a_sk});
+}
+
+template<typename FieldT, typename HashT>
+PRF_nf_field_gadget<FieldT, HashT>::PRF_nf_field_gadget(
+    libsnark::protoboard<FieldT> &pb,
+    const libsnark::linear_combination<FieldT> &a_sk,
+    const libsnark::linear_combination<FieldT> &rho,
+    const std::string &annotation_prefix)
+    : PRF_field_gadget<FieldT, HashT>(
+          pb,
+          prf_field_tag<FieldT>(prf_field_domain_nf, 0),
+          {a_sk, rho},
+          annotation_prefix)
+{
+    // Nothing
+}
+
+template<typename FieldT, typename HashT>
+FieldT PRF_nf_field_gadget<FieldT, HashT>::get_hash(
+    const FieldT &a_sk, const FieldT &rho)
+{
+    return PRF_field_gadget<FieldT, HashT>::get_hash(
+        prf_field_tag<FieldT>(prf_field_domain_nf, 0), {a_sk, rho});
+}
+
+template<typename FieldT, typename HashT>
+PRF_pk_field_gadget<FieldT, HashT>::PRF_pk_field_gadget(
+    libsnark::protoboard<FieldT> &pb,
+    const libsnark::linear_combination<FieldT> &a_sk,
+    const libsnark::linear_combination<FieldT> &h_sig,
+    size_t index,
+    const std::string &annotation_prefix)
+    : PRF_field_gadget<FieldT, HashT>(
+          pb,
+          prf_field_tag<FieldT>(prf_field_domain_pk, index),
+          {a_sk, h_sig},
+          annotation_prefix)
+{
+    // Nothing
+}
+
+template<typename FieldT, typename HashT>
+FieldT PRF_pk_field_gadget<FieldT, HashT>::get_hash(
+    const FieldT &a_sk, const FieldT &h_sig, size_t index)
+{
+    return PRF_field_gadget<FieldT, HashT>::get_hash(
+        prf_field_tag<FieldT>(prf_field_domain_pk, index), {a_sk, h_sig});
+}
+
+template<typename FieldT, typename HashT>
+PRF_rho_field_gadget<FieldT, HashT>::PRF_rho_field_gadget(
+    libsnark::protoboard<FieldT> &pb,
+    const libsnark::linear_combination<FieldT> &phi,
+    const libsnark::linear_combination<FieldT> &h_sig,
+    size_t index,
+    const std::string &annotation_prefix)
+    : PRF_field_gadget<FieldT, HashT>(
+          pb,
+          prf_field_tag<FieldT>(prf_field_domain_rho, index),
+          {phi, h_sig},
+          annotation_prefix)
+{
+    // Nothing
+}
+
+template<typename FieldT, typename HashT>
+FieldT PRF_rho_field_gadget<FieldT, HashT>::get_hash(
+    const FieldT &phi, const FieldT &h_sig, size_t index)
+{
+    return PRF_field_gadget<FieldT, HashT>::get_hash(
+        prf_field_tag<FieldT>(prf_field_domain_rho, index), {phi, h_sig});
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CIRCUITS_PRFS_PRF_FIELD_TCC__
@@ -7,6 +7,8 @@
 
 // This gadget implements the interface of the HashT template
 
+#include "libzeth/core/annotations.hpp"
+
 #include <iostream>
 #include <libsnark/gadgetlib1/gadget.hpp>
 #include <libsnark/gadgetlib1/gadgets/basic_gadgets.hpp>
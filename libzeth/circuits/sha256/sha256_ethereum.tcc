@@ -31,7 +31,7 @@ sha256_ethereum<FieldT>::sha256_ethereum(
     : libsnark::gadget<FieldT>(pb, annotation_prefix)
 {
     intermediate_hash.reset(new libsnark::digest_variable<FieldT>(
-        pb, 256, FMT(this->annotation_prefix, " intermediate_hash")));
+        pb, 256, ZETH_FMT(this->annotation_prefix, " intermediate_hash")));
 
     // Padding
     // Equivalent to the lines
@@ -158,7 +158,7 @@ sha256_ethereum<FieldT>::sha256_ethereum(
         IV,                 // previous output - Here the IV
         input_block.bits,   // new block
         *intermediate_hash, // output
-        FMT(this->annotation_prefix, " hasher1_gadget")));
+        ZETH_FMT(this->annotation_prefix, " hasher1_gadget")));
 
     // The intermediate hash obtained as a result of the first hashing round is
     // then used as IV for the second hashing round
@@ -170,7 +170,7 @@ sha256_ethereum<FieldT>::sha256_ethereum(
         IV2,
         length_padding,
         output,
-        FMT(this->annotation_prefix, " hasher2_gadget")));
+        ZETH_FMT(this->annotation_prefix, " hasher2_gadget")));
 }
 
 template<typename FieldT>
@@ -0,0 +1,38 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_ANNOTATIONS_HPP__
+#define __ZETH_CORE_ANNOTATIONS_HPP__
+
+#include <libff/common/utils.hpp>
+#include <string>
+
+/// Annotations of gadget variables and constraints, as formatted by
+/// `ZETH_FMT(prefix, format, ...)`, are only recorded by libsnark in DEBUG
+/// builds. They can also be disabled in DEBUG builds by defining
+/// ZETH_NO_ANNOTATIONS (CMake option `ANNOTATIONS=OFF`). When disabled,
+/// `ZETH_FMT` expands to a constant annotation, without evaluating or
+/// formatting its arguments, and ZETH_ANNOTATIONS is left undefined.
+#if defined(DEBUG) && !defined(ZETH_NO_ANNOTATIONS)
+#define ZETH_ANNOTATIONS 1
+#define ZETH_FMT(...) libff::FORMAT(__VA_ARGS__)
+#else
+#define ZETH_FMT(...) libzeth::no_annotation()
+#endif
+
+namespace libzeth
+{
+
+/// The annotation used when annotations are disabled. It is not empty, since
+/// libsnark asserts that annotations are non-empty in DEBUG builds, and short
+/// enough for copies to not allocate.
+inline const std::string &no_annotation()
+{
+    static const std::string annotation("-");
+    return annotation;
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CORE_ANNOTATIONS_HPP__
@@ -0,0 +1,143 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/arena.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <libff/common/profiling.hpp>
+#include <new>
+#include <stdexcept>
+
+namespace libzeth
+{
+
+namespace
+{
+
+thread_local arena *current_thread_arena = nullptr;
+
+} // namespace
+
+const size_t arena::default_block_size;
+
+arena::arena(size_t block_size)
+    : block_size(block_size)
+    , current_block(0)
+    , current_offset(0)
+    , allocations(0)
+    , allocated_bytes(0)
+{
+    if (block_size == 0) {
+        throw std::invalid_argument("arena block size must be non-zero");
+    }
+}
+
+void *arena::allocate(size_t size, size_t alignment)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::invalid_argument("arena alignment must be a power of 2");
+    }
+
+    ++allocations;
+    allocated_bytes += size;
+
+    // Try the current block, then any block retained from before the last
+    // reset, before allocating a new block from the heap.
+    while (current_block < blocks.size()) {
+        uint8_t *const ptr = allocate_from_block(size, alignment);
+        if (ptr != nullptr) {
+            return ptr;
+        }
+        ++current_block;
+        current_offset = 0;
+    }
+
+    // Allocations larger than the block size get a dedicated block. Extra
+    // space is reserved to satisfy the alignment, since `new[]` only
+    // guarantees the alignment of fundamental types.
+    const size_t new_block_size = std::max(block_size, size + alignment);
+    block b;
+    b.data.reset(new uint8_t[new_block_size]);
+    b.size = new_block_size;
+    blocks.push_back(std::move(b));
+    current_block = blocks.size() - 1;
+    current_offset = 0;
+    return allocate_from_block(size, alignment);
+}
+
+void arena::reset()
+{
+    current_block = 0;
+    current_offset = 0;
+    allocations = 0;
+    allocated_bytes = 0;
+}
+
+size_t arena::num_allocations() const { return allocations; }
+
+size_t arena::bytes_allocated() const { return allocated_bytes; }
+
+size_t arena::capacity() const
+{
+    size_t total = 0;
+    for (const block &b : blocks) {
+        total += b.size;
+    }
+    return total;
+}
+
+size_t arena::num_blocks() const { return blocks.size(); }
+
+void arena::print_statistics() const
+{
+    libff::print_indent();
+    std::cout << "arena allocations: " << allocations << " ("
+              << allocated_bytes << " bytes)" << std::endl;
+    libff::print_indent();
+    std::cout << "arena capacity: " << capacity() << " bytes in "
+              << blocks.size() << " blocks" << std::endl;
+}
+
+uint8_t *arena::allocate_from_block(size_t size, size_t alignment)
+{
+    const block &b = blocks[current_block];
+    const uintptr_t base = reinterpret_cast<uintptr_t>(b.data.get());
+    const uintptr_t aligned =
+        (base + current_offset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    const size_t offset = aligned - base;
+    if (offset > b.size || size > b.size - offset) {
+        return nullptr;
+    }
+
+    current_offset = offset + size;
+    return b.data.get() + offset;
+}
+
+arena &thread_arena()
+{
+    static thread_local arena a;
+    return a;
+}
+
+arena *current_arena() { return current_thread_arena; }
+
+arena_scope::arena_scope(arena &a)
+    : scope_arena(a), previous(current_thread_arena)
+{
+    current_thread_arena = &a;
+}
+
+arena_scope::~arena_scope()
+{
+    current_thread_arena = previous;
+
+    // A nested scope of the same arena leaves it to the outer scope to
+    // release the allocations.
+    if (previous != &scope_arena) {
+        scope_arena.reset();
+    }
+}
+
+} // namespace libzeth
@@ -0,0 +1,136 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_ARENA_HPP__
+#define __ZETH_CORE_ARENA_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <stddef.h>
+#include <vector>
+
+namespace libzeth
+{
+
+/// Monotonic allocator. Memory is taken from large blocks by bumping an
+/// offset, individual deallocations are no-ops, and `reset` releases every
+/// allocation at once in O(1). Blocks are kept across resets, so that an arena
+/// reused for a sequence of proofs stops allocating from the heap once it has
+/// grown to the size of a proof.
+///
+/// Objects allocated from an arena must be destroyed before the arena is
+/// reset. An arena is not thread-safe: use one arena per thread (see
+/// `thread_arena`).
+class arena
+{
+public:
+    static const size_t default_block_size = 1 << 20;
+
+    explicit arena(size_t block_size = default_block_size);
+    arena(const arena &) = delete;
+    arena &operator=(const arena &) = delete;
+
+    void *allocate(size_t size, size_t alignment);
+
+    /// Release all allocations. Blocks are retained for reuse.
+    void reset();
+
+    /// Number of allocations since the last reset
+    size_t num_allocations() const;
+
+    /// Bytes allocated since the last reset (excluding alignment padding)
+    size_t bytes_allocated() const;
+
+    /// Total size of the blocks owned by the arena
+    size_t capacity() const;
+
+    /// Number of blocks allocated from the heap over the arena's lifetime
+    size_t num_blocks() const;
+
+    void print_statistics() const;
+
+private:
+    struct block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+
+    uint8_t *allocate_from_block(size_t size, size_t alignment);
+
+    const size_t block_size;
+
+    std::vector<block> blocks;
+
+    // Block currently used for allocations, and offset of the first free byte
+    // in it.
+    size_t current_block;
+    size_t current_offset;
+
+    size_t allocations;
+    size_t allocated_bytes;
+};
+
+/// Allocator drawing from an `arena`, for use with standard containers and
+/// `std::allocate_shared`. `deallocate` is a no-op.
+template<typename T> class arena_allocator
+{
+public:
+    using value_type = T;
+
+    explicit arena_allocator(arena &a);
+    template<typename U> arena_allocator(const arena_allocator<U> &other);
+
+    T *allocate(size_t n);
+    void deallocate(T *p, size_t n);
+
+    arena &get_arena() const;
+
+private:
+    arena *a;
+};
+
+template<typename T, typename U>
+bool operator==(const arena_allocator<T> &a, const arena_allocator<U> &b);
+
+template<typename T, typename U>
+bool operator!=(const arena_allocator<T> &a, const arena_allocator<U> &b);
+
+/// The arena owned by the calling thread, created on first use. Reusing this
+/// arena for every proof computed by a thread (e.g. a server thread handling
+/// successive requests) avoids growing a new arena for each proof.
+arena &thread_arena();
+
+/// The arena used by `arena_make_shared` on the calling thread, or nullptr if
+/// no `arena_scope` is active.
+arena *current_arena();
+
+/// Makes an arena the current arena of the calling thread for the lifetime of
+/// the scope object. On exit, the previous current arena is restored and the
+/// arena is reset, releasing everything allocated in the scope. All objects
+/// allocated in the scope must therefore be destroyed before the scope object
+/// (i.e. declared after it). Nested scopes of the same arena only reset it
+/// when the outermost scope exits.
+class arena_scope
+{
+public:
+    explicit arena_scope(arena &a);
+    arena_scope(const arena_scope &) = delete;
+    arena_scope &operator=(const arena_scope &) = delete;
+    ~arena_scope();
+
+private:
+    arena &scope_arena;
+    arena *previous;
+};
+
+/// Equivalent to `std::make_shared<T>(args...)`, with the object and its
+/// control block allocated from the current arena, if any.
+template<typename T, typename... Args>
+std::shared_ptr<T> arena_make_shared(Args &&... args);
+
+} // namespace libzeth
+
+#include "libzeth/core/arena.tcc"
+
+#endif // __ZETH_CORE_ARENA_HPP__
@@ -0,0 +1,74 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_ARENA_TCC__
+#define __ZETH_CORE_ARENA_TCC__
+
+#include "libzeth/core/arena.hpp"
+
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace libzeth
+{
+
+template<typename T>
+arena_allocator<T>::arena_allocator(arena &a) : a(&a)
+{
+}
+
+template<typename T>
+template<typename U>
+arena_allocator<T>::arena_allocator(const arena_allocator<U> &other)
+    : a(&other.get_arena())
+{
+}
+
+template<typename T> T *arena_allocator<T>::allocate(size_t n)
+{
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+        throw std::bad_alloc();
+    }
+    return static_cast<T *>(a->allocate(n * sizeof(T), alignof(T)));
+}
+
+template<typename T> void arena_allocator<T>::deallocate(T *p, size_t n)
+{
+    // Memory is released when the arena is reset
+    (void)p;
+    (void)n;
+}
+
+template<typename T> arena &arena_allocator<T>::get_arena() const
+{
+    return *a;
+}
+
+template<typename T, typename U>
+bool operator==(const arena_allocator<T> &a, const arena_allocator<U> &b)
+{
+    return &a.get_arena() == &b.get_arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const arena_allocator<T> &a, const arena_allocator<U> &b)
+{
+    return &a.get_arena() != &b.get_arena();
+}
+
+template<typename T, typename... Args>
+std::shared_ptr<T> arena_make_shared(Args &&... args)
+{
+    arena *const a = current_arena();
+    if (a == nullptr) {
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+    return std::allocate_shared<T>(
+        arena_allocator<T>(*a), std::forward<Args>(args)...);
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CORE_ARENA_TCC__
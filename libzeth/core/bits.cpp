@@ -29,7 +29,7 @@ bits64 bits64_from_hex(const std::string &str)
             "16)");
     }
 
-    return bits64_from_vector(bit_vector_from_hex(str));
+    return packed_bits<64>::from_hex(str).to_array();
 }
 
 std::vector<bool> bits64_to_vector(const bits64 &arr)
@@ -51,7 +51,7 @@ bits128 bits128_from_hex(const std::string &str)
                 "32)");
     }
 
-    return bits128_from_vector(bit_vector_from_hex(str));
+    return packed_bits<128>::from_hex(str).to_array();
 }
 
 std::vector<bool> bits128_to_vector(const bits128 &arr)
@@ -67,7 +67,7 @@ bits254 bits254_from_vector(const std::vector<bool> &vect)
 
 bits254 bits254_from_hex(const std::string &str)
 {
-    return bits254_from_vector(bit_vector_254_from_hex(str));
+    return packed_bits<254>::from_hex(str).to_array();
 }
 
 std::vector<bool> bits254_to_vector(const bits254 &arr)
@@ -89,7 +89,7 @@ bits256 bits256_from_hex(const std::string &str)
             "64)");
     }
 
-    return bits256_from_vector(bit_vector_from_hex(str));
+    return packed_bits<256>::from_hex(str).to_array();
 }
 
 std::vector<bool> bits256_to_vector(const bits256 &arr)
@@ -111,7 +111,7 @@ bits384 bits384_from_hex(const std::string &str)
             "96)");
     }
 
-    return bits384_from_vector(bit_vector_from_hex(str));
+    return packed_bits<384>::from_hex(str).to_array();
 }
 
 std::vector<bool> bits384_to_vector(const bits384 &arr)
@@ -6,6 +6,7 @@
 #define __ZETH_CORE_BITS_TCC__
 
 #include "libzeth/core/bits.hpp"
+#include "libzeth/core/packed_bits.hpp"
 
 namespace libzeth
 {
@@ -70,14 +71,9 @@ template<size_t BitLen>
 std::array<bool, BitLen> bits_xor(
     const std::array<bool, BitLen> &a, const std::array<bool, BitLen> &b)
 {
-    std::array<bool, BitLen> xor_array;
-    xor_array.fill(0);
-
-    for (int i = BitLen - 1; i >= 0; i--) {
-        xor_array[i] = a[i] != b[i];
-    }
-
-    return xor_array;
+    return (packed_bits<BitLen>::from_array(a) ^
+            packed_bits<BitLen>::from_array(b))
+        .to_array();
 }
 
 template<size_t BitLen>
@@ -86,23 +82,11 @@ std::array<bool, BitLen> bits_add(
     const std::array<bool, BitLen> &b,
     bool with_carry)
 {
-    std::array<bool, BitLen> sum;
-    sum.fill(0);
-
-    bool carry = 0;
-    for (int i = BitLen - 1; i >= 0; i--) {
-        sum[i] = ((a[i] ^ b[i]) ^ carry);
-        carry = ((a[i] & b[i]) | (a[i] & carry)) | (b[i] & carry);
-    }
-
     // If we ask for the last carry to be taken into account (with_carry=true)
-    // and that the last carry is 1, then we raise an overflow error
-    if (with_carry && carry) {
-        throw std::overflow_error("Overflow: The sum of the binary addition "
-                                  "cannot be encoded on <BitLen> bits");
-    }
-
-    return sum;
+    // and that the last carry is 1, then an overflow error is raised
+    return packed_bits<BitLen>::from_array(a)
+        .add(packed_bits<BitLen>::from_array(b), with_carry)
+        .to_array();
 }
 
 } // namespace libzeth
@@ -25,6 +25,13 @@ namespace libzeth
 template<typename FieldT>
 std::string bigint_to_hex(const libff::bigint<FieldT::num_limbs> &limbs);
 
+/// Write the `2 * sizeof(limbs.data)` characters of `bigint_to_hex` to `dest`,
+/// without allocating (no null character is written). The same assumptions
+/// as `bigint_to_hex` apply.
+template<typename FieldT>
+void bigint_write_hex(
+    const libff::bigint<FieldT::num_limbs> &limbs, char *dest);
+
 /// WARNING: The following function assumes that the platform is little-endian
 /// and that NAILS are NOT used. See Section 8.2 (page 68):
 /// https://gmplib.org/gmp-man-6.2.0.pdf
@@ -42,6 +49,11 @@ libff::bigint<FieldT::num_limbs> bigint_from_hex(const std::string &hex);
 template<typename FieldT>
 std::string field_element_to_hex(const FieldT &field_el);
 
+/// Convert a field element to an hexadecimal string with a `0x` prefix, as
+/// used in the protobuf messages
+template<typename FieldT>
+std::string field_element_to_prefixed_hex(const FieldT &field_el);
+
 /// Convert an hexadecimal string to a field element
 template<typename FieldT>
 FieldT field_element_from_hex(const std::string &field_str);
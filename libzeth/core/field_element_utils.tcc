@@ -6,6 +6,7 @@
 #define __ZETH_FIELD_ELEMENT_UTILS_TCC__
 
 #include "libzeth/core/field_element_utils.hpp"
+#include "libzeth/core/hex_codec.hpp"
 #include "libzeth/core/utils.hpp"
 
 #include <iomanip>
@@ -25,6 +26,13 @@ std::string bigint_to_hex(const libff::bigint<FieldT::num_limbs> &limbs)
     return bytes_to_hex_reversed(&limbs.data[0], sizeof(limbs.data));
 }
 
+template<typename FieldT>
+void bigint_write_hex(const libff::bigint<FieldT::num_limbs> &limbs, char *dest)
+{
+    hex_encode_reversed(
+        (const uint8_t *)&limbs.data[0], sizeof(limbs.data), dest);
+}
+
 template<typename FieldT>
 libff::bigint<FieldT::num_limbs> bigint_from_hex(const std::string &hex)
 {
@@ -39,6 +47,16 @@ std::string field_element_to_hex(const FieldT &field_el)
     return bigint_to_hex<FieldT>(field_el.as_bigint());
 }
 
+template<typename FieldT>
+std::string field_element_to_prefixed_hex(const FieldT &field_el)
+{
+    const libff::bigint<FieldT::num_limbs> limbs = field_el.as_bigint();
+    std::string hex(2 + 2 * sizeof(limbs.data), '0');
+    hex[1] = 'x';
+    bigint_write_hex<FieldT>(limbs, &hex[2]);
+    return hex;
+}
+
 template<typename FieldT> FieldT field_element_from_hex(const std::string &hex)
 {
     return FieldT(bigint_from_hex<FieldT>(hex));
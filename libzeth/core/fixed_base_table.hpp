@@ -0,0 +1,59 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_FIXED_BASE_TABLE_HPP__
+#define __ZETH_CORE_FIXED_BASE_TABLE_HPP__
+
+#include "libzeth/core/include_libff.hpp"
+
+#include <libff/algebra/scalar_multiplication/multiexp.hpp>
+#include <vector>
+
+namespace libzeth
+{
+
+/// Window size used for the process-wide generator tables below.
+const size_t GENERATOR_TABLE_WINDOW_SIZE = 10;
+
+/// Fixed-base window table, for multiplying a single group element by many
+/// scalars. The table layout is that of libff::window_table, but rows are
+/// computed in parallel. Multiplication by a scalar costs one group addition
+/// per window.
+template<typename GroupT, typename FieldT> class fixed_base_table
+{
+private:
+    size_t window_size;
+    libff::window_table<GroupT> table;
+
+public:
+    fixed_base_table(const GroupT &base, size_t window_size);
+
+    /// Compute scalar * base
+    GroupT multiply(const FieldT &scalar) const;
+
+    /// Compute { scalars[i] * base } for i = 0 .. num_entries-1, in
+    /// parallel.
+    std::vector<GroupT> batch_multiply(
+        const std::vector<FieldT> &scalars, size_t num_entries) const;
+
+    /// Compute { scalars[i] * base } for all entries of scalars, in parallel.
+    std::vector<GroupT> batch_multiply(
+        const std::vector<FieldT> &scalars) const;
+};
+
+/// Table for the G1 generator, built (once per process) on first use. Must
+/// not be called before ppT::init_public_params().
+template<typename ppT>
+const fixed_base_table<libff::G1<ppT>, libff::Fr<ppT>> &g1_generator_table();
+
+/// Table for the G2 generator, built (once per process) on first use. Must
+/// not be called before ppT::init_public_params().
+template<typename ppT>
+const fixed_base_table<libff::G2<ppT>, libff::Fr<ppT>> &g2_generator_table();
+
+} // namespace libzeth
+
+#include "libzeth/core/fixed_base_table.tcc"
+
+#endif // __ZETH_CORE_FIXED_BASE_TABLE_HPP__
@@ -0,0 +1,108 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_FIXED_BASE_TABLE_TCC__
+#define __ZETH_CORE_FIXED_BASE_TABLE_TCC__
+
+#include "libzeth/core/fixed_base_table.hpp"
+
+namespace libzeth
+{
+
+template<typename GroupT, typename FieldT>
+fixed_base_table<GroupT, FieldT>::fixed_base_table(
+    const GroupT &base, size_t window_size)
+    : window_size(window_size), table()
+{
+    // Row i holds { j * 2^(i * window_size) * base }, for j = 0 .. 2^w - 1
+    // (as in libff::get_window_table, the final row may be shorter). The base
+    // of each row is computed sequentially by doubling, and the rows are then
+    // filled in parallel.
+    const size_t scalar_size = FieldT::size_in_bits();
+    const size_t num_rows = (scalar_size + window_size - 1) / window_size;
+    const size_t row_size = 1ul << window_size;
+    const size_t last_row_size =
+        1ul << (scalar_size - (num_rows - 1) * window_size);
+
+    std::vector<GroupT> row_bases(num_rows);
+    GroupT row_base = base;
+    for (size_t i = 0; i < num_rows; ++i) {
+        row_bases[i] = row_base;
+        for (size_t j = 0; j < window_size; ++j) {
+            row_base = row_base.dbl();
+        }
+    }
+
+    table.reserve(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        const size_t num_entries =
+            (i == num_rows - 1) ? last_row_size : row_size;
+        table.emplace_back(num_entries, GroupT::zero());
+    }
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < num_rows; ++i) {
+        std::vector<GroupT> &row = table[i];
+        GroupT entry = GroupT::zero();
+        for (size_t j = 0; j < row.size(); ++j) {
+            row[j] = entry;
+            entry = entry + row_bases[i];
+        }
+    }
+}
+
+template<typename GroupT, typename FieldT>
+GroupT fixed_base_table<GroupT, FieldT>::multiply(const FieldT &scalar) const
+{
+    return libff::windowed_exp(
+        FieldT::size_in_bits(), window_size, table, scalar);
+}
+
+template<typename GroupT, typename FieldT>
+std::vector<GroupT> fixed_base_table<GroupT, FieldT>::batch_multiply(
+    const std::vector<FieldT> &scalars, size_t num_entries) const
+{
+    if (num_entries > scalars.size()) {
+        throw std::invalid_argument("not enough scalars");
+    }
+
+    std::vector<GroupT> results(num_entries);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < num_entries; ++i) {
+        results[i] = multiply(scalars[i]);
+    }
+
+    return results;
+}
+
+template<typename GroupT, typename FieldT>
+std::vector<GroupT> fixed_base_table<GroupT, FieldT>::batch_multiply(
+    const std::vector<FieldT> &scalars) const
+{
+    return batch_multiply(scalars, scalars.size());
+}
+
+template<typename ppT>
+const fixed_base_table<libff::G1<ppT>, libff::Fr<ppT>> &g1_generator_table()
+{
+    static const fixed_base_table<libff::G1<ppT>, libff::Fr<ppT>> table(
+        libff::G1<ppT>::one(), GENERATOR_TABLE_WINDOW_SIZE);
+    return table;
+}
+
+template<typename ppT>
+const fixed_base_table<libff::G2<ppT>, libff::Fr<ppT>> &g2_generator_table()
+{
+    static const fixed_base_table<libff::G2<ppT>, libff::Fr<ppT>> table(
+        libff::G2<ppT>::one(), GENERATOR_TABLE_WINDOW_SIZE);
+    return table;
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CORE_FIXED_BASE_TABLE_TCC__
@@ -0,0 +1,271 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/hex_codec.hpp"
+
+#include <algorithm>
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
+namespace libzeth
+{
+
+namespace
+{
+
+const char hex_digits[] = "0123456789abcdef";
+
+// Nibble value of each character, or 0xff for non-hex characters
+struct nibble_table {
+    uint8_t values[256];
+
+    nibble_table()
+    {
+        std::fill(values, values + 256, 0xff);
+        for (uint8_t i = 0; i < 10; ++i) {
+            values['0' + i] = i;
+        }
+        for (uint8_t i = 0; i < 6; ++i) {
+            values['a' + i] = 10 + i;
+            values['A' + i] = 10 + i;
+        }
+    }
+};
+
+const nibble_table &get_nibble_table()
+{
+    static const nibble_table table;
+    return table;
+}
+
+// Scalar decoding. Invalid characters set the high bits of the returned
+// accumulator.
+uint8_t hex_decode_scalar(const char *hex, size_t num_bytes, uint8_t *dest)
+{
+    const uint8_t *const values = get_nibble_table().values;
+    uint8_t invalid = 0;
+    for (size_t i = 0; i < num_bytes; ++i) {
+        const uint8_t hi = values[(uint8_t)hex[2 * i]];
+        const uint8_t lo = values[(uint8_t)hex[2 * i + 1]];
+        invalid |= hi | lo;
+        dest[i] = (uint8_t)((hi << 4) | (lo & 0x0f));
+    }
+    return invalid & 0xf0;
+}
+
+void hex_encode_scalar(const uint8_t *src, size_t num_bytes, char *hex)
+{
+    for (size_t i = 0; i < num_bytes; ++i) {
+        hex[2 * i] = hex_digits[src[i] >> 4];
+        hex[2 * i + 1] = hex_digits[src[i] & 0x0f];
+    }
+}
+
+#if defined(__AVX2__)
+
+const size_t block_bytes = 32;
+
+// Converts 32 characters to nibble values, accumulating invalid characters in
+// `invalid`.
+inline __m256i chars_to_nibbles(const __m256i chars, __m256i &invalid)
+{
+    const __m256i digits = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    const __m256i letters = _mm256_sub_epi8(
+        _mm256_or_si256(chars, _mm256_set1_epi8(0x20)),
+        _mm256_set1_epi8('a'));
+
+    // Unsigned comparisons: x <= max iff min(x, max) == x
+    const __m256i is_digit = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+    const __m256i is_letter = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(letters, _mm256_set1_epi8(5)), letters);
+
+    invalid = _mm256_or_si256(
+        invalid,
+        _mm256_andnot_si256(
+            _mm256_or_si256(is_digit, is_letter), _mm256_set1_epi8(-1)));
+    return _mm256_blendv_epi8(
+        _mm256_add_epi8(letters, _mm256_set1_epi8(10)), digits, is_digit);
+}
+
+// Decodes 64 characters into 32 bytes
+inline void decode_block(const char *hex, uint8_t *dest, __m256i &invalid)
+{
+    // Pairs of nibbles (hi, lo) are combined into 16-bit words hi * 16 + lo
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    const __m256i words_0 = _mm256_maddubs_epi16(
+        chars_to_nibbles(_mm256_loadu_si256((const __m256i *)hex), invalid),
+        weights);
+    const __m256i words_1 = _mm256_maddubs_epi16(
+        chars_to_nibbles(
+            _mm256_loadu_si256((const __m256i *)(hex + 32)), invalid),
+        weights);
+
+    // Packing operates on each 128-bit lane, giving the 8-byte groups in the
+    // order 0, 2, 1, 3.
+    const __m256i bytes = _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(words_0, words_1), _MM_SHUFFLE(3, 1, 2, 0));
+    _mm256_storeu_si256((__m256i *)dest, bytes);
+}
+
+// Encodes 32 bytes into 64 characters
+inline void encode_block(const uint8_t *src, char *hex)
+{
+    const __m256i table = _mm256_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd',
+        'e', 'f', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b',
+        'c', 'd', 'e', 'f');
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+
+    const __m256i bytes = _mm256_loadu_si256((const __m256i *)src);
+    const __m256i hi = _mm256_shuffle_epi8(
+        table, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+    const __m256i lo =
+        _mm256_shuffle_epi8(table, _mm256_and_si256(bytes, mask));
+
+    // Interleaving operates on each 128-bit lane: `chars_lo` holds bytes 0-7
+    // and 16-23, `chars_hi` holds bytes 8-15 and 24-31.
+    const __m256i chars_lo = _mm256_unpacklo_epi8(hi, lo);
+    const __m256i chars_hi = _mm256_unpackhi_epi8(hi, lo);
+    _mm256_storeu_si256(
+        (__m256i *)hex, _mm256_permute2x128_si256(chars_lo, chars_hi, 0x20));
+    _mm256_storeu_si256(
+        (__m256i *)(hex + 32),
+        _mm256_permute2x128_si256(chars_lo, chars_hi, 0x31));
+}
+
+inline bool any_invalid(const __m256i invalid)
+{
+    return !_mm256_testz_si256(invalid, invalid);
+}
+
+inline __m256i no_invalid() { return _mm256_setzero_si256(); }
+
+using invalid_t = __m256i;
+
+#elif defined(__SSSE3__)
+
+const size_t block_bytes = 16;
+
+// Converts 16 characters to nibble values, accumulating invalid characters in
+// `invalid`.
+inline __m128i chars_to_nibbles(const __m128i chars, __m128i &invalid)
+{
+    const __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    const __m128i letters = _mm_sub_epi8(
+        _mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+    // Unsigned comparisons: x <= max iff min(x, max) == x
+    const __m128i is_digit =
+        _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+    const __m128i is_letter =
+        _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+
+    invalid = _mm_or_si128(
+        invalid,
+        _mm_andnot_si128(_mm_or_si128(is_digit, is_letter), _mm_set1_epi8(-1)));
+
+    // Select the digit or letter value (SSSE3 has no blendv)
+    const __m128i letter_values = _mm_add_epi8(letters, _mm_set1_epi8(10));
+    return _mm_or_si128(
+        _mm_and_si128(is_digit, digits),
+        _mm_andnot_si128(is_digit, letter_values));
+}
+
+// Decodes 32 characters into 16 bytes
+inline void decode_block(const char *hex, uint8_t *dest, __m128i &invalid)
+{
+    // Pairs of nibbles (hi, lo) are combined into 16-bit words hi * 16 + lo
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    const __m128i words_0 = _mm_maddubs_epi16(
+        chars_to_nibbles(_mm_loadu_si128((const __m128i *)hex), invalid),
+        weights);
+    const __m128i words_1 = _mm_maddubs_epi16(
+        chars_to_nibbles(_mm_loadu_si128((const __m128i *)(hex + 16)), invalid),
+        weights);
+    _mm_storeu_si128((__m128i *)dest, _mm_packus_epi16(words_0, words_1));
+}
+
+// Encodes 16 bytes into 32 characters
+inline void encode_block(const uint8_t *src, char *hex)
+{
+    const __m128i table = _mm_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd',
+        'e', 'f');
+    const __m128i mask = _mm_set1_epi8(0x0f);
+
+    const __m128i bytes = _mm_loadu_si128((const __m128i *)src);
+    const __m128i hi =
+        _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+    const __m128i lo = _mm_shuffle_epi8(table, _mm_and_si128(bytes, mask));
+    _mm_storeu_si128((__m128i *)hex, _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i *)(hex + 16), _mm_unpackhi_epi8(hi, lo));
+}
+
+inline bool any_invalid(const __m128i invalid)
+{
+    return _mm_movemask_epi8(invalid) != 0;
+}
+
+inline __m128i no_invalid() { return _mm_setzero_si128(); }
+
+using invalid_t = __m128i;
+
+#endif
+
+} // namespace
+
+bool hex_decode(const char *hex, size_t num_bytes, uint8_t *dest)
+{
+    size_t i = 0;
+#if defined(__AVX2__) || defined(__SSSE3__)
+    invalid_t invalid_blocks = no_invalid();
+    for (; i + block_bytes <= num_bytes; i += block_bytes) {
+        decode_block(hex + 2 * i, dest + i, invalid_blocks);
+    }
+    if (any_invalid(invalid_blocks)) {
+        return false;
+    }
+#endif
+
+    return hex_decode_scalar(hex + 2 * i, num_bytes - i, dest + i) == 0;
+}
+
+bool hex_decode_reversed(const char *hex, size_t num_bytes, uint8_t *dest)
+{
+    const bool valid = hex_decode(hex, num_bytes, dest);
+    std::reverse(dest, dest + num_bytes);
+    return valid;
+}
+
+void hex_encode(const uint8_t *src, size_t num_bytes, char *hex)
+{
+    size_t i = 0;
+#if defined(__AVX2__) || defined(__SSSE3__)
+    for (; i + block_bytes <= num_bytes; i += block_bytes) {
+        encode_block(src + i, hex + 2 * i);
+    }
+#endif
+
+    hex_encode_scalar(src + i, num_bytes - i, hex + 2 * i);
+}
+
+void hex_encode_reversed(const uint8_t *src, size_t num_bytes, char *hex)
+{
+    // Reverse blocks of the source into a local buffer, starting from the
+    // highest address, and encode them in order.
+    uint8_t block[64];
+    size_t done = 0;
+    while (done < num_bytes) {
+        const size_t size = std::min(sizeof(block), num_bytes - done);
+        const uint8_t *const block_end = src + num_bytes - done;
+        std::reverse_copy(block_end - size, block_end, block);
+        hex_encode(block, size, hex + 2 * done);
+        done += size;
+    }
+}
+
+} // namespace libzeth
@@ -0,0 +1,43 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_HEX_CODEC_HPP__
+#define __ZETH_CORE_HEX_CODEC_HPP__
+
+#include <cstdint>
+#include <stddef.h>
+
+/// Hexadecimal encoding and decoding into caller-provided buffers, without
+/// any allocation. Blocks of 32 bytes (AVX2) or 16 bytes (SSSE3) are
+/// processed with vector instructions when the compiler targets them (e.g.
+/// with `-march=native`), and the remaining bytes with a scalar
+/// implementation. Invalid characters are detected in bulk: decoding does not
+/// stop at the first invalid character, but reports the failure once the
+/// whole string has been processed.
+
+namespace libzeth
+{
+
+/// Decode the `2 * num_bytes` hex characters at `hex` (upper or lower case,
+/// no prefix) into `num_bytes` bytes at `dest` (first characters at the
+/// lowest address). Returns false if any character is not a hex digit, in
+/// which case the content of `dest` is unspecified.
+bool hex_decode(const char *hex, size_t num_bytes, uint8_t *dest);
+
+/// As `hex_decode`, but the first characters are written to the highest
+/// address (for little-endian numbers, etc).
+bool hex_decode_reversed(const char *hex, size_t num_bytes, uint8_t *dest);
+
+/// Encode `num_bytes` bytes at `src` as `2 * num_bytes` lower case hex
+/// characters at `hex` (lowest address first). No terminating null character
+/// is written.
+void hex_encode(const uint8_t *src, size_t num_bytes, char *hex);
+
+/// As `hex_encode`, but the byte at the highest address is encoded first (for
+/// little-endian numbers, etc).
+void hex_encode_reversed(const uint8_t *src, size_t num_bytes, char *hex);
+
+} // namespace libzeth
+
+#endif // __ZETH_CORE_HEX_CODEC_HPP__
@@ -0,0 +1,298 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/logging.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace libzeth
+{
+
+std::atomic<int> log_threshold((int)log_level::info);
+
+namespace
+{
+
+const char *const level_names[] = {
+    "TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "OFF"};
+
+// A formatted record, or a marker pushed by `log_writer::flush`, as a node of
+// the writer's queue.
+struct log_line {
+    std::atomic<log_line *> next;
+    std::string text;
+    // For markers, set (under the writer's `flush_mutex`) once all earlier
+    // records have been written.
+    bool *flushed;
+
+    log_line(std::string &&text, bool *flushed)
+        : next(nullptr), text(std::move(text)), flushed(flushed)
+    {
+    }
+};
+
+// Writes the records from all threads to the output stream. Records are
+// passed through an intrusive multi-producer single-consumer queue: pushing a
+// record is a single atomic exchange, so that threads creating records never
+// wait for each other, or for the writer. The mutex used to wake the writer
+// is only taken if the writer is (about to be) blocked.
+class log_writer
+{
+public:
+    log_writer()
+        : stub(std::string(), nullptr)
+        , head(&stub)
+        , tail(&stub)
+        , output(&std::cout)
+        , writer_waiting(false)
+    {
+        std::thread(&log_writer::run, this).detach();
+    }
+
+    void push(std::string &&text)
+    {
+        push_line(new log_line(std::move(text), nullptr));
+    }
+
+    void set_output(std::ostream &out)
+    {
+        flush();
+        output.store(&out, std::memory_order_release);
+    }
+
+    void flush()
+    {
+        // Records are written in order, so once the marker is reached, all
+        // records pushed before it have been written.
+        bool flushed = false;
+        push_line(new log_line(std::string(), &flushed));
+        std::unique_lock<std::mutex> lock(flush_mutex);
+        flush_done.wait(lock, [&flushed]() { return flushed; });
+    }
+
+private:
+    void push_line(log_line *const line)
+    {
+        // The exchange, the store to `next` and the load of `writer_waiting`
+        // are sequentially consistent, and pair with the store to
+        // `writer_waiting` and the load of `next` in `wait_for_lines`: either
+        // the writer sees the new line before blocking, or this thread sees
+        // that the writer may be blocked, and wakes it.
+        log_line *const prev = head.exchange(line);
+        prev->next.store(line);
+        if (writer_waiting.load()) {
+            std::lock_guard<std::mutex> lock(wake_mutex);
+            wake.notify_one();
+        }
+    }
+
+    // Only called by the writer thread
+    bool pop(std::string &text, bool *&flushed)
+    {
+        log_line *const first = tail;
+        log_line *const next = first->next.load();
+        if (next == nullptr) {
+            return false;
+        }
+
+        // `next` becomes the new (already consumed) tail of the queue
+        text = std::move(next->text);
+        flushed = next->flushed;
+        tail = next;
+        if (first != &stub) {
+            delete first;
+        }
+        return true;
+    }
+
+    // Only called by the writer thread. Blocks until the queue is not empty.
+    void wait_for_lines()
+    {
+        std::unique_lock<std::mutex> lock(wake_mutex);
+        writer_waiting.store(true);
+        wake.wait(lock, [this]() { return tail->next.load() != nullptr; });
+        writer_waiting.store(false);
+    }
+
+    void run()
+    {
+        std::string text;
+        bool *flushed;
+        for (;;) {
+            std::ostream *out = nullptr;
+            while (pop(text, flushed)) {
+                if (flushed == nullptr) {
+                    out = output.load(std::memory_order_acquire);
+                    *out << text << '\n';
+                    continue;
+                }
+
+                if (out != nullptr) {
+                    out->flush();
+                    out = nullptr;
+                }
+                std::lock_guard<std::mutex> lock(flush_mutex);
+                *flushed = true;
+                flush_done.notify_all();
+            }
+            if (out != nullptr) {
+                out->flush();
+            }
+
+            wait_for_lines();
+        }
+    }
+
+    log_line stub;
+    std::atomic<log_line *> head;
+    log_line *tail;
+
+    std::atomic<std::ostream *> output;
+
+    std::atomic<bool> writer_waiting;
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+
+    std::mutex flush_mutex;
+    std::condition_variable flush_done;
+};
+
+void flush_at_exit() { log_flush(); }
+
+log_writer &get_writer()
+{
+    // Never destroyed, so that records can be created during the destruction
+    // of static objects. Pending records are written at exit.
+    static log_writer *const writer = []() {
+        log_writer *const w = new log_writer();
+        std::atexit(flush_at_exit);
+        return w;
+    }();
+    return *writer;
+}
+
+unsigned get_thread_index()
+{
+    static std::atomic<unsigned> next_index(0);
+    static thread_local const unsigned index = next_index.fetch_add(1);
+    return index;
+}
+
+// The buffer of the calling thread, and whether it is used by a record
+thread_local std::ostringstream thread_buffer;
+thread_local bool thread_buffer_in_use = false;
+
+// Formatting state of a new stream, restored before reusing a buffer
+const std::ostringstream &default_format()
+{
+    static const std::ostringstream format;
+    return format;
+}
+
+void write_timestamp(std::ostream &out)
+{
+    const std::chrono::system_clock::time_point now =
+        std::chrono::system_clock::now();
+    const std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+    const long millis =
+        (long)(std::chrono::duration_cast<std::chrono::milliseconds>(
+                   now.time_since_epoch())
+                   .count() %
+               1000);
+
+    std::tm utc;
+    gmtime_r(&seconds, &utc);
+    char buffer[32];
+    const size_t size =
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &utc);
+    out.write(buffer, size);
+    const char fraction[] = {
+        '.',
+        (char)('0' + millis / 100),
+        (char)('0' + (millis / 10) % 10),
+        (char)('0' + millis % 10),
+        'Z'};
+    out.write(fraction, sizeof(fraction));
+}
+
+} // namespace
+
+void log_set_level(log_level level)
+{
+    log_threshold.store((int)level, std::memory_order_relaxed);
+}
+
+log_level log_get_level()
+{
+    return (log_level)log_threshold.load(std::memory_order_relaxed);
+}
+
+const char *log_level_name(log_level level)
+{
+    const int index = (int)level;
+    if (index < 0 || index > (int)log_level::off) {
+        throw std::invalid_argument("invalid log level");
+    }
+    return level_names[index];
+}
+
+log_level log_level_from_string(const std::string &name)
+{
+    std::string upper(name);
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+    for (int i = 0; i <= (int)log_level::off; ++i) {
+        if (upper == level_names[i]) {
+            return (log_level)i;
+        }
+    }
+    throw std::invalid_argument("invalid log level: " + name);
+}
+
+void log_set_output(std::ostream &out) { get_writer().set_output(out); }
+
+void log_flush() { get_writer().flush(); }
+
+log_record::log_record(log_level level) : level(level)
+{
+    if (thread_buffer_in_use) {
+        own_buffer.reset(new std::ostringstream());
+        buffer = own_buffer.get();
+    } else {
+        thread_buffer_in_use = true;
+        thread_buffer.str(std::string());
+        thread_buffer.clear();
+        thread_buffer.copyfmt(default_format());
+        buffer = &thread_buffer;
+    }
+
+    write_timestamp(*buffer);
+    *buffer << ' ' << log_level_name(level) << " [t" << get_thread_index()
+            << "] ";
+}
+
+log_record::~log_record()
+{
+    log_writer &writer = get_writer();
+    writer.push(buffer->str());
+    if (buffer == &thread_buffer) {
+        thread_buffer_in_use = false;
+    }
+
+    if (level >= log_level::error) {
+        writer.flush();
+    }
+}
+
+std::ostream &log_record::stream() { return *buffer; }
+
+} // namespace libzeth
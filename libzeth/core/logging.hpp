@@ -0,0 +1,109 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_LOGGING_HPP__
+#define __ZETH_CORE_LOGGING_HPP__
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+/// Leveled logging. Records are written as single lines of the form:
+///
+///   <UTC time> <LEVEL> [t<thread>] <message>
+///
+/// Usage:
+///
+///   ZETH_LOG(info) << "Received request " << id;
+///
+/// A record is only formatted if its level is enabled, both at compile time
+/// (levels below ZETH_LOG_LEVEL, set by the CMake option `LOG_LEVEL`, are
+/// compiled out) and at runtime (see `log_set_level`). The arguments of a
+/// disabled record are not evaluated. Enabled records are formatted into a
+/// buffer owned by the calling thread, and handed over, without taking any
+/// lock, to a writer thread which writes them to the output stream. Records
+/// of level `error` are written before `ZETH_LOG` returns.
+
+/// Minimum level compiled in, as an integer value of `log_level`.
+#ifndef ZETH_LOG_LEVEL
+#define ZETH_LOG_LEVEL 0
+#endif
+
+#define ZETH_LOG(level)                                                        \
+    if (!libzeth::log_enabled(libzeth::log_level::level)) {                    \
+    } else                                                                     \
+        libzeth::log_record(libzeth::log_level::level).stream()
+
+namespace libzeth
+{
+
+/// Log levels, in increasing order of severity.
+enum class log_level : int {
+    trace = 0,
+    debug = 1,
+    info = 2,
+    warning = 3,
+    error = 4,
+    /// Disables all records (only valid as a threshold).
+    off = 5,
+};
+
+/// Runtime threshold. Use `log_set_level` and `log_get_level`.
+extern std::atomic<int> log_threshold;
+
+inline bool log_enabled(log_level level)
+{
+    return ((int)level >= ZETH_LOG_LEVEL) &&
+           ((int)level >= log_threshold.load(std::memory_order_relaxed));
+}
+
+/// Set the minimum level of the records written at runtime (`info` by
+/// default).
+void log_set_level(log_level level);
+
+log_level log_get_level();
+
+/// Upper case name of a level, as it appears in records.
+const char *log_level_name(log_level level);
+
+/// Parse a level name (case insensitive). Throws `std::invalid_argument` if
+/// the name is not recognised.
+log_level log_level_from_string(const std::string &name);
+
+/// Set the stream to which records are written (`std::cout` by default).
+/// Records created before the call are written to the previous stream, and
+/// records created concurrently with the call may be written to either
+/// stream. The stream must remain valid until the next call.
+void log_set_output(std::ostream &out);
+
+/// Wait until all records created before the call have been written and the
+/// output stream has been flushed.
+void log_flush();
+
+/// A single record. Use via the `ZETH_LOG` macro.
+class log_record
+{
+public:
+    explicit log_record(log_level level);
+    log_record(const log_record &) = delete;
+    log_record &operator=(const log_record &) = delete;
+    ~log_record();
+
+    std::ostream &stream();
+
+private:
+    const log_level level;
+
+    // Stream used if the thread's buffer is already in use by another record
+    // (e.g. when a record is created while formatting another one).
+    std::unique_ptr<std::ostringstream> own_buffer;
+
+    std::ostringstream *buffer;
+};
+
+} // namespace libzeth
+
+#endif // __ZETH_CORE_LOGGING_HPP__
@@ -0,0 +1,74 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_MERKLE_TREE_FIELD_KARY_HPP__
+#define __ZETH_CORE_MERKLE_TREE_FIELD_KARY_HPP__
+
+#include "libzeth/core/include_libff.hpp"
+
+#include <map>
+#include <vector>
+
+namespace libzeth
+{
+
+/// Merkle tree whose nodes are field elements, and where each internal node
+/// is the hash of its `arity` children (`arity` being a power of 2). The
+/// `HashTreeT` type must provide a static `get_hash(std::vector<FieldT>)`
+/// accepting `arity` elements (e.g. `Poseidon128<4, 1, FieldT>` for a 4-ary
+/// tree).
+///
+/// As in merkle_tree_field, the tree is sparse: only the nodes on the paths
+/// of leaves that have been set are stored, all others take the default
+/// value of their level. Nodes are stored in `hashes`, indexed such that the
+/// root has index 0 and the children of node `i` have indices `arity * i + 1`
+/// to `arity * i + arity`.
+///
+/// The address of a leaf is its index among the leaves. Its binary
+/// representation (least significant bit first) is the `address_bits` input
+/// of merkle_path_compute_kary, and `get_path` returns the siblings in the
+/// order expected by that gadget.
+template<typename FieldT, typename HashTreeT> class merkle_tree_field_kary
+{
+public:
+    const size_t depth;
+    const size_t arity;
+
+    /// Value of an empty node at each level (0 being the root and `depth`
+    /// the leaves).
+    std::vector<FieldT> hash_defaults;
+    std::map<size_t, FieldT> values;
+    std::map<size_t, FieldT> hashes;
+
+    merkle_tree_field_kary(const size_t depth, const size_t arity);
+    merkle_tree_field_kary(
+        const size_t depth,
+        const size_t arity,
+        const std::vector<FieldT> &contents_as_vector);
+
+    size_t num_leaves() const;
+
+    FieldT get_value(const size_t address) const;
+    void set_value(const size_t address, const FieldT &value);
+
+    FieldT get_root() const;
+
+    /// Returns the `depth * (arity - 1)` siblings on the path from the leaf
+    /// at `address` to the root, starting at the leaf level. At each level,
+    /// with `log2(arity)` address bits, siblings are grouped by the bit that
+    /// selects them: 1 node for the first bit, followed by 2 nodes for the
+    /// second bit, 4 nodes for the third, etc (see merkle_path_selector_kary).
+    std::vector<FieldT> get_path(const size_t address) const;
+
+private:
+    size_t first_leaf_index() const;
+    FieldT get_node(const size_t idx, const size_t level) const;
+    FieldT hash_children(const size_t idx, const size_t children_level) const;
+};
+
+} // namespace libzeth
+
+#include "libzeth/core/merkle_tree_field_kary.tcc"
+
+#endif // __ZETH_CORE_MERKLE_TREE_FIELD_KARY_HPP__
@@ -0,0 +1,177 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_MERKLE_TREE_FIELD_KARY_TCC__
+#define __ZETH_CORE_MERKLE_TREE_FIELD_KARY_TCC__
+
+#include "libzeth/core/merkle_tree_field_kary.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace libzeth
+{
+
+template<typename FieldT, typename HashTreeT>
+merkle_tree_field_kary<FieldT, HashTreeT>::merkle_tree_field_kary(
+    const size_t depth, const size_t arity)
+    : depth(depth)
+    , arity(arity)
+{
+    if (arity < 2 || 0 != (arity & (arity - 1))) {
+        throw std::invalid_argument("arity must be a power of 2");
+    }
+    if (depth * libff::log2(arity) >= sizeof(size_t) * 8) {
+        throw std::invalid_argument("tree depth too large");
+    }
+
+    // `hash_defaults` contains the default value of a merkle path, i.e. the
+    // recursive hash of the zero valued leaves.
+    FieldT last = FieldT::zero();
+    hash_defaults.reserve(depth + 1);
+    hash_defaults.emplace_back(last);
+    for (size_t i = 0; i < depth; ++i) {
+        last = HashTreeT::get_hash(std::vector<FieldT>(arity, last));
+        hash_defaults.push_back(last);
+    }
+
+    std::reverse(hash_defaults.begin(), hash_defaults.end());
+}
+
+template<typename FieldT, typename HashTreeT>
+merkle_tree_field_kary<FieldT, HashTreeT>::merkle_tree_field_kary(
+    const size_t depth,
+    const size_t arity,
+    const std::vector<FieldT> &contents_as_vector)
+    : merkle_tree_field_kary<FieldT, HashTreeT>(depth, arity)
+{
+    if (contents_as_vector.size() > num_leaves()) {
+        throw std::invalid_argument("too many leaves for tree");
+    }
+    if (contents_as_vector.empty()) {
+        return;
+    }
+
+    const size_t first_leaf = first_leaf_index();
+    for (size_t address = 0; address < contents_as_vector.size(); ++address) {
+        values[address] = contents_as_vector[address];
+        hashes[first_leaf + address] = contents_as_vector[address];
+    }
+
+    // Compute the parents of the range of populated nodes [idx_begin, idx_end)
+    // layer by layer.
+    size_t idx_begin = first_leaf;
+    size_t idx_end = first_leaf + contents_as_vector.size();
+    for (size_t layer = depth; layer > 0; --layer) {
+        const size_t parent_begin = (idx_begin - 1) / arity;
+        const size_t parent_end = (idx_end - 2) / arity + 1;
+        for (size_t parent = parent_begin; parent < parent_end; ++parent) {
+            hashes[parent] = hash_children(parent, layer);
+        }
+
+        idx_begin = parent_begin;
+        idx_end = parent_end;
+    }
+}
+
+template<typename FieldT, typename HashTreeT>
+size_t merkle_tree_field_kary<FieldT, HashTreeT>::num_leaves() const
+{
+    return 1ul << (depth * libff::log2(arity));
+}
+
+template<typename FieldT, typename HashTreeT>
+FieldT merkle_tree_field_kary<FieldT, HashTreeT>::get_value(
+    const size_t address) const
+{
+    assert(address < num_leaves());
+
+    auto it = values.find(address);
+    return (it == values.end()) ? FieldT::zero() : it->second;
+}
+
+template<typename FieldT, typename HashTreeT>
+void merkle_tree_field_kary<FieldT, HashTreeT>::set_value(
+    const size_t address, const FieldT &value)
+{
+    assert(address < num_leaves());
+
+    values[address] = value;
+
+    // Update the leaf and all nodes on its path to the root
+    size_t idx = first_leaf_index() + address;
+    hashes[idx] = value;
+    for (size_t layer = depth; layer > 0; --layer) {
+        idx = (idx - 1) / arity;
+        hashes[idx] = hash_children(idx, layer);
+    }
+}
+
+template<typename FieldT, typename HashTreeT>
+FieldT merkle_tree_field_kary<FieldT, HashTreeT>::get_root() const
+{
+    return get_node(0, 0);
+}
+
+template<typename FieldT, typename HashTreeT>
+std::vector<FieldT> merkle_tree_field_kary<FieldT, HashTreeT>::get_path(
+    const size_t address) const
+{
+    assert(address < num_leaves());
+
+    const size_t num_bits = libff::log2(arity);
+    std::vector<FieldT> result;
+    result.reserve(depth * (arity - 1));
+
+    size_t idx = first_leaf_index() + address;
+    for (size_t layer = depth; layer > 0; --layer) {
+        const size_t first_sibling = idx - ((idx - 1) % arity);
+        const size_t position = idx - first_sibling;
+
+        // For the i-th bit of the position, the siblings are the block of
+        // 2^i nodes adjacent to the block of 2^i nodes containing `idx`.
+        for (size_t i = 0; i < num_bits; ++i) {
+            const size_t block_begin = ((position >> i) ^ 1) << i;
+            for (size_t j = 0; j < (1ul << i); ++j) {
+                result.push_back(
+                    get_node(first_sibling + block_begin + j, layer));
+            }
+        }
+
+        idx = (idx - 1) / arity;
+    }
+
+    return result;
+}
+
+template<typename FieldT, typename HashTreeT>
+size_t merkle_tree_field_kary<FieldT, HashTreeT>::first_leaf_index() const
+{
+    // 1 + arity + arity^2 + ... + arity^(depth-1)
+    return (num_leaves() - 1) / (arity - 1);
+}
+
+template<typename FieldT, typename HashTreeT>
+FieldT merkle_tree_field_kary<FieldT, HashTreeT>::get_node(
+    const size_t idx, const size_t level) const
+{
+    auto it = hashes.find(idx);
+    return (it == hashes.end()) ? hash_defaults[level] : it->second;
+}
+
+template<typename FieldT, typename HashTreeT>
+FieldT merkle_tree_field_kary<FieldT, HashTreeT>::hash_children(
+    const size_t idx, const size_t children_level) const
+{
+    std::vector<FieldT> children;
+    children.reserve(arity);
+    for (size_t j = 1; j <= arity; ++j) {
+        children.push_back(get_node(arity * idx + j, children_level));
+    }
+    return HashTreeT::get_hash(children);
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CORE_MERKLE_TREE_FIELD_KARY_TCC__
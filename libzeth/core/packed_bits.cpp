@@ -0,0 +1,93 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/packed_bits.hpp"
+
+#include "libzeth/core/hex_codec.hpp"
+#include "libzeth/core/utils.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace libzeth
+{
+
+// The limbs are little-endian, so that (on the little-endian platforms
+// assumed throughout, see field_element_utils.hpp) the hex string can be
+// decoded in reverse directly into the memory of the limbs.
+void packed_limbs_from_hex(
+    const std::string &hex_str,
+    uint64_t *limbs,
+    size_t num_limbs,
+    size_t num_bits)
+{
+    std::fill(limbs, limbs + num_limbs, 0);
+
+    // Leading characters which do not fit in the limbs must be zeroes
+    const size_t max_chars = 16 * num_limbs;
+    const char *hex = hex_str.c_str();
+    size_t num_chars = hex_str.size();
+    for (; num_chars > max_chars; ++hex, --num_chars) {
+        if (char_to_nibble(*hex) != 0) {
+            throw std::length_error(
+                "Invalid hex string: the value does not fit in the bit length");
+        }
+    }
+
+    // An odd leading character is the low nibble of the most significant
+    // byte.
+    uint8_t *const bytes = (uint8_t *)limbs;
+    const size_t num_bytes = num_chars / 2;
+    if (num_chars % 2 != 0) {
+        bytes[num_bytes] = char_to_nibble(*hex);
+        ++hex;
+    }
+
+    if (!hex_decode_reversed(hex, num_bytes, bytes)) {
+        throw std::invalid_argument("invalid hex character");
+    }
+
+    // All bits above `num_bits` must be zeroes
+    const size_t last_limb = (num_bits - 1) / 64;
+    const size_t last_limb_bits = num_bits - 64 * last_limb;
+    const uint64_t last_limb_mask =
+        (last_limb_bits == 64) ? ~uint64_t(0)
+                               : ((uint64_t(1) << last_limb_bits) - 1);
+    bool overflow = (limbs[last_limb] & ~last_limb_mask) != 0;
+    for (size_t i = last_limb + 1; i < num_limbs; ++i) {
+        overflow = overflow || (limbs[i] != 0);
+    }
+    if (overflow) {
+        throw std::length_error(
+            "Invalid hex string: the value does not fit in the bit length");
+    }
+}
+
+std::string packed_limbs_to_hex(const uint64_t *limbs, size_t num_bits)
+{
+    // Encode whole limbs, and drop the leading characters above `num_bits`
+    const size_t num_limbs = (num_bits + 63) / 64;
+    const size_t num_chars = (num_bits + 3) / 4;
+    std::string hex_str(16 * num_limbs, '0');
+    hex_encode_reversed((const uint8_t *)limbs, 8 * num_limbs, &hex_str[0]);
+    hex_str.erase(0, 16 * num_limbs - num_chars);
+    return hex_str;
+}
+
+bool packed_limbs_add(
+    uint64_t *result, const uint64_t *a, const uint64_t *b, size_t num_limbs)
+{
+    uint64_t carry = 0;
+    for (size_t i = 0; i < num_limbs; ++i) {
+        const uint64_t b_i = b[i];
+        const uint64_t sum = a[i] + carry;
+        const uint64_t carry_0 = (sum < carry) ? 1 : 0;
+        result[i] = sum + b_i;
+        carry = carry_0 | ((result[i] < b_i) ? 1 : 0);
+    }
+
+    return carry != 0;
+}
+
+} // namespace libzeth
@@ -0,0 +1,108 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_PACKED_BITS_HPP__
+#define __ZETH_CORE_PACKED_BITS_HPP__
+
+#include <array>
+#include <cstdint>
+#include <libff/algebra/fields/bigint.hpp>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+namespace libzeth
+{
+
+/// Bit string of `BitLen` bits, packed into 64-bit limbs. The string is
+/// interpreted as a big-endian unsigned integer, as for the `bits` types of
+/// bits.hpp (element 0 of a `std::array<bool, BitLen>` is the most
+/// significant bit), and is stored as little-endian limbs (limb 0 holds the
+/// 64 least significant bits). Bits of the last limb above `BitLen` are
+/// always 0.
+///
+/// Additions, XORs, comparisons and conversions to and from hexadecimal
+/// strings and `libff::bigint` operate on whole limbs, rather than one bit at
+/// a time.
+template<size_t BitLen> class packed_bits
+{
+public:
+    static const size_t num_limbs = (BitLen + 63) / 64;
+
+    /// Zero
+    packed_bits();
+
+    static packed_bits from_array(const std::array<bool, BitLen> &arr);
+
+    /// Throws `std::length_error` if `vect` does not have `BitLen` elements.
+    static packed_bits from_vector(const std::vector<bool> &vect);
+
+    /// Parse a big-endian hexadecimal string of any length. Throws
+    /// `std::invalid_argument` if the string contains non-hex characters, and
+    /// `std::length_error` if the value does not fit in `BitLen` bits.
+    static packed_bits from_hex(const std::string &hex_str);
+
+    /// Throws `std::overflow_error` if the value does not fit in `BitLen`
+    /// bits.
+    template<mp_size_t n>
+    static packed_bits from_bigint(const libff::bigint<n> &value);
+
+    std::array<bool, BitLen> to_array() const;
+    std::vector<bool> to_vector() const;
+
+    /// Big-endian hexadecimal string of `ceil(BitLen / 4)` characters
+    std::string to_hex() const;
+
+    template<mp_size_t n> libff::bigint<n> to_bigint() const;
+
+    /// Returns the i-th bit, in the order of `to_array` (0 is the most
+    /// significant bit).
+    bool test(size_t i) const;
+
+    bool is_zero() const;
+
+    /// XOR of two bit strings
+    packed_bits operator^(const packed_bits &other) const;
+
+    /// Sum of two bit strings, modulo 2^BitLen. If `with_carry` is true,
+    /// throws `std::overflow_error` if the sum does not fit in `BitLen` bits.
+    packed_bits add(const packed_bits &other, bool with_carry = false) const;
+
+    bool operator==(const packed_bits &other) const;
+    bool operator!=(const packed_bits &other) const;
+
+    const std::array<uint64_t, num_limbs> &limbs() const;
+
+private:
+    // Mask of the valid bits of the last limb
+    static const uint64_t top_limb_mask =
+        (BitLen % 64 == 0) ? ~uint64_t(0)
+                           : ((uint64_t(1) << (BitLen % 64)) - 1);
+
+    std::array<uint64_t, num_limbs> words;
+};
+
+/// Parse a big-endian hexadecimal string into `num_limbs` little-endian limbs.
+/// Throws `std::invalid_argument` for non-hex characters, and
+/// `std::length_error` if the value does not fit in `num_bits` bits.
+void packed_limbs_from_hex(
+    const std::string &hex_str,
+    uint64_t *limbs,
+    size_t num_limbs,
+    size_t num_bits);
+
+/// Encode the `num_bits` low bits of little-endian limbs as a big-endian
+/// hexadecimal string of `ceil(num_bits / 4)` characters.
+std::string packed_limbs_to_hex(const uint64_t *limbs, size_t num_bits);
+
+/// result = a + b, over `num_limbs` limbs. Returns the carry out of the last
+/// limb. `result` may alias `a` or `b`.
+bool packed_limbs_add(
+    uint64_t *result, const uint64_t *a, const uint64_t *b, size_t num_limbs);
+
+} // namespace libzeth
+
+#include "libzeth/core/packed_bits.tcc"
+
+#endif // __ZETH_CORE_PACKED_BITS_HPP__
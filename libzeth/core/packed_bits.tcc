@@ -0,0 +1,194 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_PACKED_BITS_TCC__
+#define __ZETH_CORE_PACKED_BITS_TCC__
+
+#include "libzeth/core/packed_bits.hpp"
+
+#include <stdexcept>
+
+namespace libzeth
+{
+
+template<size_t BitLen> const size_t packed_bits<BitLen>::num_limbs;
+
+template<size_t BitLen> const uint64_t packed_bits<BitLen>::top_limb_mask;
+
+template<size_t BitLen> packed_bits<BitLen>::packed_bits()
+{
+    words.fill(0);
+}
+
+template<size_t BitLen>
+packed_bits<BitLen> packed_bits<BitLen>::from_array(
+    const std::array<bool, BitLen> &arr)
+{
+    packed_bits result;
+    for (size_t i = 0; i < BitLen; ++i) {
+        const size_t position = BitLen - 1 - i;
+        result.words[position / 64] |= uint64_t(arr[i]) << (position % 64);
+    }
+    return result;
+}
+
+template<size_t BitLen>
+packed_bits<BitLen> packed_bits<BitLen>::from_vector(
+    const std::vector<bool> &vect)
+{
+    if (vect.size() != BitLen) {
+        throw std::length_error(
+            "Invalid bit length for the given boolean vector (should be equal "
+            "to the size of the vector)");
+    }
+
+    packed_bits result;
+    for (size_t i = 0; i < BitLen; ++i) {
+        const size_t position = BitLen - 1 - i;
+        result.words[position / 64] |= uint64_t(vect[i]) << (position % 64);
+    }
+    return result;
+}
+
+template<size_t BitLen>
+packed_bits<BitLen> packed_bits<BitLen>::from_hex(const std::string &hex_str)
+{
+    packed_bits result;
+    packed_limbs_from_hex(hex_str, result.words.data(), num_limbs, BitLen);
+    return result;
+}
+
+template<size_t BitLen>
+template<mp_size_t n>
+packed_bits<BitLen> packed_bits<BitLen>::from_bigint(
+    const libff::bigint<n> &value)
+{
+    static_assert(GMP_NUMB_BITS == 64, "limbs must be 64 bits");
+
+    packed_bits result;
+    for (size_t i = 0; i < (size_t)n; ++i) {
+        const uint64_t limb = value.data[i];
+        if (i < num_limbs) {
+            result.words[i] = limb;
+        } else if (limb != 0) {
+            throw std::overflow_error("bigint does not fit in packed_bits");
+        }
+    }
+
+    if ((result.words[num_limbs - 1] & ~top_limb_mask) != 0) {
+        throw std::overflow_error("bigint does not fit in packed_bits");
+    }
+
+    return result;
+}
+
+template<size_t BitLen>
+std::array<bool, BitLen> packed_bits<BitLen>::to_array() const
+{
+    std::array<bool, BitLen> arr;
+    for (size_t i = 0; i < BitLen; ++i) {
+        arr[i] = test(i);
+    }
+    return arr;
+}
+
+template<size_t BitLen>
+std::vector<bool> packed_bits<BitLen>::to_vector() const
+{
+    std::vector<bool> vect(BitLen);
+    for (size_t i = 0; i < BitLen; ++i) {
+        vect[i] = test(i);
+    }
+    return vect;
+}
+
+template<size_t BitLen> std::string packed_bits<BitLen>::to_hex() const
+{
+    return packed_limbs_to_hex(words.data(), BitLen);
+}
+
+template<size_t BitLen>
+template<mp_size_t n>
+libff::bigint<n> packed_bits<BitLen>::to_bigint() const
+{
+    static_assert(GMP_NUMB_BITS == 64, "limbs must be 64 bits");
+    static_assert((size_t)n >= num_limbs, "bigint too small");
+
+    libff::bigint<n> result;
+    for (size_t i = 0; i < (size_t)n; ++i) {
+        result.data[i] = (i < num_limbs) ? words[i] : 0;
+    }
+    return result;
+}
+
+template<size_t BitLen> bool packed_bits<BitLen>::test(size_t i) const
+{
+    const size_t position = BitLen - 1 - i;
+    return (words[position / 64] >> (position % 64)) & 1;
+}
+
+template<size_t BitLen> bool packed_bits<BitLen>::is_zero() const
+{
+    for (const uint64_t limb : words) {
+        if (limb != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<size_t BitLen>
+packed_bits<BitLen> packed_bits<BitLen>::operator^(
+    const packed_bits &other) const
+{
+    packed_bits result;
+    for (size_t i = 0; i < num_limbs; ++i) {
+        result.words[i] = words[i] ^ other.words[i];
+    }
+    return result;
+}
+
+template<size_t BitLen>
+packed_bits<BitLen> packed_bits<BitLen>::add(
+    const packed_bits &other, bool with_carry) const
+{
+    packed_bits result;
+    const bool carry = packed_limbs_add(
+        result.words.data(), words.data(), other.words.data(), num_limbs);
+
+    // The carry out of bit `BitLen - 1` is either the carry out of the last
+    // limb, or the first bit above `BitLen` in the last limb.
+    const bool overflow =
+        carry || ((result.words[num_limbs - 1] & ~top_limb_mask) != 0);
+    if (with_carry && overflow) {
+        throw std::overflow_error("Overflow: The sum of the binary addition "
+                                  "cannot be encoded on <BitLen> bits");
+    }
+
+    result.words[num_limbs - 1] &= top_limb_mask;
+    return result;
+}
+
+template<size_t BitLen>
+bool packed_bits<BitLen>::operator==(const packed_bits &other) const
+{
+    return words == other.words;
+}
+
+template<size_t BitLen>
+bool packed_bits<BitLen>::operator!=(const packed_bits &other) const
+{
+    return words != other.words;
+}
+
+template<size_t BitLen>
+const std::array<uint64_t, packed_bits<BitLen>::num_limbs> &packed_bits<
+    BitLen>::limbs() const
+{
+    return words;
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CORE_PACKED_BITS_TCC__
@@ -0,0 +1,26 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/r1cs_checker.hpp"
+
+#include <sstream>
+
+namespace libzeth
+{
+
+std::string r1cs_unsatisfied_constraints_to_string(
+    const std::vector<r1cs_unsatisfied_constraint> &unsatisfied)
+{
+    std::stringstream ss;
+    ss << unsatisfied.size() << " unsatisfied constraint(s):";
+    for (const r1cs_unsatisfied_constraint &constraint : unsatisfied) {
+        ss << "\n  constraint " << constraint.index;
+        if (!constraint.annotation.empty()) {
+            ss << ": " << constraint.annotation;
+        }
+    }
+    return ss.str();
+}
+
+} // namespace libzeth
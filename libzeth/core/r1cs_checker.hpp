@@ -0,0 +1,97 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_R1CS_CHECKER_HPP__
+#define __ZETH_CORE_R1CS_CHECKER_HPP__
+
+#include "libzeth/core/annotations.hpp"
+#include "libzeth/core/include_libsnark.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libzeth
+{
+
+/// Level of satisfiability checking to perform on a witness.
+enum class r1cs_check_mode {
+    /// No check
+    off,
+    /// Check a random subset of constraints
+    sampled,
+    /// Check every constraint
+    full,
+};
+
+/// Description of a constraint not satisfied by a witness.
+struct r1cs_unsatisfied_constraint {
+    size_t index;
+    /// Empty unless annotations are enabled (see annotations.hpp).
+    std::string annotation;
+};
+
+/// Satisfiability checker for a fixed constraint system. Constraints are held
+/// in a compact CSR (compressed sparse row) layout, with one row for each of
+/// the A, B and C linear combinations of each constraint, so that a single
+/// checker can be built once and used to check many witnesses, in parallel.
+template<typename FieldT> class r1cs_checker
+{
+private:
+    size_t num_variables;
+    size_t num_constraints;
+
+    // Row r spans terms [row_offsets[r], row_offsets[r+1]). Constraint i uses
+    // rows 3i (A), 3i+1 (B) and 3i+2 (C).
+    std::vector<size_t> row_offsets;
+    std::vector<size_t> term_indices;
+    std::vector<FieldT> term_coefficients;
+    std::map<size_t, std::string> constraint_annotations;
+
+public:
+    /// Default number of constraints evaluated in `sampled` mode.
+    static const size_t default_sample_size = 4096;
+
+    explicit r1cs_checker(const libsnark::r1cs_constraint_system<FieldT> &cs);
+
+    /// Check the full variable assignment (primary inputs followed by
+    /// auxiliary inputs) against the constraints selected by `mode`. Returns
+    /// the (up to) `max_failures` lowest-indexed unsatisfied constraints
+    /// among those checked, in index order. An empty result means all
+    /// checked constraints are satisfied.
+    std::vector<r1cs_unsatisfied_constraint> check(
+        const libsnark::r1cs_variable_assignment<FieldT> &assignment,
+        r1cs_check_mode mode,
+        size_t max_failures,
+        size_t sample_size = default_sample_size) const;
+
+    /// Returns true if constraint `i` is satisfied by `assignment`.
+    bool is_constraint_satisfied(
+        size_t i,
+        const libsnark::r1cs_variable_assignment<FieldT> &assignment) const;
+
+private:
+    FieldT evaluate_row(
+        size_t row,
+        const libsnark::r1cs_variable_assignment<FieldT> &assignment) const;
+    /// Check constraints index_of(0), ..., index_of(num_positions - 1),
+    /// where index_of is increasing.
+    template<typename IndexFnT>
+    std::vector<r1cs_unsatisfied_constraint> check_positions(
+        size_t num_positions,
+        const IndexFnT &index_of,
+        const libsnark::r1cs_variable_assignment<FieldT> &assignment,
+        size_t max_failures) const;
+};
+
+/// Human-readable description of unsatisfied constraints, for error
+/// messages.
+std::string r1cs_unsatisfied_constraints_to_string(
+    const std::vector<r1cs_unsatisfied_constraint> &unsatisfied);
+
+} // namespace libzeth
+
+#include "libzeth/core/r1cs_checker.tcc"
+
+#endif // __ZETH_CORE_R1CS_CHECKER_HPP__
@@ -0,0 +1,198 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_R1CS_CHECKER_TCC__
+#define __ZETH_CORE_R1CS_CHECKER_TCC__
+
+#include "libzeth/core/r1cs_checker.hpp"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace libzeth
+{
+
+template<typename FieldT>
+r1cs_checker<FieldT>::r1cs_checker(
+    const libsnark::r1cs_constraint_system<FieldT> &cs)
+    : num_variables(cs.num_variables())
+    , num_constraints(cs.num_constraints())
+    , row_offsets()
+    , term_indices()
+    , term_coefficients()
+    , constraint_annotations()
+{
+    size_t num_terms = 0;
+    for (const libsnark::r1cs_constraint<FieldT> &constraint : cs.constraints) {
+        num_terms += constraint.a.terms.size() + constraint.b.terms.size() +
+                     constraint.c.terms.size();
+    }
+
+    row_offsets.reserve(3 * num_constraints + 1);
+    term_indices.reserve(num_terms);
+    term_coefficients.reserve(num_terms);
+
+    row_offsets.push_back(0);
+    for (const libsnark::r1cs_constraint<FieldT> &constraint : cs.constraints) {
+        for (const libsnark::linear_combination<FieldT> *lc :
+             {&constraint.a, &constraint.b, &constraint.c}) {
+            for (const libsnark::linear_term<FieldT> &lt : lc->terms) {
+                if (lt.index > num_variables) {
+                    throw std::invalid_argument("invalid variable index");
+                }
+                term_indices.push_back(lt.index);
+                term_coefficients.push_back(lt.coeff);
+            }
+            row_offsets.push_back(term_indices.size());
+        }
+    }
+
+#ifdef ZETH_ANNOTATIONS
+    constraint_annotations = cs.constraint_annotations;
+#endif
+}
+
+template<typename FieldT>
+std::vector<r1cs_unsatisfied_constraint> r1cs_checker<FieldT>::check(
+    const libsnark::r1cs_variable_assignment<FieldT> &assignment,
+    r1cs_check_mode mode,
+    size_t max_failures,
+    size_t sample_size) const
+{
+    if (assignment.size() != num_variables) {
+        throw std::invalid_argument("invalid assignment size");
+    }
+
+    switch (mode) {
+    case r1cs_check_mode::off:
+        return {};
+
+    case r1cs_check_mode::full:
+        return check_positions(
+            num_constraints,
+            [](size_t i) { return i; },
+            assignment,
+            max_failures);
+
+    case r1cs_check_mode::sampled:
+        break;
+    }
+
+    if (sample_size >= num_constraints) {
+        return check(assignment, r1cs_check_mode::full, max_failures);
+    }
+
+    // Select sample_size distinct constraints uniformly at random (Floyd's
+    // algorithm), sorted to preserve locality and the ordering of results.
+    // The engine is seeded once per thread, and the selection only holds the
+    // sampled indices, so the cost does not depend on num_constraints.
+    thread_local std::mt19937_64 rng(std::random_device{}());
+    std::unordered_set<size_t> selected;
+    selected.reserve(sample_size);
+    for (size_t j = num_constraints - sample_size; j < num_constraints; ++j) {
+        const size_t t = std::uniform_int_distribution<size_t>(0, j)(rng);
+        if (!selected.insert(t).second) {
+            selected.insert(j);
+        }
+    }
+    std::vector<size_t> sample(selected.begin(), selected.end());
+    std::sort(sample.begin(), sample.end());
+
+    return check_positions(
+        sample.size(),
+        [&sample](size_t i) { return sample[i]; },
+        assignment,
+        max_failures);
+}
+
+template<typename FieldT>
+bool r1cs_checker<FieldT>::is_constraint_satisfied(
+    size_t i,
+    const libsnark::r1cs_variable_assignment<FieldT> &assignment) const
+{
+    const FieldT a = evaluate_row(3 * i, assignment);
+    const FieldT b = evaluate_row(3 * i + 1, assignment);
+    const FieldT c = evaluate_row(3 * i + 2, assignment);
+    return a * b == c;
+}
+
+template<typename FieldT>
+FieldT r1cs_checker<FieldT>::evaluate_row(
+    size_t row,
+    const libsnark::r1cs_variable_assignment<FieldT> &assignment) const
+{
+    // Variable 0 is the constant 1, and variable i > 0 is assignment[i-1].
+    FieldT acc = FieldT::zero();
+    const size_t end = row_offsets[row + 1];
+    for (size_t k = row_offsets[row]; k < end; ++k) {
+        const size_t index = term_indices[k];
+        if (index == 0) {
+            acc += term_coefficients[k];
+        } else {
+            acc += term_coefficients[k] * assignment[index - 1];
+        }
+    }
+    return acc;
+}
+
+template<typename FieldT>
+template<typename IndexFnT>
+std::vector<r1cs_unsatisfied_constraint> r1cs_checker<FieldT>::
+    check_positions(
+        size_t num_positions,
+        const IndexFnT &index_of,
+        const libsnark::r1cs_variable_assignment<FieldT> &assignment,
+        size_t max_failures) const
+{
+    if (0 == max_failures) {
+        max_failures = 1;
+    }
+
+    // Positions are divided into contiguous chunks, each of which records at
+    // most max_failures failures. Concatenating the chunk results (in order)
+    // and truncating then gives the first max_failures failures overall.
+    const size_t chunk_size = 1024;
+    const size_t num_chunks = (num_positions + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<size_t>> chunk_failures(num_chunks);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        const size_t begin = chunk * chunk_size;
+        const size_t end = std::min(begin + chunk_size, num_positions);
+        std::vector<size_t> &failures = chunk_failures[chunk];
+        for (size_t pos = begin; pos < end; ++pos) {
+            const size_t index = index_of(pos);
+            if (!is_constraint_satisfied(index, assignment)) {
+                failures.push_back(index);
+                if (failures.size() == max_failures) {
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<r1cs_unsatisfied_constraint> unsatisfied;
+    for (const std::vector<size_t> &failures : chunk_failures) {
+        for (const size_t index : failures) {
+            if (unsatisfied.size() == max_failures) {
+                return unsatisfied;
+            }
+            const std::map<size_t, std::string>::const_iterator it =
+                constraint_annotations.find(index);
+            unsatisfied.push_back(
+                {index,
+                 (it == constraint_annotations.end()) ? "" : it->second});
+        }
+    }
+
+    return unsatisfied;
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CORE_R1CS_CHECKER_TCC__
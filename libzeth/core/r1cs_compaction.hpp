@@ -0,0 +1,84 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_R1CS_COMPACTION_HPP__
+#define __ZETH_CORE_R1CS_COMPACTION_HPP__
+
+#include "libzeth/core/annotations.hpp"
+#include "libzeth/core/include_libsnark.hpp"
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace libzeth
+{
+
+/// Optimization pass which removes linear-only constraints from a constraint
+/// system. A constraint A * B = C in which A (or B) is a constant k is the
+/// linear equation k.B - C = 0 (resp. k.A - C = 0). Where this equation
+/// involves an auxiliary variable v, the equation is solved for v, v is
+/// substituted out of all other constraints, and both v and the constraint
+/// are removed. Primary inputs are never eliminated.
+///
+/// The values of retained variables are unchanged, so witnesses for the
+/// original system are mapped to the compacted system by dropping the values
+/// of eliminated variables (see `auxiliary_input`). The same constraint
+/// system always produces the same compacted system.
+template<typename FieldT> class r1cs_compaction
+{
+private:
+    // Sparse linear combination: variable index -> (non-zero) coefficient
+    using sparse_lc = std::map<size_t, FieldT>;
+
+    size_t original_num_variables;
+    size_t original_num_constraints;
+    libsnark::r1cs_constraint_system<FieldT> compacted;
+
+    // Original indices of the retained auxiliary variables, in order.
+    std::vector<size_t> kept_auxiliary;
+
+public:
+    /// Default bound on the number of terms in the definition of an
+    /// eliminated variable. Substituting variables with large definitions
+    /// (such as packed bit strings) can increase the total number of terms
+    /// significantly, so such variables are retained.
+    static const size_t default_max_definition_terms = 8;
+
+    explicit r1cs_compaction(
+        const libsnark::r1cs_constraint_system<FieldT> &cs,
+        size_t max_definition_terms = default_max_definition_terms);
+
+    /// The compacted constraint system
+    const libsnark::r1cs_constraint_system<FieldT> &constraint_system() const;
+
+    /// Map a full variable assignment for the original constraint system to
+    /// the auxiliary input for the compacted constraint system. (Primary
+    /// inputs are unchanged).
+    libsnark::r1cs_auxiliary_input<FieldT> auxiliary_input(
+        const libsnark::r1cs_variable_assignment<FieldT> &assignment) const;
+
+    /// Print the number of constraints and variables before and after
+    /// compaction.
+    void print_statistics() const;
+
+private:
+    static bool is_constant(
+        const libsnark::linear_combination<FieldT> &lc, FieldT &out_value);
+
+    /// Add coeff * lc to `out`, substituting eliminated variables.
+    static void add_resolved(
+        sparse_lc &out,
+        const libsnark::linear_combination<FieldT> &lc,
+        const FieldT &coeff,
+        const std::map<size_t, sparse_lc> &definitions);
+
+    static void add_term(sparse_lc &out, size_t index, const FieldT &coeff);
+};
+
+} // namespace libzeth
+
+#include "libzeth/core/r1cs_compaction.tcc"
+
+#endif // __ZETH_CORE_R1CS_COMPACTION_HPP__
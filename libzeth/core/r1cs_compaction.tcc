@@ -0,0 +1,240 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_CORE_R1CS_COMPACTION_TCC__
+#define __ZETH_CORE_R1CS_COMPACTION_TCC__
+
+#include "libzeth/core/r1cs_compaction.hpp"
+
+#include <iostream>
+#include <libff/common/profiling.hpp>
+#include <stdexcept>
+
+namespace libzeth
+{
+
+template<typename FieldT>
+r1cs_compaction<FieldT>::r1cs_compaction(
+    const libsnark::r1cs_constraint_system<FieldT> &cs,
+    size_t max_definition_terms)
+    : original_num_variables(cs.num_variables())
+    , original_num_constraints(cs.num_constraints())
+    , compacted()
+    , kept_auxiliary()
+{
+    const size_t num_inputs = cs.num_inputs();
+    const size_t num_constraints = cs.num_constraints();
+
+    // Pass 1: in constraint order, select linear constraints and the
+    // variables they define. Definitions are kept fully resolved (in terms
+    // of variables which have not been eliminated), using `users` to find
+    // definitions which refer to a newly eliminated variable.
+    std::map<size_t, sparse_lc> definitions;
+    std::map<size_t, std::set<size_t>> users;
+    std::vector<bool> removed(num_constraints, false);
+    for (size_t i = 0; i < num_constraints; ++i) {
+        const libsnark::r1cs_constraint<FieldT> &constraint = cs.constraints[i];
+        FieldT k;
+        const libsnark::linear_combination<FieldT> *other;
+        if (is_constant(constraint.a, k)) {
+            other = &constraint.b;
+        } else if (is_constant(constraint.b, k)) {
+            other = &constraint.a;
+        } else {
+            continue;
+        }
+
+        // equation = k * other - C = 0
+        sparse_lc equation;
+        add_resolved(equation, *other, k, definitions);
+        add_resolved(equation, constraint.c, -FieldT::one(), definitions);
+
+        // Trivially satisfied (0 = 0) constraints are removed.
+        if (equation.empty()) {
+            removed[i] = true;
+            continue;
+        }
+
+        // Eliminate the highest-indexed auxiliary variable (typically the
+        // output of the gadget which created the constraint).
+        const size_t pivot = equation.rbegin()->first;
+        if (pivot <= num_inputs || equation.size() - 1 > max_definition_terms) {
+            continue;
+        }
+
+        // pivot = -(1 / c_pivot) * (equation - c_pivot * pivot)
+        const FieldT scale = -(equation.rbegin()->second.inverse());
+        equation.erase(pivot);
+        sparse_lc definition;
+        for (const std::pair<const size_t, FieldT> &term : equation) {
+            definition.emplace(term.first, scale * term.second);
+        }
+
+        // Substitute into existing definitions which use pivot.
+        const typename std::map<size_t, std::set<size_t>>::iterator
+            pivot_users = users.find(pivot);
+        if (pivot_users != users.end()) {
+            for (const size_t user : pivot_users->second) {
+                sparse_lc &user_definition = definitions[user];
+                const typename sparse_lc::iterator it =
+                    user_definition.find(pivot);
+                if (it == user_definition.end()) {
+                    continue;
+                }
+                const FieldT coeff = it->second;
+                user_definition.erase(it);
+                for (const std::pair<const size_t, FieldT> &term : definition) {
+                    add_term(user_definition, term.first, coeff * term.second);
+                    if (term.first != 0) {
+                        users[term.first].insert(user);
+                    }
+                }
+            }
+            users.erase(pivot_users);
+        }
+
+        for (const std::pair<const size_t, FieldT> &term : definition) {
+            if (term.first != 0) {
+                users[term.first].insert(pivot);
+            }
+        }
+        definitions.emplace(pivot, std::move(definition));
+        removed[i] = true;
+    }
+
+    // Pass 2: renumber the retained variables and rewrite the retained
+    // constraints in terms of them.
+    std::vector<size_t> new_index(original_num_variables + 1);
+    for (size_t v = 0; v <= num_inputs; ++v) {
+        new_index[v] = v;
+    }
+    for (size_t v = num_inputs + 1; v <= original_num_variables; ++v) {
+        if (definitions.find(v) == definitions.end()) {
+            kept_auxiliary.push_back(v);
+            new_index[v] = num_inputs + kept_auxiliary.size();
+        }
+    }
+
+    const auto rewrite = [&](const libsnark::linear_combination<FieldT> &lc) {
+        sparse_lc resolved;
+        add_resolved(resolved, lc, FieldT::one(), definitions);
+        libsnark::linear_combination<FieldT> out;
+        out.terms.reserve(resolved.size());
+        for (const std::pair<const size_t, FieldT> &term : resolved) {
+            out.terms.emplace_back(
+                libsnark::variable<FieldT>(new_index[term.first]),
+                term.second);
+        }
+        return out;
+    };
+
+    compacted.primary_input_size = num_inputs;
+    compacted.auxiliary_input_size = kept_auxiliary.size();
+    for (size_t i = 0; i < num_constraints; ++i) {
+        if (removed[i]) {
+            continue;
+        }
+        const libsnark::r1cs_constraint<FieldT> &constraint = cs.constraints[i];
+        compacted.constraints.emplace_back(
+            rewrite(constraint.a), rewrite(constraint.b), rewrite(constraint.c));
+#ifdef ZETH_ANNOTATIONS
+        const std::map<size_t, std::string>::const_iterator annotation =
+            cs.constraint_annotations.find(i);
+        if (annotation != cs.constraint_annotations.end()) {
+            compacted.constraint_annotations[compacted.constraints.size() - 1] =
+                annotation->second;
+        }
+#endif
+    }
+}
+
+template<typename FieldT>
+const libsnark::r1cs_constraint_system<FieldT>
+    &r1cs_compaction<FieldT>::constraint_system() const
+{
+    return compacted;
+}
+
+template<typename FieldT>
+libsnark::r1cs_auxiliary_input<FieldT> r1cs_compaction<FieldT>::
+    auxiliary_input(
+        const libsnark::r1cs_variable_assignment<FieldT> &assignment) const
+{
+    if (assignment.size() != original_num_variables) {
+        throw std::invalid_argument("invalid assignment size");
+    }
+
+    libsnark::r1cs_auxiliary_input<FieldT> auxiliary;
+    auxiliary.reserve(kept_auxiliary.size());
+    for (const size_t v : kept_auxiliary) {
+        auxiliary.push_back(assignment[v - 1]);
+    }
+    return auxiliary;
+}
+
+template<typename FieldT>
+void r1cs_compaction<FieldT>::print_statistics() const
+{
+    libff::print_indent();
+    std::cout << "constraints: " << original_num_constraints << " -> "
+              << compacted.num_constraints() << std::endl;
+    libff::print_indent();
+    std::cout << "variables: " << original_num_variables << " -> "
+              << compacted.num_variables() << std::endl;
+}
+
+template<typename FieldT>
+bool r1cs_compaction<FieldT>::is_constant(
+    const libsnark::linear_combination<FieldT> &lc, FieldT &out_value)
+{
+    out_value = FieldT::zero();
+    for (const libsnark::linear_term<FieldT> &term : lc.terms) {
+        if (term.index != 0) {
+            return false;
+        }
+        out_value += term.coeff;
+    }
+    return true;
+}
+
+template<typename FieldT>
+void r1cs_compaction<FieldT>::add_resolved(
+    sparse_lc &out,
+    const libsnark::linear_combination<FieldT> &lc,
+    const FieldT &coeff,
+    const std::map<size_t, sparse_lc> &definitions)
+{
+    for (const libsnark::linear_term<FieldT> &term : lc.terms) {
+        const typename std::map<size_t, sparse_lc>::const_iterator it =
+            definitions.find(term.index);
+        if (it == definitions.end()) {
+            add_term(out, term.index, coeff * term.coeff);
+            continue;
+        }
+        for (const std::pair<const size_t, FieldT> &def_term : it->second) {
+            add_term(out, def_term.first, coeff * term.coeff * def_term.second);
+        }
+    }
+}
+
+template<typename FieldT>
+void r1cs_compaction<FieldT>::add_term(
+    sparse_lc &out, size_t index, const FieldT &coeff)
+{
+    if (coeff.is_zero()) {
+        return;
+    }
+    const std::pair<typename sparse_lc::iterator, bool> inserted =
+        out.emplace(index, coeff);
+    if (!inserted.second) {
+        inserted.first->second += coeff;
+        if (inserted.first->second.is_zero()) {
+            out.erase(inserted.first);
+        }
+    }
+}
+
+} // namespace libzeth
+
+#endif // __ZETH_CORE_R1CS_COMPACTION_TCC__
@@ -4,6 +4,8 @@
 
 #include "libzeth/core/utils.hpp"
 
+#include "libzeth/core/hex_codec.hpp"
+
 #include <cassert>
 #include <stdexcept>
 
@@ -30,22 +32,6 @@ uint8_t char_to_nibble(const char c)
     throw std::invalid_argument("invalid hex character");
 }
 
-static uint8_t chars_to_byte(const char *cs)
-{
-    const uint8_t *data = (const uint8_t *)cs;
-    return (char_to_nibble(data[0]) << 4) | char_to_nibble(data[1]);
-}
-
-static char nibble_hex(const uint8_t nibble)
-{
-    assert((nibble & 0xf0) == 0);
-    if (nibble > 9) {
-        return 'a' + nibble - 10;
-    }
-
-    return '0' + nibble;
-}
-
 // Return a pointer to the beginning of the actual hex characters (removing any
 // `0x` prefix), and ensure that the length is as expected.
 static const char *find_hex_string_of_length(
@@ -68,12 +54,8 @@ static const char *find_hex_string_of_length(
 void hex_to_bytes(const std::string &hex, void *dest, size_t bytes)
 {
     const char *cur = find_hex_string_of_length(hex, bytes);
-    uint8_t *dest_bytes = (uint8_t *)dest;
-    const uint8_t *const dest_bytes_end = dest_bytes + bytes;
-    while (dest_bytes < dest_bytes_end) {
-        *dest_bytes = chars_to_byte(cur);
-        cur += 2;
-        ++dest_bytes;
+    if (!hex_decode(cur, bytes, (uint8_t *)dest)) {
+        throw std::invalid_argument("invalid hex character");
     }
 }
 
@@ -83,13 +65,9 @@ void hex_to_bytes_reversed(const std::string &hex, void *dest, size_t bytes)
         return;
     }
     const char *cur = find_hex_string_of_length(hex, bytes);
-    uint8_t *const dest_bytes_end = (uint8_t *)dest;
-    uint8_t *dest_bytes = dest_bytes_end + bytes;
-    do {
-        --dest_bytes;
-        *dest_bytes = chars_to_byte(cur);
-        cur += 2;
-    } while (dest_bytes > dest_bytes_end);
+    if (!hex_decode_reversed(cur, bytes, (uint8_t *)dest)) {
+        throw std::invalid_argument("invalid hex character");
+    }
 }
 
 std::string hex_to_bytes(const std::string &s)
@@ -104,34 +82,15 @@ std::string hex_to_bytes(const std::string &s)
 
 std::string bytes_to_hex(const void *bytes, size_t num_bytes)
 {
-    std::string out;
-    out.reserve(num_bytes * 2);
-
-    const uint8_t *in = (const uint8_t *)bytes;
-    for (size_t i = 0; i < num_bytes; ++i) {
-        const uint8_t byte = in[i];
-        out.push_back(nibble_hex(byte >> 4));
-        out.push_back(nibble_hex(byte & 0x0f));
-    }
-
+    std::string out(num_bytes * 2, '0');
+    hex_encode((const uint8_t *)bytes, num_bytes, &out[0]);
     return out;
 }
 
 std::string bytes_to_hex_reversed(const void *bytes, size_t num_bytes)
 {
-    if (num_bytes == 0) {
-        return "";
-    }
-    std::string out;
-    out.reserve(num_bytes * 2);
-    const uint8_t *const src_bytes_end = (const uint8_t *)bytes;
-    const uint8_t *src_bytes = src_bytes_end + num_bytes;
-    do {
-        --src_bytes;
-        const uint8_t byte = *src_bytes;
-        out.push_back(nibble_hex(byte >> 4));
-        out.push_back(nibble_hex(byte & 0x0f));
-    } while (src_bytes > src_bytes_end);
+    std::string out(num_bytes * 2, '0');
+    hex_encode_reversed((const uint8_t *)bytes, num_bytes, &out[0]);
     return out;
 }
 
@@ -4,6 +4,7 @@
 
 #include "libzeth/mpc/groth16/mpc_hash.hpp"
 
+#include "libzeth/core/logging.hpp"
 #include "libzeth/core/utils.hpp"
 
 namespace libzeth
@@ -67,13 +68,13 @@ bool mpc_hash_read(mpc_hash_t out_hash, std::istream &in)
     std::string word;
     for (size_t i = 0; i < HASH_REPR_WORDS_PER_HASH; ++i) {
         if (!(in >> word)) {
-            std::cerr << "Read failed" << std::endl;
+            ZETH_LOG(error) << "Read failed";
             return false;
         }
 
         const std::string bin = hex_to_bytes(word);
         if (bin.size() != HASH_REPR_WORD_SIZE) {
-            std::cerr << "Invalid word size" << std::endl;
+            ZETH_LOG(error) << "Invalid word size";
             return false;
         }
 
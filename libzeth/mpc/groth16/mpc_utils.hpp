@@ -66,6 +66,28 @@ public:
     static srs_mpc_layer_L1 read(std::istream &in);
 };
 
+/// Compute the { [ t(x) . x^i ]_1 } i = 0 .. n-2 entries of the linear
+/// combination, for a QAP of degree n.
+template<typename ppT>
+libff::G1_vector<ppT> mpc_compute_T_tau_powers_g1(
+    const srs_powersoftau<ppT> &pot, size_t n);
+
+/// Compute the entries [begin, end) of the { [ A_j(x) ]_1 }, { [ B_j(x) ]_1
+/// }, { [ B_j(x) ]_2 } and { [ beta . A_j(x) + alpha . B_j(x) + C_j(x) ]_1 }
+/// vectors of the linear combination, writing them into the given vectors
+/// (which must each have num_variables+1 entries). This allows the bulk of
+/// the linear combination to be computed in chunks.
+template<typename ppT>
+void mpc_compute_linearcombination_range(
+    const srs_lagrange_evaluations<ppT> &lagrange,
+    const libsnark::qap_instance<libff::Fr<ppT>> &qap,
+    size_t begin,
+    size_t end,
+    libff::G1_vector<ppT> &As_g1,
+    libff::G1_vector<ppT> &Bs_g1,
+    libff::G2_vector<ppT> &Bs_g2,
+    libff::G1_vector<ppT> &ABCs_g1);
+
 /// Given a circuit and a powersoftau with pre-computed lagrange
 /// polynomials, perform the correct linear combination for the CRS MPC.
 template<typename ppT>
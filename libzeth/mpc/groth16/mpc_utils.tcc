@@ -130,35 +130,9 @@ srs_mpc_layer_L1<ppT> srs_mpc_layer_L1<ppT>::read(std::istream &in)
 }
 
 template<typename ppT>
-srs_mpc_layer_L1<ppT> mpc_compute_linearcombination(
-    const srs_powersoftau<ppT> &pot,
-    const srs_lagrange_evaluations<ppT> &lagrange,
-    const libsnark::qap_instance<libff::Fr<ppT>> &qap)
+libff::G1_vector<ppT> mpc_compute_T_tau_powers_g1(
+    const srs_powersoftau<ppT> &pot, size_t n)
 {
-    using Fr = libff::Fr<ppT>;
-    using G1 = libff::G1<ppT>;
-    using G2 = libff::G2<ppT>;
-    libff::enter_block("Call to mpc_compute_linearcombination");
-
-    // n = number of constraints in r1cs, or equivalently, n = deg(t(x))
-    // t(x) being the target polynomial of the QAP
-    // Note: In the code-base the target polynomial is also denoted Z
-    // as refered to as "the vanishing polynomial", and t is also used
-    // to represent the query point (aka "tau").
-    const size_t n = qap.degree();
-    const size_t num_variables = qap.num_variables();
-
-    if (n != 1ull << libff::log2(n)) {
-        throw std::invalid_argument("non-pow-2 domain");
-    }
-    if (n != lagrange.degree) {
-        throw std::invalid_argument(
-            "domain size differs from Lagrange evaluation");
-    }
-
-    libff::print_indent();
-    printf("n=%zu\n", n);
-
     // The QAP polynomials A, B, C are of degree (n-1) as we know they
     // are created by interpolation of an r1cs of n constraints.
     // As a consequence, the polynomial (A.B - C) is of degree 2n-2,
@@ -172,23 +146,43 @@ srs_mpc_layer_L1<ppT> mpc_compute_linearcombination(
     // Domain uses n-roots of unity, so
     //      t(x)       = x^n - 1
     //  =>  t(x) . x^i = x^(n+i) - x^i
-    libff::G1_vector<ppT> t_x_pow_i(n - 1, G1::zero());
+    libff::G1_vector<ppT> t_x_pow_i(n - 1, libff::G1<ppT>::zero());
     libff::enter_block("computing [t(x) . x^i]_1");
     for (size_t i = 0; i < n - 1; ++i) {
         t_x_pow_i[i] = pot.tau_powers_g1[n + i] - pot.tau_powers_g1[i];
     }
     libff::leave_block("computing [t(x) . x^i]_1");
 
-    libff::enter_block("computing A_i, B_i, C_i, ABC_i at x");
-    libff::G1_vector<ppT> As_g1(num_variables + 1);
-    libff::G1_vector<ppT> Bs_g1(num_variables + 1);
-    libff::G2_vector<ppT> Bs_g2(num_variables + 1);
-    libff::G1_vector<ppT> Cs_g1(num_variables + 1);
-    libff::G1_vector<ppT> ABCs_g1(num_variables + 1);
+    return t_x_pow_i;
+}
+
+template<typename ppT>
+void mpc_compute_linearcombination_range(
+    const srs_lagrange_evaluations<ppT> &lagrange,
+    const libsnark::qap_instance<libff::Fr<ppT>> &qap,
+    const size_t begin,
+    const size_t end,
+    libff::G1_vector<ppT> &As_g1,
+    libff::G1_vector<ppT> &Bs_g1,
+    libff::G2_vector<ppT> &Bs_g2,
+    libff::G1_vector<ppT> &ABCs_g1)
+{
+    using Fr = libff::Fr<ppT>;
+    using G1 = libff::G1<ppT>;
+    using G2 = libff::G2<ppT>;
+
+    const size_t num_variables = qap.num_variables();
+    if (end > num_variables + 1 || As_g1.size() != num_variables + 1 ||
+        Bs_g1.size() != num_variables + 1 ||
+        Bs_g2.size() != num_variables + 1 ||
+        ABCs_g1.size() != num_variables + 1) {
+        throw std::invalid_argument("invalid linear combination range");
+    }
+
 #ifdef MULTICORE
 #pragma omp parallel for
 #endif
-    for (size_t j = 0; j < num_variables + 1; ++j) {
+    for (size_t j = begin; j < end; ++j) {
         G1 ABC_j_at_x = G1::zero();
 
         {
@@ -235,12 +229,49 @@ srs_mpc_layer_L1<ppT> mpc_compute_linearcombination(
                     C_j_at_x + entry.second * lagrange.lagrange_g1[entry.first];
             }
 
-            Cs_g1[j] = C_j_at_x;
             ABC_j_at_x = ABC_j_at_x + C_j_at_x;
         }
 
         ABCs_g1[j] = ABC_j_at_x;
     }
+}
+
+template<typename ppT>
+srs_mpc_layer_L1<ppT> mpc_compute_linearcombination(
+    const srs_powersoftau<ppT> &pot,
+    const srs_lagrange_evaluations<ppT> &lagrange,
+    const libsnark::qap_instance<libff::Fr<ppT>> &qap)
+{
+    libff::enter_block("Call to mpc_compute_linearcombination");
+
+    // n = number of constraints in r1cs, or equivalently, n = deg(t(x))
+    // t(x) being the target polynomial of the QAP
+    // Note: In the code-base the target polynomial is also denoted Z
+    // as refered to as "the vanishing polynomial", and t is also used
+    // to represent the query point (aka "tau").
+    const size_t n = qap.degree();
+    const size_t num_variables = qap.num_variables();
+
+    if (n != 1ull << libff::log2(n)) {
+        throw std::invalid_argument("non-pow-2 domain");
+    }
+    if (n != lagrange.degree) {
+        throw std::invalid_argument(
+            "domain size differs from Lagrange evaluation");
+    }
+
+    libff::print_indent();
+    printf("n=%zu\n", n);
+
+    libff::G1_vector<ppT> t_x_pow_i = mpc_compute_T_tau_powers_g1(pot, n);
+
+    libff::enter_block("computing A_i, B_i, C_i, ABC_i at x");
+    libff::G1_vector<ppT> As_g1(num_variables + 1);
+    libff::G1_vector<ppT> Bs_g1(num_variables + 1);
+    libff::G2_vector<ppT> Bs_g2(num_variables + 1);
+    libff::G1_vector<ppT> ABCs_g1(num_variables + 1);
+    mpc_compute_linearcombination_range(
+        lagrange, qap, 0, num_variables + 1, As_g1, Bs_g1, Bs_g2, ABCs_g1);
     libff::leave_block("computing A_i, B_i, C_i, ABC_i at x");
 
     // TODO: Consider dropping those entries we know will not be used
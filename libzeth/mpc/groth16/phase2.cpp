@@ -4,9 +4,129 @@
 
 #include "libzeth/mpc/groth16/phase2.hpp"
 
+#include <algorithm>
+#include <sstream>
+
 namespace libzeth
 {
 
+namespace
+{
+
+using pp = libff::alt_bn128_pp;
+
+// Number of G1 elements (de)compressed by a single thread at a time.
+const size_t G1_COMPRESSED_CHUNK_SIZE = 1 << 12;
+
+// Maximum number of G1 elements to buffer in memory when reading or writing
+// vectors. Bounds the size of the intermediate buffer for large accumulators.
+const size_t G1_COMPRESSED_BLOCK_SIZE = 1 << 20;
+
+// Streambufs reading from, and writing to, a fixed block of memory, so that
+// chunks of a single buffer can be processed concurrently without copying.
+class membuf_in : public std::streambuf
+{
+public:
+    membuf_in(char *begin, char *end) { this->setg(begin, begin, end); }
+};
+
+class membuf_out : public std::streambuf
+{
+public:
+    membuf_out(char *begin, char *end) { this->setp(begin, end); }
+};
+
+// The compressed encoding of G1 elements has a fixed size, which is
+// determined once by encoding an arbitrary element.
+size_t g1_compressed_size()
+{
+    static const size_t size = []() {
+        std::ostringstream ss;
+        libff::alt_bn128_G1_write_compressed(ss, libff::alt_bn128_G1::one());
+        return ss.str().size();
+    }();
+    return size;
+}
+
+// Read the compressed encodings of `out.size()` G1 elements. Blocks of data
+// are read into memory, and split into chunks which are decompressed (each
+// requiring a square root per element) concurrently.
+void g1_vector_read_compressed(std::istream &in, libff::G1_vector<pp> &out)
+{
+    const size_t element_size = g1_compressed_size();
+    const size_t num_elements = out.size();
+    std::vector<char> buffer;
+    for (size_t block_start = 0; block_start < num_elements;
+         block_start += G1_COMPRESSED_BLOCK_SIZE) {
+        const size_t block_size =
+            std::min(G1_COMPRESSED_BLOCK_SIZE, num_elements - block_start);
+        buffer.resize(block_size * element_size);
+        in.read(buffer.data(), buffer.size());
+
+        const size_t num_chunks =
+            (block_size + G1_COMPRESSED_CHUNK_SIZE - 1) /
+            G1_COMPRESSED_CHUNK_SIZE;
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const size_t chunk_start = chunk * G1_COMPRESSED_CHUNK_SIZE;
+            const size_t chunk_end =
+                std::min(chunk_start + G1_COMPRESSED_CHUNK_SIZE, block_size);
+            membuf_in chunk_buf(
+                buffer.data() + chunk_start * element_size,
+                buffer.data() + chunk_end * element_size);
+            std::istream chunk_in(&chunk_buf);
+            for (size_t i = chunk_start; i < chunk_end; ++i) {
+                libff::alt_bn128_G1_read_compressed(
+                    chunk_in, out[block_start + i]);
+            }
+        }
+    }
+}
+
+// Write the compressed encodings of all elements in `g1s`. Blocks of elements
+// are split into chunks which are compressed (each requiring a conversion to
+// affine coordinates) concurrently into a buffer, which is then written to
+// `out`.
+void g1_vector_write_compressed(
+    std::ostream &out, const libff::G1_vector<pp> &g1s)
+{
+    const size_t element_size = g1_compressed_size();
+    const size_t num_elements = g1s.size();
+    std::vector<char> buffer;
+    for (size_t block_start = 0; block_start < num_elements;
+         block_start += G1_COMPRESSED_BLOCK_SIZE) {
+        const size_t block_size =
+            std::min(G1_COMPRESSED_BLOCK_SIZE, num_elements - block_start);
+        buffer.resize(block_size * element_size);
+
+        const size_t num_chunks =
+            (block_size + G1_COMPRESSED_CHUNK_SIZE - 1) /
+            G1_COMPRESSED_CHUNK_SIZE;
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const size_t chunk_start = chunk * G1_COMPRESSED_CHUNK_SIZE;
+            const size_t chunk_end =
+                std::min(chunk_start + G1_COMPRESSED_CHUNK_SIZE, block_size);
+            membuf_out chunk_buf(
+                buffer.data() + chunk_start * element_size,
+                buffer.data() + chunk_end * element_size);
+            std::ostream chunk_out(&chunk_buf);
+            for (size_t i = chunk_start; i < chunk_end; ++i) {
+                libff::alt_bn128_G1_write_compressed(
+                    chunk_out, g1s[block_start + i]);
+            }
+        }
+
+        out.write(buffer.data(), buffer.size());
+    }
+}
+
+} // namespace
+
 // Specialization of write_compressed, for the case where ppT == alt_bn128_pp.
 // Cannot be a generic template as it relies on calls that are specific to the
 // alt_bn128_pp types.
@@ -14,7 +134,6 @@ template<>
 void srs_mpc_phase2_accumulator<libff::alt_bn128_pp>::write_compressed(
     std::ostream &out) const
 {
-    using G1 = libff::alt_bn128_G1;
     check_well_formed(*this, "mpc_layer2 (write)");
 
     // Write cs_hash and sizes first.
@@ -27,12 +146,8 @@ void srs_mpc_phase2_accumulator<libff::alt_bn128_pp>::write_compressed(
 
     libff::alt_bn128_G1_write_compressed(out, delta_g1);
     libff::alt_bn128_G2_write_compressed(out, delta_g2);
-    for (const G1 &h : H_g1) {
-        libff::alt_bn128_G1_write_compressed(out, h);
-    }
-    for (const G1 &l : L_g1) {
-        libff::alt_bn128_G1_write_compressed(out, l);
-    }
+    g1_vector_write_compressed(out, H_g1);
+    g1_vector_write_compressed(out, L_g1);
 }
 
 // Specialization of read_compressed, for the case where ppT == alt_bn128_pp.
@@ -58,14 +173,10 @@ srs_mpc_phase2_accumulator<libff::alt_bn128_pp> srs_mpc_phase2_accumulator<
     libff::alt_bn128_G2_read_compressed(in, delta_g2);
 
     libff::G1_vector<libff::alt_bn128_pp> H_g1(H_size);
-    for (G1 &h : H_g1) {
-        libff::alt_bn128_G1_read_compressed(in, h);
-    }
+    g1_vector_read_compressed(in, H_g1);
 
     libff::G1_vector<libff::alt_bn128_pp> L_g1(L_size);
-    for (G1 &l : L_g1) {
-        libff::alt_bn128_G1_read_compressed(in, l);
-    }
+    g1_vector_read_compressed(in, L_g1);
 
     srs_mpc_phase2_accumulator<libff::alt_bn128_pp> l2(
         cs_hash, delta_g1, delta_g2, std::move(H_g1), std::move(L_g1));
@@ -8,6 +8,8 @@
 #include "libzeth/mpc/groth16/mpc_hash.hpp"
 #include "libzeth/snarks/groth16/groth16_snark.hpp"
 
+#include <functional>
+
 /// Structures and operations related to the "Phase 2" MPC described in
 /// [BoweGM17].  Parts of the implementation use techniques from the
 /// "Phase2" library from "zk-SNARK MPCs, made easy".
@@ -158,6 +160,24 @@ srs_mpc_phase2_accumulator<ppT> srs_mpc_phase2_begin(
     const srs_mpc_layer_L1<ppT> &layer_L1,
     size_t num_inputs);
 
+/// Streaming equivalent of
+///
+///   srs_mpc_phase2_initial_challenge(
+///       srs_mpc_phase2_begin(cs_hash, layer_L1, num_inputs)).write(out)
+///
+/// where `layer_L1_in` is a seekable stream holding a serialized
+/// srs_mpc_layer_L1. Only the T_tau_powers_g1 and ABC_g1 sections are read,
+/// one element at a time, and written directly to `out`. All other sections
+/// are skipped via seekg, so that neither layer_L1 nor the challenge is held
+/// in memory. The caller must supply cs_hash (the digest of the full
+/// serialized layer_L1).
+template<typename ppT>
+void srs_mpc_phase2_begin_write_challenge(
+    const mpc_hash_t cs_hash,
+    std::istream &layer_L1_in,
+    size_t num_inputs,
+    std::ostream &out);
+
 /// Outputs the public key (which includes the POK) for our secret. Correponds
 /// to steps 1 and 2 in "Computation", section 7.3 of [BoweGM17]
 template<typename ppT>
@@ -175,6 +195,18 @@ bool srs_mpc_phase2_verify_publickey(
     const libff::G1<ppT> last_delta_g1,
     const srs_mpc_phase2_publickey<ppT> &publickey);
 
+/// Verifies a sequence of public keys, in which each key applies a
+/// contribution to the `new_delta_g1` of the previous key (`initial_delta`
+/// in the case of the first key). Digests are NOT checked, so the caller must
+/// ensure that the transcript digests chain correctly. The pairing checks for
+/// each contribution are independent and are performed concurrently. Returns
+/// the index of the first invalid public key, or `publickeys.size()` if all
+/// public keys are valid.
+template<typename ppT>
+size_t srs_mpc_phase2_verify_publickeys(
+    const libff::G1<ppT> &initial_delta,
+    const std::vector<srs_mpc_phase2_publickey<ppT>> &publickeys);
+
 /// Core update function, which applies a secret contribution to an
 /// accumulator. Corresponds to steps 3 onwards in "Computation", section 7.3
 /// of [BoweGM17].
@@ -183,6 +215,18 @@ srs_mpc_phase2_accumulator<ppT> srs_mpc_phase2_update_accumulator(
     const srs_mpc_phase2_accumulator<ppT> &last_accum,
     const libff::Fr<ppT> &delta_j);
 
+/// Divide the entries [begin, end) of `g1s` by $\delta_j$ (given as its
+/// inverse), writing the results to the same entries of `out_g1s`. Performs
+/// the bulk of `srs_mpc_phase2_update_accumulator` for the H_g1 and L_g1
+/// vectors, allowing the update to be computed in chunks.
+template<typename ppT>
+void srs_mpc_phase2_update_range(
+    const libff::Fr<ppT> &delta_j_inverse,
+    const libff::G1_vector<ppT> &g1s,
+    size_t begin,
+    size_t end,
+    libff::G1_vector<ppT> &out_g1s);
+
 /// Assuming last is fully verified, and updated.delta_g1 has the appropriate
 /// ratio, check that all other elements of updated are correct. This covers
 /// the G2 part of step 2, and all of steps 3 and 4 of "Verification" in
@@ -223,6 +267,31 @@ srs_mpc_phase2_response<ppT> srs_mpc_phase2_compute_response(
     const srs_mpc_phase2_challenge<ppT> &challenge,
     const libff::Fr<ppT> &delta_j);
 
+/// Called by `srs_mpc_phase2_compute_response_chunked` after each chunk, with
+/// the number of completed entries.
+using srs_mpc_phase2_chunk_completed_fn = std::function<void(size_t)>;
+
+/// Resumable form of `srs_mpc_phase2_compute_response`. The entries of the
+/// new accumulator are computed in chunks of `chunk_size` consecutive entries
+/// of the combined index space of the H_g1 entries followed by the L_g1
+/// entries, and `chunk_completed` is called after each chunk (for example, to
+/// save progress). `publickey` must have been computed from `challenge` and
+/// `delta_j` (see `srs_mpc_phase2_compute_public_key`). `H_g1` and `L_g1` must
+/// have the sizes of the corresponding vectors in the challenge accumulator,
+/// and hold the results for the first `num_completed` entries. They are moved
+/// into the response once all entries are computed. The response does not
+/// depend on the chunk size, or on the point from which it is resumed.
+template<typename ppT>
+srs_mpc_phase2_response<ppT> srs_mpc_phase2_compute_response_chunked(
+    const srs_mpc_phase2_challenge<ppT> &challenge,
+    const libff::Fr<ppT> &delta_j,
+    srs_mpc_phase2_publickey<ppT> &&publickey,
+    libff::G1_vector<ppT> &H_g1,
+    libff::G1_vector<ppT> &L_g1,
+    size_t num_completed,
+    size_t chunk_size,
+    const srs_mpc_phase2_chunk_completed_fn &chunk_completed);
+
 /// Verify a response against a given challenge. Checks that the response
 /// matches the expected hash in the challenge, and leverages
 /// `srs_mpc_phase2_verify_update` to validate the claimed contribution.
@@ -253,7 +322,10 @@ srs_mpc_phase2_challenge<ppT> srs_mpc_phase2_compute_challenge(
 ///   accumulator, based on the final delta
 ///
 /// This function validates the transcript as a stream of publickey objects,
-/// outputing the encoding of the final delta in G1.
+/// outputing the encoding of the final delta in G1. The (cheap, sequential)
+/// digest chain is checked as the public keys are read, after which the
+/// pairing checks for all contributions are performed concurrently (see
+/// `srs_mpc_phase2_verify_publickeys`).
 template<typename ppT, bool enable_contribution_check = true>
 bool srs_mpc_phase2_verify_transcript(
     const mpc_hash_t initial_transcript_digest,
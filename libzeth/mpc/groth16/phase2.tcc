@@ -6,12 +6,16 @@
 #define __ZETH_MPC_GROTH16_PHASE2_TCC__
 
 #include "libzeth/core/chacha_rng.hpp"
+#include "libzeth/core/fixed_base_table.hpp"
 #include "libzeth/core/hash_stream.hpp"
+#include "libzeth/core/logging.hpp"
 #include "libzeth/core/utils.hpp"
 #include "libzeth/mpc/groth16/mpc_utils.hpp"
 #include "libzeth/mpc/groth16/phase2.hpp"
 #include "libzeth/mpc/groth16/powersoftau_utils.hpp"
 
+#include <algorithm>
+#include <sstream>
 #include <libff/common/rng.hpp>
 
 namespace libzeth
@@ -286,7 +290,7 @@ libff::G2<ppT> srs_mpc_digest_to_g2(const mpc_hash_t transcript_digest)
 {
     libff::Fr<ppT> fr;
     srs_mpc_digest_to_fp(transcript_digest, fr);
-    return fr * libff::G2<ppT>::one();
+    return g2_generator_table<ppT>().multiply(fr);
 }
 
 template<typename ppT>
@@ -295,17 +299,6 @@ srs_mpc_phase2_accumulator<ppT> srs_mpc_phase2_begin(
     const srs_mpc_layer_L1<ppT> &layer_L1,
     size_t num_inputs)
 {
-    // { H_i } = { [ t(x) . x^i / delta ]_1 } i = 0 .. n-2 (n-1 entries)
-    libff::enter_block("computing initial { H_i } i=0..n-2");
-    const size_t H_size = layer_L1.T_tau_powers_g1.size();
-    if (!libff::inhibit_profiling_info) {
-        libff::print_indent();
-        printf("%zu entries\n", H_size);
-    }
-    libff::G1_vector<ppT> H_g1(H_size);
-
-    libff::leave_block("computing H_g1");
-
     // In layer_L1 output, there should be num_variables+1 entries in
     // ABC_g1. Of these:
     //
@@ -314,15 +307,18 @@ srs_mpc_phase2_accumulator<ppT> srs_mpc_phase2_begin(
     //
     //  - The remaining num_variables-num_inputs entries will be
     //    divided by delta to create layer2.
-    const size_t num_variables = layer_L1.ABC_g1.size() - 1;
-    const size_t num_L_elements = num_variables - num_inputs;
-    // { L_i } = { [ ABC_i / delta ]_1 }, i = l+1 .. num_variables
-    libff::enter_block("computing L_g1");
+    //
+    // Since the initial delta is 1:
+    //
+    //   { H_i } = { [ t(x) . x^i ]_1 } i = 0 .. n-2 (n-1 entries)
+    //   { L_i } = { [ ABC_i ]_1 }, i = l+1 .. num_variables
     if (!libff::inhibit_profiling_info) {
         libff::print_indent();
-        printf("%zu entries\n", num_L_elements);
+        printf(
+            "%zu H entries, %zu L entries\n",
+            layer_L1.T_tau_powers_g1.size(),
+            layer_L1.ABC_g1.size() - num_inputs - 1);
     }
-    libff::G1_vector<ppT> L_g1(num_L_elements);
 
     return srs_mpc_phase2_accumulator<ppT>(
         cs_hash,
@@ -333,6 +329,85 @@ srs_mpc_phase2_accumulator<ppT> srs_mpc_phase2_begin(
             layer_L1.ABC_g1.begin() + num_inputs + 1, layer_L1.ABC_g1.end()));
 }
 
+// Size of the (uncompressed) serialization of group elements, which is
+// independent of the value of the element.
+template<typename GroupT> size_t srs_mpc_group_element_serialized_size()
+{
+    std::ostringstream ss;
+    ss << GroupT::one();
+    return ss.str().size();
+}
+
+// Read `num_entries` G1 elements from `in`, one at a time, and write them to
+// `out`.
+template<typename ppT>
+void srs_mpc_phase2_stream_g1s(
+    std::istream &in, const size_t num_entries, std::ostream &out)
+{
+    libff::G1<ppT> v;
+    for (size_t i = 0; i < num_entries; ++i) {
+        in >> v;
+        if (!v.is_well_formed()) {
+            throw std::invalid_argument("invalid G1 element in layer_L1");
+        }
+        out << v;
+    }
+}
+
+template<typename ppT>
+void srs_mpc_phase2_begin_write_challenge(
+    const mpc_hash_t cs_hash,
+    std::istream &layer_L1_in,
+    size_t num_inputs,
+    std::ostream &out)
+{
+    // Sizes, as written by srs_mpc_layer_L1::write.
+    size_t num_T_tau_powers;
+    size_t num_polynomials;
+    layer_L1_in.read((char *)&num_T_tau_powers, sizeof(num_T_tau_powers));
+    layer_L1_in.read((char *)&num_polynomials, sizeof(num_polynomials));
+    if (num_polynomials < num_inputs + 1) {
+        throw std::invalid_argument("too few polynomials in layer_L1");
+    }
+
+    const size_t H_size = num_T_tau_powers;
+    const size_t L_size = num_polynomials - num_inputs - 1;
+    if (!libff::inhibit_profiling_info) {
+        libff::print_indent();
+        printf("%zu H entries, %zu L entries\n", H_size, L_size);
+    }
+
+    // Write the headers of the challenge and accumulator, exactly as
+    // srs_mpc_phase2_challenge::write and srs_mpc_phase2_accumulator::write.
+    mpc_hash_t initial_transcript_digest;
+    mpc_compute_hash(initial_transcript_digest, cs_hash, sizeof(mpc_hash_t));
+    out.write((const char *)initial_transcript_digest, sizeof(mpc_hash_t));
+    out.write((const char *)cs_hash, sizeof(mpc_hash_t));
+    out.write((const char *)&H_size, sizeof(H_size));
+    out.write((const char *)&L_size, sizeof(L_size));
+    out << libff::G1<ppT>::one();
+    out << libff::G2<ppT>::one();
+
+    // { H_i } = { [ t(x) . x^i ]_1 }, streamed from T_tau_powers_g1.
+    libff::enter_block("streaming initial { H_i }");
+    srs_mpc_phase2_stream_g1s<ppT>(layer_L1_in, H_size, out);
+    libff::leave_block("streaming initial { H_i }");
+
+    // Skip A_g1, B_g1, B_g2 and the first num_inputs+1 entries of ABC_g1.
+    const size_t g1_size =
+        srs_mpc_group_element_serialized_size<libff::G1<ppT>>();
+    const size_t g2_size =
+        srs_mpc_group_element_serialized_size<libff::G2<ppT>>();
+    const size_t skip_size =
+        num_polynomials * (2 * g1_size + g2_size) + (num_inputs + 1) * g1_size;
+    layer_L1_in.seekg((std::streamoff)skip_size, std::ios_base::cur);
+
+    // { L_i } = { [ ABC_i ]_1 }, i = l+1 .. num_variables
+    libff::enter_block("streaming initial { L_i }");
+    srs_mpc_phase2_stream_g1s<ppT>(layer_L1_in, L_size, out);
+    libff::leave_block("streaming initial { L_i }");
+}
+
 template<typename ppT>
 srs_mpc_phase2_publickey<ppT> srs_mpc_phase2_compute_public_key(
     const mpc_hash_t transcript_digest,
@@ -351,29 +426,26 @@ srs_mpc_phase2_publickey<ppT> srs_mpc_phase2_compute_public_key(
         transcript_digest, new_delta_g1, s_g1, s_delta_j_g1, r_delta_j_g2);
 }
 
+// Add the checks for steps 1 and 2 from "Verification" in [BoweGM17] to
+// `checks`, without evaluating them.
 template<typename ppT>
-bool srs_mpc_phase2_verify_publickey(
-    const libff::G1<ppT> last_delta_g1,
+void srs_mpc_phase2_publickey_add_checks(
+    const libff::G1<ppT> &last_delta_g1,
     const srs_mpc_phase2_publickey<ppT> &publickey,
-    libff::G2<ppT> &out_r_g2)
+    same_ratio_accumulator<ppT> &checks)
 {
     const libff::G1<ppT> &s_g1 = publickey.s_g1;
     const libff::G1<ppT> &s_delta_j_g1 = publickey.s_delta_j_g1;
-    out_r_g2 = srs_mpc_digest_to_g2<ppT>(publickey.transcript_digest);
+    const libff::G2<ppT> r_g2 =
+        srs_mpc_digest_to_g2<ppT>(publickey.transcript_digest);
     const libff::G2<ppT> &r_delta_j_g2 = publickey.r_delta_j_g2;
     const libff::G1<ppT> &new_delta_g1 = publickey.new_delta_g1;
 
     // Step 1 (from [BoweGM17]). Check the proof of knowledge.
-    if (!same_ratio<ppT>(s_g1, s_delta_j_g1, out_r_g2, r_delta_j_g2)) {
-        return false;
-    }
+    checks.add(s_g1, s_delta_j_g1, r_g2, r_delta_j_g2);
 
     // Step 2. Check new_delta_g1 is correct.
-    if (!same_ratio<ppT>(last_delta_g1, new_delta_g1, out_r_g2, r_delta_j_g2)) {
-        return false;
-    }
-
-    return true;
+    checks.add(last_delta_g1, new_delta_g1, r_g2, r_delta_j_g2);
 }
 
 template<typename ppT>
@@ -381,8 +453,87 @@ bool srs_mpc_phase2_verify_publickey(
     const libff::G1<ppT> last_delta_g1,
     const srs_mpc_phase2_publickey<ppT> &publickey)
 {
-    libff::G2<ppT> r_g2;
-    return srs_mpc_phase2_verify_publickey<ppT>(last_delta_g1, publickey, r_g2);
+    // Both checks share the same G2 elements, and are evaluated as a single
+    // multi-pairing.
+    same_ratio_accumulator<ppT> checks;
+    srs_mpc_phase2_publickey_add_checks(last_delta_g1, publickey, checks);
+    return checks.check();
+}
+
+template<typename ppT>
+size_t srs_mpc_phase2_verify_publickeys(
+    const libff::G1<ppT> &initial_delta,
+    const std::vector<srs_mpc_phase2_publickey<ppT>> &publickeys)
+{
+    libff::enter_block("call to srs_mpc_phase2_verify_publickeys");
+    const size_t num_publickeys = publickeys.size();
+    if (!libff::inhibit_profiling_info) {
+        libff::print_indent();
+        printf("%zu contributions\n", num_publickeys);
+    }
+
+    // Each check depends only on the public key and the delta of the previous
+    // contribution, so the Miller loops for each contribution can be computed
+    // independently. Since the checks for each contribution are randomized,
+    // the product of all Miller loops can be checked with a single final
+    // exponentiation.
+    std::vector<libff::Fqk<ppT>> miller_loop_products(num_publickeys);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_t i = 0; i < num_publickeys; ++i) {
+        const libff::G1<ppT> &last_delta =
+            (0 == i) ? initial_delta : publickeys[i - 1].new_delta_g1;
+        same_ratio_accumulator<ppT> checks;
+        srs_mpc_phase2_publickey_add_checks(last_delta, publickeys[i], checks);
+        miller_loop_products[i] = checks.miller_loop_product();
+    }
+
+    libff::Fqk<ppT> product = libff::Fqk<ppT>::one();
+    for (const libff::Fqk<ppT> &f : miller_loop_products) {
+        product = product * f;
+    }
+
+    if (miller_loop_product_is_one<ppT>(product)) {
+        libff::leave_block("call to srs_mpc_phase2_verify_publickeys");
+        return num_publickeys;
+    }
+
+    // At least one contribution is invalid. Fall back to checking each
+    // contribution individually, keeping track of the lowest failing index
+    // so that the caller can identify the first invalid contribution.
+    size_t first_invalid = num_publickeys;
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic) reduction(min : first_invalid)
+#endif
+    for (size_t i = 0; i < num_publickeys; ++i) {
+        if (!miller_loop_product_is_one<ppT>(miller_loop_products[i])) {
+            first_invalid = std::min(first_invalid, i);
+        }
+    }
+
+    libff::leave_block("call to srs_mpc_phase2_verify_publickeys");
+    return first_invalid;
+}
+
+template<typename ppT>
+void srs_mpc_phase2_update_range(
+    const libff::Fr<ppT> &delta_j_inverse,
+    const libff::G1_vector<ppT> &g1s,
+    const size_t begin,
+    const size_t end,
+    libff::G1_vector<ppT> &out_g1s)
+{
+    if (end > g1s.size() || g1s.size() != out_g1s.size()) {
+        throw std::invalid_argument("invalid phase2 update range");
+    }
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = begin; i < end; ++i) {
+        out_g1s[i] = delta_j_inverse * g1s[i];
+    }
 }
 
 template<typename ppT>
@@ -406,12 +557,8 @@ srs_mpc_phase2_accumulator<ppT> srs_mpc_phase2_update_accumulator(
         printf("%zu entries\n", num_L_elements);
     }
     libff::G1_vector<ppT> L_g1(num_L_elements);
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_L_elements; ++i) {
-        L_g1[i] = delta_j_inverse * last_accum.L_g1[i];
-    }
+    srs_mpc_phase2_update_range<ppT>(
+        delta_j_inverse, last_accum.L_g1, 0, num_L_elements, L_g1);
     putchar('\n');
     libff::leave_block("updating L_g1");
 
@@ -423,12 +570,8 @@ srs_mpc_phase2_accumulator<ppT> srs_mpc_phase2_update_accumulator(
         printf("%zu entries\n", H_size);
     }
     libff::G1_vector<ppT> H_g1(H_size);
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < H_size; ++i) {
-        H_g1[i] = delta_j_inverse * last_accum.H_g1[i];
-    }
+    srs_mpc_phase2_update_range<ppT>(
+        delta_j_inverse, last_accum.H_g1, 0, H_size, H_g1);
     libff::leave_block("updating H_g1");
 
     libff::leave_block("call to srs_mpc_phase2_update_accumulator");
@@ -441,13 +584,16 @@ srs_mpc_phase2_accumulator<ppT> srs_mpc_phase2_update_accumulator(
         std::move(L_g1));
 }
 
+// Add the checks for steps 3 and 4 from "Verification" in [BoweGM17] (and the
+// consistency of delta_g1 and delta_g2 in `updated`) to `checks`, without
+// evaluating the pairings. Returns false if `last` and `updated` are not
+// compatible.
 template<typename ppT>
-bool srs_mpc_phase2_update_is_consistent(
+bool srs_mpc_phase2_update_add_checks(
     const srs_mpc_phase2_accumulator<ppT> &last,
-    const srs_mpc_phase2_accumulator<ppT> &updated)
+    const srs_mpc_phase2_accumulator<ppT> &updated,
+    same_ratio_accumulator<ppT> &checks)
 {
-    libff::enter_block("call to srs_mpc_phase2_update_is_consistent");
-
     // Check basic compatibility between 'last' and 'updated'
     if (memcmp(last.cs_hash, updated.cs_hash, sizeof(mpc_hash_t)) ||
         last.H_g1.size() != updated.H_g1.size() ||
@@ -459,49 +605,59 @@ bool srs_mpc_phase2_update_is_consistent(
     const libff::G2<ppT> &new_delta_g2 = updated.delta_g2;
 
     // Check that, that the delta_g1 and delta_2 ratios match.
-    if (!same_ratio<ppT>(
-            last.delta_g1, updated.delta_g1, old_delta_g2, new_delta_g2)) {
-        return false;
-    }
+    checks.add(last.delta_g1, updated.delta_g1, old_delta_g2, new_delta_g2);
 
     // Step 3. Check that the updates to L values are consistent. Each
     // entry should have been divided by $\delta_j$, so SameRatio((updated,
     // last), (old_delta_g2, new_delta_g2)) should hold.
-    if (!same_ratio_vectors<ppT>(
-            updated.L_g1, last.L_g1, old_delta_g2, new_delta_g2)) {
-        return false;
-    }
+    checks.add_vectors(updated.L_g1, last.L_g1, old_delta_g2, new_delta_g2);
 
     // Step 4. Similar consistency checks for H
-    if (!same_ratio_vectors<ppT>(
-            updated.H_g1, last.H_g1, old_delta_g2, new_delta_g2)) {
-        return false;
-    }
-
-    libff::leave_block("call to srs_mpc_phase2_update_is_consistent");
+    checks.add_vectors(updated.H_g1, last.H_g1, old_delta_g2, new_delta_g2);
 
     return true;
 }
 
+template<typename ppT>
+bool srs_mpc_phase2_update_is_consistent(
+    const srs_mpc_phase2_accumulator<ppT> &last,
+    const srs_mpc_phase2_accumulator<ppT> &updated)
+{
+    libff::enter_block("call to srs_mpc_phase2_update_is_consistent");
+
+    // All checks share the same G2 elements, and are evaluated as a single
+    // multi-pairing.
+    same_ratio_accumulator<ppT> checks;
+    const bool consistent =
+        srs_mpc_phase2_update_add_checks(last, updated, checks) &&
+        checks.check();
+
+    libff::leave_block("call to srs_mpc_phase2_update_is_consistent");
+    return consistent;
+}
+
 template<typename ppT>
 bool srs_mpc_phase2_verify_update(
     const srs_mpc_phase2_accumulator<ppT> &last,
     const srs_mpc_phase2_accumulator<ppT> &updated,
     const srs_mpc_phase2_publickey<ppT> &publickey)
 {
-    // Step 1 and 2 (from [BoweGM17]). Check the proof-of-knowledge in the
-    // public key, and the updated delta value. Obtain r_g2 to avoid
-    // recomputing it.
-    libff::G2<ppT> r_g2;
-    if (!srs_mpc_phase2_verify_publickey(last.delta_g1, publickey, r_g2)) {
+    if (publickey.new_delta_g1 != updated.delta_g1) {
         return false;
     }
 
-    if (publickey.new_delta_g1 != updated.delta_g1) {
+    // Collect all checks for the contribution, namely steps 1 and 2 (from
+    // [BoweGM17]) for the proof-of-knowledge in the public key and the
+    // updated delta value, and steps 3 and 4 for the consistency of the
+    // accumulators. These are evaluated as a single multi-pairing requiring
+    // 4 Miller loops and 1 final exponentiation.
+    same_ratio_accumulator<ppT> checks;
+    srs_mpc_phase2_publickey_add_checks(last.delta_g1, publickey, checks);
+    if (!srs_mpc_phase2_update_add_checks(last, updated, checks)) {
         return false;
     }
 
-    return srs_mpc_phase2_update_is_consistent(last, updated);
+    return checks.check();
 }
 
 template<typename ppT>
@@ -528,11 +684,85 @@ srs_mpc_phase2_response<ppT> srs_mpc_phase2_compute_response(
             delta_j);
     libff::leave_block("computing contribution public key");
 
-    srs_mpc_phase2_accumulator<ppT> new_accum =
-        srs_mpc_phase2_update_accumulator(challenge.accumulator, delta_j);
+    // Compute all entries as a single chunk
+    const srs_mpc_phase2_accumulator<ppT> &last = challenge.accumulator;
+    const size_t num_entries = last.H_g1.size() + last.L_g1.size();
+    libff::G1_vector<ppT> H_g1(last.H_g1.size());
+    libff::G1_vector<ppT> L_g1(last.L_g1.size());
+    return srs_mpc_phase2_compute_response_chunked<ppT>(
+        challenge,
+        delta_j,
+        std::move(pubkey),
+        H_g1,
+        L_g1,
+        0,
+        std::max<size_t>(num_entries, 1),
+        [](size_t) {});
+}
 
-    return srs_mpc_phase2_response<ppT>(
-        std::move(new_accum), std::move(pubkey));
+template<typename ppT>
+srs_mpc_phase2_response<ppT> srs_mpc_phase2_compute_response_chunked(
+    const srs_mpc_phase2_challenge<ppT> &challenge,
+    const libff::Fr<ppT> &delta_j,
+    srs_mpc_phase2_publickey<ppT> &&publickey,
+    libff::G1_vector<ppT> &H_g1,
+    libff::G1_vector<ppT> &L_g1,
+    const size_t num_completed,
+    const size_t chunk_size,
+    const srs_mpc_phase2_chunk_completed_fn &chunk_completed)
+{
+    const srs_mpc_phase2_accumulator<ppT> &last = challenge.accumulator;
+    const size_t H_size = last.H_g1.size();
+    const size_t num_entries = H_size + last.L_g1.size();
+    if (H_g1.size() != H_size || L_g1.size() != last.L_g1.size() ||
+        num_completed > num_entries || chunk_size == 0) {
+        throw std::invalid_argument("invalid phase2 response state");
+    }
+
+    libff::enter_block("call to srs_mpc_phase2_compute_response_chunked");
+    if (!libff::inhibit_profiling_info) {
+        libff::print_indent();
+        printf("%zu / %zu entries completed\n", num_completed, num_entries);
+    }
+
+    // Steps 3 and 5 (from [BoweGM17]): Divide the $H_i$ and $L_i$ by our
+    // contribution.
+    const libff::Fr<ppT> delta_j_inverse = delta_j.inverse();
+    for (size_t begin = num_completed; begin < num_entries;) {
+        const size_t end = std::min(begin + chunk_size, num_entries);
+        if (begin < H_size) {
+            srs_mpc_phase2_update_range<ppT>(
+                delta_j_inverse,
+                last.H_g1,
+                begin,
+                std::min(end, H_size),
+                H_g1);
+        }
+        if (end > H_size) {
+            srs_mpc_phase2_update_range<ppT>(
+                delta_j_inverse,
+                last.L_g1,
+                std::max(begin, H_size) - H_size,
+                end - H_size,
+                L_g1);
+        }
+        chunk_completed(end);
+        begin = end;
+    }
+
+    // Step 3: Update accumulated $\delta$ (`publickey.new_delta_g1` holds the
+    // updated $\delta$ in G1).
+    const libff::G1<ppT> new_delta_g1 = publickey.new_delta_g1;
+    srs_mpc_phase2_response<ppT> response(
+        srs_mpc_phase2_accumulator<ppT>(
+            last.cs_hash,
+            new_delta_g1,
+            delta_j * last.delta_g2,
+            std::move(H_g1),
+            std::move(L_g1)),
+        std::move(publickey));
+    libff::leave_block("call to srs_mpc_phase2_compute_response_chunked");
+    return response;
 }
 
 template<typename ppT>
@@ -575,11 +805,13 @@ bool srs_mpc_phase2_verify_transcript(
 {
     mpc_hash_t digest;
     memcpy(digest, initial_transcript_digest, sizeof(mpc_hash_t));
-    libff::G1<ppT> delta = initial_delta;
 
+    // Read all public keys, checking the digest chain as we go. The pairing
+    // checks are deferred until the full transcript has been read.
+    std::vector<srs_mpc_phase2_publickey<ppT>> publickeys;
     bool contribution_found = false;
     while (EOF != transcript_stream.peek()) {
-        const srs_mpc_phase2_publickey<ppT> publickey =
+        srs_mpc_phase2_publickey<ppT> publickey =
             srs_mpc_phase2_publickey<ppT>::read(transcript_stream);
 
         const bool digests_match =
@@ -594,15 +826,18 @@ bool srs_mpc_phase2_verify_transcript(
             contribution_found = true;
         }
 
-        if (!srs_mpc_phase2_verify_publickey(delta, publickey)) {
-            return false;
-        }
+        publickeys.push_back(std::move(publickey));
+    }
 
-        // Contribution is valid. Update state and read next publickey.
-        delta = publickey.new_delta_g1;
+    const size_t first_invalid =
+        srs_mpc_phase2_verify_publickeys<ppT>(initial_delta, publickeys);
+    if (first_invalid != publickeys.size()) {
+        ZETH_LOG(error) << "invalid contribution at index " << first_invalid;
+        return false;
     }
 
-    out_final_delta = delta;
+    out_final_delta =
+        publickeys.empty() ? initial_delta : publickeys.back().new_delta_g1;
     memcpy(out_final_transcript_digest, digest, sizeof(mpc_hash_t));
     if (enable_contribution_check) {
         out_contribution_found = contribution_found;
@@ -165,6 +165,77 @@ bool same_ratio_consecutive(
     const libff::G1<ppT> &b1,
     const std::vector<libff::G2<ppT>> &a2s);
 
+/// Collects a number of SameRatio equations, so that they can all be checked
+/// with a single multi-pairing. Each equation (a1, b1), (a2, b2) (see
+/// `same_ratio` above) is scaled by a random factor r and added as the pair
+/// of terms (r * a1, b2) and (-r * b1, a2). All equations hold (with high
+/// probability) iff the product of e(g1_i, g2_i) over all terms is 1. Terms
+/// that share a G2 element are merged by adding their G1 elements, so that
+/// only one Miller loop is required per distinct G2 element, and only one
+/// final exponentiation is required in total.
+template<typename ppT> class same_ratio_accumulator
+{
+public:
+    same_ratio_accumulator();
+
+    /// Add the equation checked by `same_ratio`.
+    void add(
+        const libff::G1<ppT> &a1,
+        const libff::G1<ppT> &b1,
+        const libff::G2<ppT> &a2,
+        const libff::G2<ppT> &b2);
+
+    /// Add the equations checked by `same_ratio_vectors` (G1 vectors).
+    void add_vectors(
+        const std::vector<libff::G1<ppT>> &a1s,
+        const std::vector<libff::G1<ppT>> &b1s,
+        const libff::G2<ppT> &a2,
+        const libff::G2<ppT> &b2);
+
+    /// Add the equations checked by `same_ratio_vectors` (G2 vectors).
+    void add_vectors(
+        const libff::G1<ppT> &a1,
+        const libff::G1<ppT> &b1,
+        const std::vector<libff::G2<ppT>> &a2s,
+        const std::vector<libff::G2<ppT>> &b2s);
+
+    /// Add the equations checked by `same_ratio_consecutive` (G1 vector).
+    void add_consecutive(
+        const std::vector<libff::G1<ppT>> &a1s,
+        const libff::G2<ppT> &a2,
+        const libff::G2<ppT> &b2);
+
+    /// Add the equations checked by `same_ratio_consecutive` (G2 vector).
+    void add_consecutive(
+        const libff::G1<ppT> &a1,
+        const libff::G1<ppT> &b1,
+        const std::vector<libff::G2<ppT>> &a2s);
+
+    /// Number of Miller loops required to evaluate the accumulated terms.
+    size_t num_terms() const;
+
+    /// The product of Miller loops over all accumulated terms (before the
+    /// final exponentiation). Products from several accumulators can be
+    /// multiplied together and checked with a single final exponentiation.
+    libff::Fqk<ppT> miller_loop_product() const;
+
+    /// Returns true if (with high probability) all accumulated equations
+    /// hold.
+    bool check() const;
+
+private:
+    void add_term(const libff::G1<ppT> &g1, const libff::G2<ppT> &g2);
+
+    libff::G1_vector<ppT> g1_terms;
+    libff::G2_vector<ppT> g2_terms;
+};
+
+/// Returns true if the product of Miller loops `f` (as returned by
+/// `same_ratio_accumulator::miller_loop_product`) is 1 after the final
+/// exponentiation.
+template<typename ppT>
+bool miller_loop_product_is_one(const libff::Fqk<ppT> &f);
+
 /// Verify that the pot data is well formed.
 template<typename ppT>
 bool powersoftau_is_well_formed(const srs_powersoftau<ppT> &pot);
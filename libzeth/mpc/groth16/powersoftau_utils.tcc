@@ -5,11 +5,10 @@
 #ifndef __ZETH_MPC_GROTH16_POWERSOFTAU_UTILS_TCC__
 #define __ZETH_MPC_GROTH16_POWERSOFTAU_UTILS_TCC__
 
+#include "libzeth/core/fixed_base_table.hpp"
 #include "libzeth/core/utils.hpp"
 #include "libzeth/mpc/groth16/powersoftau_utils.hpp"
 
-#include <thread>
-
 namespace libzeth
 {
 
@@ -150,12 +149,14 @@ bool same_ratio(
     const libff::Fqk<ppT> a1b2 = ppT::miller_loop(a1_precomp, b2_precomp);
     const libff::Fqk<ppT> b1a2 = ppT::miller_loop(b1_precomp, a2_precomp);
 
-    const libff::GT<ppT> a1b2_gt = ppT::final_exponentiation(a1b2);
-    const libff::GT<ppT> b1a2_gt = ppT::final_exponentiation(b1a2);
-
     // Decide whether ratio a1:b1 in G1 equals a2:b2 in G2 by checking:
     //   e(a1, b2) =?= e(b1, a2)
-    return a1b2_gt == b1a2_gt;
+    // or equivalently:
+    //   e(a1, b2) / e(b1, a2) =?= 1
+    // which requires a single final exponentiation.
+    const libff::GT<ppT> ratio_gt =
+        ppT::final_exponentiation(a1b2 * b1a2.inverse());
+    return ratio_gt == libff::GT<ppT>::one();
 }
 
 template<typename ppT>
@@ -250,6 +251,133 @@ bool same_ratio_consecutive(
     return same;
 }
 
+// -----------------------------------------------------------------------------
+// same_ratio_accumulator
+// -----------------------------------------------------------------------------
+
+template<typename ppT>
+same_ratio_accumulator<ppT>::same_ratio_accumulator() : g1_terms(), g2_terms()
+{
+}
+
+template<typename ppT>
+void same_ratio_accumulator<ppT>::add(
+    const libff::G1<ppT> &a1,
+    const libff::G1<ppT> &b1,
+    const libff::G2<ppT> &a2,
+    const libff::G2<ppT> &b2)
+{
+    // e(a1, b2) == e(b1, a2)  <=>  e(r * a1, b2) . e(-r * b1, a2) == 1
+    const libff::Fr<ppT> r = libff::Fr<ppT>::random_element();
+    add_term(r * a1, b2);
+    add_term(-(r * b1), a2);
+}
+
+template<typename ppT>
+void same_ratio_accumulator<ppT>::add_vectors(
+    const std::vector<libff::G1<ppT>> &a1s,
+    const std::vector<libff::G1<ppT>> &b1s,
+    const libff::G2<ppT> &a2,
+    const libff::G2<ppT> &b2)
+{
+    libff::G1<ppT> a1_accum;
+    libff::G1<ppT> b1_accum;
+    random_linear_combination<ppT>(a1s, b1s, a1_accum, b1_accum);
+    add(a1_accum, b1_accum, a2, b2);
+}
+
+template<typename ppT>
+void same_ratio_accumulator<ppT>::add_vectors(
+    const libff::G1<ppT> &a1,
+    const libff::G1<ppT> &b1,
+    const std::vector<libff::G2<ppT>> &a2s,
+    const std::vector<libff::G2<ppT>> &b2s)
+{
+    libff::G2<ppT> a2_accum;
+    libff::G2<ppT> b2_accum;
+    random_linear_combination<ppT>(a2s, b2s, a2_accum, b2_accum);
+    add(a1, b1, a2_accum, b2_accum);
+}
+
+template<typename ppT>
+void same_ratio_accumulator<ppT>::add_consecutive(
+    const std::vector<libff::G1<ppT>> &a1s,
+    const libff::G2<ppT> &a2,
+    const libff::G2<ppT> &b2)
+{
+    libff::G1<ppT> a1_accum;
+    libff::G1<ppT> b1_accum;
+    random_linear_combination_consecutive<ppT>(a1s, a1_accum, b1_accum);
+    add(a1_accum, b1_accum, a2, b2);
+}
+
+template<typename ppT>
+void same_ratio_accumulator<ppT>::add_consecutive(
+    const libff::G1<ppT> &a1,
+    const libff::G1<ppT> &b1,
+    const std::vector<libff::G2<ppT>> &a2s)
+{
+    libff::G2<ppT> a2_accum;
+    libff::G2<ppT> b2_accum;
+    random_linear_combination_consecutive<ppT>(a2s, a2_accum, b2_accum);
+    add(a1, b1, a2_accum, b2_accum);
+}
+
+template<typename ppT> size_t same_ratio_accumulator<ppT>::num_terms() const
+{
+    return g2_terms.size();
+}
+
+template<typename ppT>
+libff::Fqk<ppT> same_ratio_accumulator<ppT>::miller_loop_product() const
+{
+    libff::Fqk<ppT> product = libff::Fqk<ppT>::one();
+    for (size_t i = 0; i < g2_terms.size(); ++i) {
+        // e(0, Q) = e(P, 0) = 1, so zero terms can be skipped. (The
+        // precomputation does not handle the point at infinity.)
+        if (g1_terms[i].is_zero() || g2_terms[i].is_zero()) {
+            continue;
+        }
+
+        const libff::G1_precomp<ppT> g1_precomp =
+            ppT::precompute_G1(g1_terms[i]);
+        const libff::G2_precomp<ppT> g2_precomp =
+            ppT::precompute_G2(g2_terms[i]);
+        product = product * ppT::miller_loop(g1_precomp, g2_precomp);
+    }
+
+    return product;
+}
+
+template<typename ppT> bool same_ratio_accumulator<ppT>::check() const
+{
+    return miller_loop_product_is_one<ppT>(miller_loop_product());
+}
+
+template<typename ppT>
+void same_ratio_accumulator<ppT>::add_term(
+    const libff::G1<ppT> &g1, const libff::G2<ppT> &g2)
+{
+    // e(a, Q) . e(b, Q) = e(a + b, Q), so merge with any existing term for
+    // the same G2 element. The number of distinct G2 elements is expected to
+    // be small, so a linear search is sufficient.
+    for (size_t i = 0; i < g2_terms.size(); ++i) {
+        if (g2_terms[i] == g2) {
+            g1_terms[i] = g1_terms[i] + g1;
+            return;
+        }
+    }
+
+    g1_terms.push_back(g1);
+    g2_terms.push_back(g2);
+}
+
+template<typename ppT>
+bool miller_loop_product_is_one(const libff::Fqk<ppT> &f)
+{
+    return ppT::final_exponentiation(f) == libff::GT<ppT>::one();
+}
+
 // -----------------------------------------------------------------------------
 // powersoftau
 // -----------------------------------------------------------------------------
@@ -304,86 +432,41 @@ srs_powersoftau<ppT> dummy_powersoftau_from_secrets(
     }
     libff::leave_block("tau powers");
 
-    libff::enter_block("window tables");
-    const size_t window_size = libff::get_exp_window_size<libff::G1<ppT>>(n);
-    const size_t window_size_tau_g1 =
-        libff::get_exp_window_size<libff::G1<ppT>>(2 * n - 1);
-
-    libff::window_table<libff::G1<ppT>> tau_g1_table;
-    libff::window_table<libff::G2<ppT>> tau_g2_table;
-    libff::window_table<libff::G1<ppT>> alpha_tau_g1_table;
-    libff::window_table<libff::G1<ppT>> beta_tau_g1_table;
-    {
-        std::thread tau_g1_table_thread([&tau_g1_table, window_size_tau_g1]() {
-            tau_g1_table = libff::get_window_table(
-                libff::G1<ppT>::size_in_bits(),
-                window_size_tau_g1,
-                libff::G1<ppT>::one());
-        });
-
-        std::thread tau_g2_table_thread([&tau_g2_table, window_size]() {
-            tau_g2_table = libff::get_window_table(
-                libff::G2<ppT>::size_in_bits(),
-                window_size,
-                libff::G2<ppT>::one());
-        });
-
-        std::thread alpha_tau_g1_table_thread(
-            [&alpha_tau_g1_table, window_size, alpha]() {
-                alpha_tau_g1_table = libff::get_window_table(
-                    libff::G1<ppT>::size_in_bits(),
-                    window_size,
-                    alpha * libff::G1<ppT>::one());
-            });
-
-        std::thread beta_tau_g1_table_thread(
-            [&beta_tau_g1_table, window_size, beta]() {
-                beta_tau_g1_table = libff::get_window_table(
-                    libff::G1<ppT>::size_in_bits(),
-                    window_size,
-                    beta * libff::G1<ppT>::one());
-            });
-
-        tau_g1_table_thread.join();
-        tau_g2_table_thread.join();
-        alpha_tau_g1_table_thread.join();
-        beta_tau_g1_table_thread.join();
+    // All outputs are multiples of the generators, so use the shared
+    // generator tables rather than building a table per base.
+    libff::enter_block("alpha_tau and beta_tau scalars");
+    std::vector<libff::Fr<ppT>> alpha_tau_powers(n);
+    std::vector<libff::Fr<ppT>> beta_tau_powers(n);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < n; ++i) {
+        alpha_tau_powers[i] = alpha * tau_powers[i];
+        beta_tau_powers[i] = beta * tau_powers[i];
     }
-    libff::leave_block("window tables");
+    libff::leave_block("alpha_tau and beta_tau scalars");
+
+    libff::enter_block("generator tables");
+    const fixed_base_table<libff::G1<ppT>, libff::Fr<ppT>> &g1_table =
+        g1_generator_table<ppT>();
+    const fixed_base_table<libff::G2<ppT>, libff::Fr<ppT>> &g2_table =
+        g2_generator_table<ppT>();
+    libff::leave_block("generator tables");
 
     libff::enter_block("tau_g1 powers");
-    tau_powers_g1 = libff::batch_exp(
-        libff::G1<ppT>::size_in_bits(),
-        window_size_tau_g1,
-        tau_g1_table,
-        tau_powers);
+    tau_powers_g1 = g1_table.batch_multiply(tau_powers);
     libff::leave_block("tau_g1 powers");
 
     libff::enter_block("tau_g2 powers");
-    tau_powers_g2 = libff::batch_exp(
-        libff::G2<ppT>::size_in_bits(),
-        window_size,
-        tau_g2_table,
-        tau_powers,
-        n);
+    tau_powers_g2 = g2_table.batch_multiply(tau_powers, n);
     libff::leave_block("tau_g2 powers");
 
     libff::enter_block("alpha_tau_g1 powers");
-    alpha_tau_powers_g1 = libff::batch_exp(
-        libff::G1<ppT>::size_in_bits(),
-        window_size,
-        alpha_tau_g1_table,
-        tau_powers,
-        n);
+    alpha_tau_powers_g1 = g1_table.batch_multiply(alpha_tau_powers);
     libff::leave_block("alpha_tau_g1 powers");
 
     libff::enter_block("beta_tau_g1 powers");
-    beta_tau_powers_g1 = libff::batch_exp(
-        libff::G1<ppT>::size_in_bits(),
-        window_size,
-        beta_tau_g1_table,
-        tau_powers,
-        n);
+    beta_tau_powers_g1 = g1_table.batch_multiply(beta_tau_powers);
     libff::leave_block("beta_tau_g1 powers");
 
     libff::leave_block("dummy_phase1_from_secrets");
@@ -392,7 +475,7 @@ srs_powersoftau<ppT> dummy_powersoftau_from_secrets(
         std::move(tau_powers_g2),
         std::move(alpha_tau_powers_g1),
         std::move(beta_tau_powers_g1),
-        beta * libff::G2<ppT>::one());
+        g2_table.multiply(beta));
 }
 
 template<typename ppT> srs_powersoftau<ppT> dummy_powersoftau(size_t n)
@@ -0,0 +1,297 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/serialization/debug_artifact_sink.hpp"
+
+#include "libzeth/core/logging.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+#include <stdio.h>
+#include <vector>
+
+namespace libzeth
+{
+
+namespace
+{
+
+// Request identifiers are of the form:
+//
+//   <YYYYmmdd>T<HHMMSS>.<mmm>Z-<sequence number>-<kind>
+//
+// so that the files of the ring sort in the order they were written.
+const size_t timestamp_length = 20;
+
+std::string current_timestamp()
+{
+    const std::chrono::system_clock::time_point now =
+        std::chrono::system_clock::now();
+    const std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+    const unsigned millis =
+        (unsigned)(std::chrono::duration_cast<std::chrono::milliseconds>(
+                       now.time_since_epoch())
+                       .count() %
+                   1000);
+
+    std::tm utc;
+    gmtime_r(&seconds, &utc);
+    char buffer[32];
+    const size_t size =
+        std::strftime(buffer, sizeof(buffer), "%Y%m%dT%H%M%S", &utc);
+    snprintf(buffer + size, sizeof(buffer) - size, ".%03uZ", millis);
+    return std::string(buffer);
+}
+
+bool is_artifact_file_name(const std::string &name)
+{
+    if (name.size() <= timestamp_length + 1 ||
+        name[timestamp_length] != '-' || name[8] != 'T' || name[15] != '.' ||
+        name[19] != 'Z') {
+        return false;
+    }
+    for (size_t i = 0; i < 15; ++i) {
+        if (i != 8 && !std::isdigit((unsigned char)name[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string request_name(uint64_t sequence_number, const std::string &kind)
+{
+    char sequence[24];
+    snprintf(
+        sequence,
+        sizeof(sequence),
+        "%08llu",
+        (unsigned long long)sequence_number);
+    return current_timestamp() + "-" + sequence + "-" + kind;
+}
+
+void check_sample_rate(double sample_rate)
+{
+    if (!(sample_rate >= 0.0 && sample_rate <= 1.0)) {
+        throw std::invalid_argument("sample rate must be in [0, 1]");
+    }
+}
+
+} // namespace
+
+const size_t debug_artifact_sink::default_max_bytes;
+const size_t debug_artifact_sink::default_max_pending;
+
+debug_artifact_sink::debug_artifact_sink(
+    const boost::filesystem::path &directory,
+    bool enabled,
+    double sample_rate,
+    size_t max_bytes,
+    size_t max_pending)
+    : directory(directory)
+    , max_bytes(max_bytes)
+    , max_pending(max_pending)
+    , enabled(enabled)
+    , sample_rate(sample_rate)
+    , num_requests(0)
+    , num_dropped_artifacts(0)
+    , num_queued(0)
+    , num_written(0)
+    , stopping(false)
+    , ring_bytes(0)
+{
+    check_sample_rate(sample_rate);
+    boost::filesystem::create_directories(directory);
+
+    // Files written by a previous instance are part of the ring
+    std::vector<ring_file> existing;
+    for (boost::filesystem::directory_iterator it(directory), end; it != end;
+         ++it) {
+        const boost::filesystem::path &path = it->path();
+        if (boost::filesystem::is_regular_file(path) &&
+            is_artifact_file_name(path.filename().string())) {
+            existing.push_back(
+                {path, (size_t)boost::filesystem::file_size(path)});
+        }
+    }
+    std::sort(
+        existing.begin(),
+        existing.end(),
+        [](const ring_file &a, const ring_file &b) {
+            return a.path.filename() < b.path.filename();
+        });
+    for (const ring_file &f : existing) {
+        add_to_ring(f.path, f.size);
+    }
+
+    writer_thread = std::thread(&debug_artifact_sink::run, this);
+}
+
+debug_artifact_sink::~debug_artifact_sink()
+{
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    queue_changed.notify_all();
+    writer_thread.join();
+}
+
+void debug_artifact_sink::set_enabled(bool enabled)
+{
+    this->enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool debug_artifact_sink::is_enabled() const
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void debug_artifact_sink::set_sample_rate(double sample_rate)
+{
+    check_sample_rate(sample_rate);
+    this->sample_rate.store(sample_rate, std::memory_order_relaxed);
+}
+
+double debug_artifact_sink::get_sample_rate() const
+{
+    return sample_rate.load(std::memory_order_relaxed);
+}
+
+std::string debug_artifact_sink::begin_request(const std::string &kind)
+{
+    if (!is_enabled()) {
+        return "";
+    }
+
+    // The n-th request is recorded if it increments floor(n * sample_rate)
+    const double rate = get_sample_rate();
+    const uint64_t n = num_requests.fetch_add(1, std::memory_order_relaxed);
+    if (std::floor((double)(n + 1) * rate) <= std::floor((double)n * rate)) {
+        return "";
+    }
+
+    return request_name(n, kind);
+}
+
+std::string debug_artifact_sink::begin_unsampled_request(
+    const std::string &kind)
+{
+    if (!is_enabled()) {
+        return "";
+    }
+
+    return request_name(
+        num_requests.fetch_add(1, std::memory_order_relaxed), kind);
+}
+
+bool debug_artifact_sink::write(
+    const std::string &request,
+    const std::string &name,
+    artifact_writer writer)
+{
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (queue.size() >= max_pending) {
+            num_dropped_artifacts.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        queue.push_back(
+            {directory / (request + "-" + name), std::move(writer)});
+        ++num_queued;
+    }
+    queue_changed.notify_all();
+    return true;
+}
+
+void debug_artifact_sink::flush()
+{
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    const uint64_t target = num_queued;
+    queue_changed.wait(
+        lock, [this, target]() { return num_written >= target; });
+}
+
+size_t debug_artifact_sink::num_bytes() const
+{
+    return ring_bytes.load(std::memory_order_relaxed);
+}
+
+size_t debug_artifact_sink::num_dropped() const
+{
+    return num_dropped_artifacts.load(std::memory_order_relaxed);
+}
+
+void debug_artifact_sink::run()
+{
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    for (;;) {
+        queue_changed.wait(
+            lock, [this]() { return stopping || !queue.empty(); });
+        if (queue.empty()) {
+            // Stopping, and all artifacts have been written
+            return;
+        }
+
+        const artifact a = std::move(queue.front());
+        queue.pop_front();
+        lock.unlock();
+        write_artifact(a);
+        lock.lock();
+
+        ++num_written;
+        queue_changed.notify_all();
+    }
+}
+
+void debug_artifact_sink::write_artifact(const artifact &a)
+{
+    // Write to a temporary file which is renamed into place, so that
+    // incomplete artifacts are never visible in the directory.
+    const boost::filesystem::path tmp_path = a.path.string() + ".tmp";
+    try {
+        {
+            std::ofstream out(tmp_path.c_str());
+            out.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+            a.writer(out);
+        }
+        boost::filesystem::rename(tmp_path, a.path);
+        add_to_ring(a.path, (size_t)boost::filesystem::file_size(a.path));
+        ZETH_LOG(debug) << "Wrote debug artifact " << a.path;
+    } catch (const std::exception &e) {
+        num_dropped_artifacts.fetch_add(1, std::memory_order_relaxed);
+        ZETH_LOG(warning) << "Failed to write debug artifact " << a.path
+                          << ": " << e.what();
+        boost::system::error_code ec;
+        boost::filesystem::remove(tmp_path, ec);
+    }
+}
+
+void debug_artifact_sink::add_to_ring(
+    const boost::filesystem::path &path, size_t size)
+{
+    ring.push_back({path, size});
+    size_t total = ring_bytes.load(std::memory_order_relaxed) + size;
+
+    // Delete the oldest files until the ring is within its bound
+    while (total > max_bytes && !ring.empty()) {
+        const ring_file &oldest = ring.front();
+        boost::system::error_code ec;
+        boost::filesystem::remove(oldest.path, ec);
+        if (ec) {
+            ZETH_LOG(warning) << "Failed to remove debug artifact "
+                              << oldest.path << ": " << ec.message();
+        }
+        total -= oldest.size;
+        ring.pop_front();
+    }
+
+    ring_bytes.store(total, std::memory_order_relaxed);
+}
+
+} // namespace libzeth
@@ -0,0 +1,145 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_SERIALIZATION_DEBUG_ARTIFACT_SINK_HPP__
+#define __ZETH_SERIALIZATION_DEBUG_ARTIFACT_SINK_HPP__
+
+#include <atomic>
+#include <boost/filesystem.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+namespace libzeth
+{
+
+/// Writes debugging artifacts (proofs, inputs, constraint systems, ...) to a
+/// directory, from a background thread. Artifacts are grouped by request:
+///
+///   const std::string request = sink.begin_request("prove");
+///   if (!request.empty()) {
+///       sink.write(request, "proof.json", [ext_proof](std::ostream &out) {
+///           ext_proof.write_json(out);
+///       });
+///   }
+///
+/// Only a sample of the requests is recorded (see `begin_request`), and the
+/// files of the recorded requests are named after the request, so that
+/// concurrent requests never write to the same file. The directory is used as
+/// a ring: once the files written by the sink exceed `max_bytes`, the oldest
+/// ones are deleted. Artifacts are dropped (rather than blocking the caller)
+/// if `max_pending` artifacts are already waiting to be written.
+class debug_artifact_sink
+{
+public:
+    /// Writes the content of an artifact. Called on the background thread,
+    /// so it must own (copies of) the data it writes.
+    using artifact_writer = std::function<void(std::ostream &)>;
+
+    static const size_t default_max_bytes = 256 * 1024 * 1024;
+    static const size_t default_max_pending = 64;
+
+    /// Files already in `directory` with the sink's naming scheme are treated
+    /// as part of the ring. Throws `std::invalid_argument` if `sample_rate` is
+    /// not in [0, 1].
+    debug_artifact_sink(
+        const boost::filesystem::path &directory,
+        bool enabled,
+        double sample_rate = 1.0,
+        size_t max_bytes = default_max_bytes,
+        size_t max_pending = default_max_pending);
+    debug_artifact_sink(const debug_artifact_sink &) = delete;
+    debug_artifact_sink &operator=(const debug_artifact_sink &) = delete;
+
+    /// Writes all pending artifacts before returning.
+    ~debug_artifact_sink();
+
+    /// Enable or disable recording. Safe to call from any thread, and from
+    /// signal handlers.
+    void set_enabled(bool enabled);
+    bool is_enabled() const;
+
+    /// Set the fraction of the requests to record. Throws
+    /// `std::invalid_argument` if `sample_rate` is not in [0, 1].
+    void set_sample_rate(double sample_rate);
+    double get_sample_rate() const;
+
+    /// Decide whether to record the current request. Returns an identifier,
+    /// unique to the request and starting with the time of the call, for use
+    /// in `write`, or an empty string if the request is not recorded.
+    /// Requests are selected deterministically, so that `sample_rate * n`
+    /// out of any `n` consecutive requests are recorded.
+    std::string begin_request(const std::string &kind);
+
+    /// As `begin_request`, but ignoring the sample rate (for example, for
+    /// one-off artifacts). Returns an empty string if the sink is disabled.
+    std::string begin_unsampled_request(const std::string &kind);
+
+    /// Queue an artifact of a recorded request, to be written to
+    /// `<directory>/<request>-<name>`. Returns false if the artifact was
+    /// dropped.
+    bool write(
+        const std::string &request,
+        const std::string &name,
+        artifact_writer writer);
+
+    /// Wait until all artifacts queued before the call have been written.
+    void flush();
+
+    /// Total size of the files in the ring.
+    size_t num_bytes() const;
+
+    /// Number of artifacts dropped because the queue was full, or because
+    /// they could not be written.
+    size_t num_dropped() const;
+
+private:
+    struct artifact {
+        boost::filesystem::path path;
+        artifact_writer writer;
+    };
+
+    struct ring_file {
+        boost::filesystem::path path;
+        size_t size;
+    };
+
+    void run();
+    void write_artifact(const artifact &a);
+    void add_to_ring(const boost::filesystem::path &path, size_t size);
+
+    const boost::filesystem::path directory;
+    const size_t max_bytes;
+    const size_t max_pending;
+
+    std::atomic<bool> enabled;
+    std::atomic<double> sample_rate;
+    std::atomic<uint64_t> num_requests;
+    std::atomic<uint64_t> num_dropped_artifacts;
+
+    // Queue of artifacts, and state of the writer thread, protected by
+    // `queue_mutex`.
+    std::mutex queue_mutex;
+    std::condition_variable queue_changed;
+    std::deque<artifact> queue;
+    uint64_t num_queued;
+    uint64_t num_written;
+    bool stopping;
+
+    // Files in the ring, oldest first. Only accessed by the writer thread
+    // after construction, except for the total size.
+    std::deque<ring_file> ring;
+    std::atomic<size_t> ring_bytes;
+
+    std::thread writer_thread;
+};
+
+} // namespace libzeth
+
+#endif // __ZETH_SERIALIZATION_DEBUG_ARTIFACT_SINK_HPP__
@@ -5,6 +5,7 @@
 #ifndef __ZETH_SERIALIZATION_PROTO_UTILS_TCC__
 #define __ZETH_SERIALIZATION_PROTO_UTILS_TCC__
 
+#include "libzeth/core/logging.hpp"
 #include "libzeth/serialization/proto_utils.hpp"
 
 #include <cassert>
@@ -22,8 +23,8 @@ zeth_proto::HexPointBaseGroup1Affine point_g1_affine_to_proto(
     aff.to_affine_coordinates();
 
     zeth_proto::HexPointBaseGroup1Affine res;
-    res.set_x_coord("0x" + field_element_to_hex<Fq>(aff.X));
-    res.set_y_coord("0x" + field_element_to_hex<Fq>(aff.Y));
+    res.set_x_coord(field_element_to_prefixed_hex<Fq>(aff.X));
+    res.set_y_coord(field_element_to_prefixed_hex<Fq>(aff.Y));
     return res;
 }
 
@@ -48,10 +49,10 @@ zeth_proto::HexPointBaseGroup2Affine point_g2_affine_to_proto(
     aff.to_affine_coordinates();
 
     zeth_proto::HexPointBaseGroup2Affine res;
-    res.set_x_c0_coord("0x" + field_element_to_hex<Fq>(aff.X.c0));
-    res.set_x_c1_coord("0x" + field_element_to_hex<Fq>(aff.X.c1));
-    res.set_y_c0_coord("0x" + field_element_to_hex<Fq>(aff.Y.c0));
-    res.set_y_c1_coord("0x" + field_element_to_hex<Fq>(aff.Y.c1));
+    res.set_x_c0_coord(field_element_to_prefixed_hex<Fq>(aff.X.c0));
+    res.set_x_c1_coord(field_element_to_prefixed_hex<Fq>(aff.X.c1));
+    res.set_y_c0_coord(field_element_to_prefixed_hex<Fq>(aff.Y.c0));
+    res.set_y_c1_coord(field_element_to_prefixed_hex<Fq>(aff.Y.c1));
 
     return res;
 }
@@ -91,12 +92,12 @@ joinsplit_input<FieldT, TreeDepth> joinsplit_input_from_proto(
         FieldT mk_node = field_element_from_hex<FieldT>(input.merkle_path(i));
         input_merkle_path.push_back(mk_node);
     }
-    std::cout << "parse joinsplit_input from proto" << std::endl;
+    ZETH_LOG(trace) << "Parse joinsplit_input from proto";
     std::array<bool, TreeDepth> address_bits = bits_addr_from_size_t<TreeDepth>(input.address());
     zeth_note note = zeth_note_from_proto(input.note());
     bits254 key = bits254_from_hex(input.spending_ask());
     bits254 nullifier = bits254_from_hex(input.nullifier());
-    std::cout << "nullifier: " << input.nullifier() << std::endl;
+    ZETH_LOG(trace) << "nullifier: " << input.nullifier();
     return joinsplit_input<FieldT, TreeDepth>(
         input_merkle_path,
         address_bits,
@@ -109,13 +110,18 @@ template<typename ppT>
 std::string primary_inputs_to_string(
     const std::vector<libff::Fr<ppT>> &public_inputs)
 {
+    using FieldT = libff::Fr<ppT>;
+    const size_t hex_size =
+        2 * sizeof(libff::bigint<FieldT::num_limbs>::data);
+    char hex[hex_size];
+
     std::stringstream ss;
     ss << "[";
     for (size_t i = 0; i < public_inputs.size(); ++i) {
-        ss << "\"0x"
-           << libzeth::bigint_to_hex<libff::Fr<ppT>>(
-                  public_inputs[i].as_bigint())
-           << "\"";
+        bigint_write_hex<FieldT>(public_inputs[i].as_bigint(), hex);
+        ss << "\"0x";
+        ss.write(hex, hex_size);
+        ss << "\"";
         if (i < public_inputs.size() - 1) {
             ss << ", ";
         }
@@ -154,7 +160,7 @@ libsnark::accumulation_vector<libff::G1<ppT>> accumulation_vector_from_string(
     char *cstr = new char[acc_vector_str.length() + 1];
     std::strcpy(cstr, acc_vector_str.c_str());
     char *pos;
-    printf("Splitting string \"%s\" into tokens:\n", cstr);
+    ZETH_LOG(trace) << "Splitting string \"" << cstr << "\" into tokens";
 
     std::vector<std::string> res;
     pos = strtok(cstr, "[, ]");
@@ -174,9 +180,8 @@ libsnark::accumulation_vector<libff::G1<ppT>> accumulation_vector_from_string(
     // points
     if (res.size() > 0 && res.size() % 2 != 0) {
         // TODO: Do exception throwing/catching properly
-        std::cerr
-            << "accumulation_vector_from_string: Wrong number of coordinates"
-            << std::endl;
+        ZETH_LOG(error)
+            << "accumulation_vector_from_string: Wrong number of coordinates";
         exit(1);
     }
 
@@ -5,7 +5,14 @@
 #ifndef __ZETH_SERIALIZATION_R1CS_SERIALIZATION_HPP__
 #define __ZETH_SERIALIZATION_R1CS_SERIALIZATION_HPP__
 
+#include "libzeth/core/include_libff.hpp"
+#include "libzeth/core/include_libsnark.hpp"
+
+#include <istream>
+#include <libsnark/gadgetlib1/protoboard.hpp>
+#include <map>
 #include <ostream>
+#include <string>
 
 namespace libzeth
 {
@@ -14,6 +21,109 @@ template<typename ppT>
 std::ostream &r1cs_write_json(
     const libsnark::protoboard<libff::Fr<ppT>> &pb, std::ostream &s);
 
+/// Compact binary R1CS format. All integers are unsigned LEB128 varints.
+///
+///   magic ("zr1c"), version
+///   num_inputs, num_variables, num_constraints
+///   for each constraint, for each of A, B, C:
+///     num_terms
+///     for each term: variable index, coefficient reference
+///
+/// Each distinct coefficient is written in full (as its little-endian
+/// bigint representation) only once, at its first use, which is encoded as
+/// the reference 0. Later uses of the coefficient are encoded as the
+/// reference i+1, where i is its position in the table of coefficients seen
+/// so far. Encodings are canonical (independent of annotations and of the
+/// libff output configuration), so may also be hashed to identify circuits.
+const char R1CS_COMPACT_MAGIC[4] = {'z', 'r', '1', 'c'};
+const size_t R1CS_COMPACT_VERSION = 1;
+
+/// Streaming writer for the compact R1CS format. Constraints are written one
+/// at a time, so that the full constraint system need not be held in memory.
+template<typename FieldT> class r1cs_compact_writer
+{
+private:
+    std::ostream &out;
+    const size_t num_constraints;
+    size_t num_constraints_written;
+    std::map<std::string, size_t> coefficient_indices;
+
+public:
+    r1cs_compact_writer(
+        std::ostream &out,
+        size_t num_inputs,
+        size_t num_variables,
+        size_t num_constraints);
+
+    void write_constraint(const libsnark::r1cs_constraint<FieldT> &constraint);
+
+    /// Check that the expected number of constraints has been written.
+    void finish() const;
+
+private:
+    void write_linear_combination(
+        const libsnark::linear_combination<FieldT> &lc);
+};
+
+/// Reader for the compact R1CS format, operating directly on a buffer (for
+/// example, a memory-mapped file). Constraints are decoded one at a time.
+template<typename FieldT> class r1cs_compact_reader
+{
+private:
+    const uint8_t *cur;
+    const uint8_t *const end;
+    size_t num_inputs_;
+    size_t num_variables_;
+    size_t num_constraints_;
+    size_t num_constraints_read;
+    std::vector<FieldT> coefficients;
+
+public:
+    /// Parse the header. `data` must remain valid for the lifetime of the
+    /// reader.
+    r1cs_compact_reader(const void *data, size_t size);
+
+    size_t num_inputs() const;
+    size_t num_variables() const;
+    size_t num_constraints() const;
+
+    /// Decode the next constraint into `out`. Returns false once all
+    /// constraints have been read.
+    bool next_constraint(libsnark::r1cs_constraint<FieldT> &out);
+
+    /// Number of bytes of the buffer not yet decoded.
+    size_t bytes_remaining() const;
+
+private:
+    size_t read_varint();
+    FieldT read_coefficient();
+    void read_linear_combination(libsnark::linear_combination<FieldT> &lc);
+};
+
+/// Write a full constraint system in the compact format.
+template<typename FieldT>
+std::ostream &r1cs_write_compact(
+    const libsnark::r1cs_constraint_system<FieldT> &r1cs, std::ostream &os);
+
+/// Read a full constraint system from a buffer holding the compact format
+/// (and nothing else). Throws `std::invalid_argument` if the data is
+/// malformed, truncated, or followed by trailing bytes.
+template<typename FieldT>
+libsnark::r1cs_constraint_system<FieldT> r1cs_read_compact(
+    const void *data, size_t size);
+
+/// Read a full constraint system in the compact format from the rest of a
+/// stream. The encoded data is held in memory while decoding, so prefer
+/// `r1cs_read_compact_file` for large circuits.
+template<typename FieldT>
+libsnark::r1cs_constraint_system<FieldT> r1cs_read_compact(std::istream &in);
+
+/// Read a full constraint system in the compact format from a file, which is
+/// memory-mapped rather than copied into memory.
+template<typename FieldT>
+libsnark::r1cs_constraint_system<FieldT> r1cs_read_compact_file(
+    const std::string &file_name);
+
 } // namespace libzeth
 
 #include "libzeth/serialization/r1cs_serialization.tcc"
@@ -7,6 +7,14 @@
 
 #include "libzeth/serialization/r1cs_serialization.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
 namespace libzeth
 {
 
@@ -36,6 +44,16 @@ void constraints_write_json(
     ss << "]";
 }
 
+// Unsigned LEB128 encoding, 7 bits per byte, least significant first.
+inline void r1cs_compact_write_varint(std::ostream &out, size_t value)
+{
+    while (value >= 0x80) {
+        out.put((char)(uint8_t)((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.put((char)(uint8_t)value);
+}
+
 } // namespace
 
 template<typename ppT>
@@ -96,6 +114,316 @@ std::ostream &r1cs_write_json(
     return os;
 }
 
+template<typename FieldT>
+r1cs_compact_writer<FieldT>::r1cs_compact_writer(
+    std::ostream &out,
+    size_t num_inputs,
+    size_t num_variables,
+    size_t num_constraints)
+    : out(out)
+    , num_constraints(num_constraints)
+    , num_constraints_written(0)
+    , coefficient_indices()
+{
+    if (num_inputs > num_variables) {
+        throw std::invalid_argument("more inputs than variables");
+    }
+
+    out.write(R1CS_COMPACT_MAGIC, sizeof(R1CS_COMPACT_MAGIC));
+    r1cs_compact_write_varint(out, R1CS_COMPACT_VERSION);
+    r1cs_compact_write_varint(out, num_inputs);
+    r1cs_compact_write_varint(out, num_variables);
+    r1cs_compact_write_varint(out, num_constraints);
+}
+
+template<typename FieldT>
+void r1cs_compact_writer<FieldT>::write_constraint(
+    const libsnark::r1cs_constraint<FieldT> &constraint)
+{
+    if (num_constraints_written == num_constraints) {
+        throw std::invalid_argument("too many constraints");
+    }
+
+    write_linear_combination(constraint.a);
+    write_linear_combination(constraint.b);
+    write_linear_combination(constraint.c);
+    ++num_constraints_written;
+}
+
+template<typename FieldT> void r1cs_compact_writer<FieldT>::finish() const
+{
+    if (num_constraints_written != num_constraints) {
+        throw std::invalid_argument("too few constraints");
+    }
+}
+
+template<typename FieldT>
+void r1cs_compact_writer<FieldT>::write_linear_combination(
+    const libsnark::linear_combination<FieldT> &lc)
+{
+    r1cs_compact_write_varint(out, lc.terms.size());
+    for (const libsnark::linear_term<FieldT> &lt : lc.terms) {
+        r1cs_compact_write_varint(out, lt.index);
+
+        const libff::bigint<FieldT::num_limbs> coeff = lt.coeff.as_bigint();
+        const std::string coeff_bytes(
+            (const char *)coeff.data, sizeof(coeff.data));
+        const std::map<std::string, size_t>::const_iterator it =
+            coefficient_indices.find(coeff_bytes);
+        if (it != coefficient_indices.end()) {
+            r1cs_compact_write_varint(out, it->second + 1);
+        } else {
+            const size_t index = coefficient_indices.size();
+            coefficient_indices.emplace(coeff_bytes, index);
+            r1cs_compact_write_varint(out, 0);
+            out.write(coeff_bytes.data(), coeff_bytes.size());
+        }
+    }
+}
+
+template<typename FieldT>
+r1cs_compact_reader<FieldT>::r1cs_compact_reader(const void *data, size_t size)
+    : cur((const uint8_t *)data)
+    , end((const uint8_t *)data + size)
+    , num_inputs_(0)
+    , num_variables_(0)
+    , num_constraints_(0)
+    , num_constraints_read(0)
+    , coefficients()
+{
+    if (size < sizeof(R1CS_COMPACT_MAGIC) ||
+        0 != memcmp(cur, R1CS_COMPACT_MAGIC, sizeof(R1CS_COMPACT_MAGIC))) {
+        throw std::invalid_argument("invalid r1cs magic");
+    }
+    cur += sizeof(R1CS_COMPACT_MAGIC);
+
+    if (read_varint() != R1CS_COMPACT_VERSION) {
+        throw std::invalid_argument("unsupported r1cs version");
+    }
+
+    num_inputs_ = read_varint();
+    num_variables_ = read_varint();
+    num_constraints_ = read_varint();
+    if (num_inputs_ > num_variables_) {
+        throw std::invalid_argument("more inputs than variables");
+    }
+}
+
+template<typename FieldT>
+size_t r1cs_compact_reader<FieldT>::num_inputs() const
+{
+    return num_inputs_;
+}
+
+template<typename FieldT>
+size_t r1cs_compact_reader<FieldT>::num_variables() const
+{
+    return num_variables_;
+}
+
+template<typename FieldT>
+size_t r1cs_compact_reader<FieldT>::num_constraints() const
+{
+    return num_constraints_;
+}
+
+template<typename FieldT>
+bool r1cs_compact_reader<FieldT>::next_constraint(
+    libsnark::r1cs_constraint<FieldT> &out)
+{
+    if (num_constraints_read == num_constraints_) {
+        return false;
+    }
+
+    read_linear_combination(out.a);
+    read_linear_combination(out.b);
+    read_linear_combination(out.c);
+    ++num_constraints_read;
+    return true;
+}
+
+template<typename FieldT>
+size_t r1cs_compact_reader<FieldT>::bytes_remaining() const
+{
+    return (size_t)(end - cur);
+}
+
+template<typename FieldT> size_t r1cs_compact_reader<FieldT>::read_varint()
+{
+    const size_t num_bits = 8 * sizeof(size_t);
+    size_t value = 0;
+    for (size_t shift = 0; shift < num_bits; shift += 7) {
+        if (cur == end) {
+            throw std::invalid_argument("unexpected end of r1cs data");
+        }
+        const uint8_t byte = *cur++;
+        // Reject bits which do not fit in a size_t (in the last group)
+        if (shift + 7 > num_bits &&
+            ((byte & 0x7f) >> (num_bits - shift)) != 0) {
+            throw std::invalid_argument("varint overflow in r1cs data");
+        }
+        value |= ((size_t)(byte & 0x7f)) << shift;
+        if (0 == (byte & 0x80)) {
+            return value;
+        }
+    }
+
+    throw std::invalid_argument("invalid varint in r1cs data");
+}
+
+template<typename FieldT>
+FieldT r1cs_compact_reader<FieldT>::read_coefficient()
+{
+    const size_t ref = read_varint();
+    if (ref != 0) {
+        if (ref > coefficients.size()) {
+            throw std::invalid_argument("invalid coefficient reference");
+        }
+        return coefficients[ref - 1];
+    }
+
+    libff::bigint<FieldT::num_limbs> coeff;
+    if ((size_t)(end - cur) < sizeof(coeff.data)) {
+        throw std::invalid_argument("unexpected end of r1cs data");
+    }
+    memcpy(coeff.data, cur, sizeof(coeff.data));
+    cur += sizeof(coeff.data);
+
+    // Reject non-canonical (unreduced) encodings.
+    const FieldT value(coeff);
+    if (!(value.as_bigint() == coeff)) {
+        throw std::invalid_argument("invalid coefficient in r1cs data");
+    }
+
+    coefficients.push_back(value);
+    return value;
+}
+
+template<typename FieldT>
+void r1cs_compact_reader<FieldT>::read_linear_combination(
+    libsnark::linear_combination<FieldT> &lc)
+{
+    const size_t num_terms = read_varint();
+    // Each term occupies at least 2 bytes, which bounds the allocation below
+    // for malformed inputs.
+    if (num_terms > (size_t)(end - cur) / 2) {
+        throw std::invalid_argument("unexpected end of r1cs data");
+    }
+
+    lc.terms.clear();
+    lc.terms.reserve(num_terms);
+    for (size_t i = 0; i < num_terms; ++i) {
+        const size_t index = read_varint();
+        if (index > num_variables_) {
+            throw std::invalid_argument("invalid variable index");
+        }
+        const FieldT coeff = read_coefficient();
+        lc.terms.emplace_back(libsnark::variable<FieldT>(index), coeff);
+    }
+}
+
+template<typename FieldT>
+std::ostream &r1cs_write_compact(
+    const libsnark::r1cs_constraint_system<FieldT> &r1cs, std::ostream &os)
+{
+    r1cs_compact_writer<FieldT> writer(
+        os, r1cs.num_inputs(), r1cs.num_variables(), r1cs.num_constraints());
+    for (const libsnark::r1cs_constraint<FieldT> &constraint :
+         r1cs.constraints) {
+        writer.write_constraint(constraint);
+    }
+    writer.finish();
+    return os;
+}
+
+template<typename FieldT>
+libsnark::r1cs_constraint_system<FieldT> r1cs_read_compact(
+    const void *data, size_t size)
+{
+    r1cs_compact_reader<FieldT> reader(data, size);
+
+    libsnark::r1cs_constraint_system<FieldT> r1cs;
+    r1cs.primary_input_size = reader.num_inputs();
+    r1cs.auxiliary_input_size = reader.num_variables() - reader.num_inputs();
+
+    // Each constraint occupies at least 3 bytes (the term counts of A, B and
+    // C), which bounds the allocation below for malformed inputs.
+    if (reader.num_constraints() > reader.bytes_remaining() / 3) {
+        throw std::invalid_argument("unexpected end of r1cs data");
+    }
+    r1cs.constraints.reserve(reader.num_constraints());
+
+    libsnark::r1cs_constraint<FieldT> constraint;
+    while (reader.next_constraint(constraint)) {
+        r1cs.constraints.push_back(constraint);
+    }
+
+    if (reader.bytes_remaining() != 0) {
+        throw std::invalid_argument("trailing data after r1cs");
+    }
+
+    return r1cs;
+}
+
+template<typename FieldT>
+libsnark::r1cs_constraint_system<FieldT> r1cs_read_compact(std::istream &in)
+{
+    // Read the remaining data in blocks, growing the buffer geometrically
+    // (rather than via a string, which may end up with twice the capacity
+    // required).
+    const size_t block_size = 1 << 20;
+    std::vector<char> data;
+    size_t size = 0;
+    while (in) {
+        if (data.size() - size < block_size) {
+            data.resize(std::max(2 * data.size(), size + block_size));
+        }
+        in.read(&data[size], data.size() - size);
+        size += (size_t)in.gcount();
+    }
+    if (in.bad()) {
+        throw std::invalid_argument("failed to read r1cs data");
+    }
+
+    return r1cs_read_compact<FieldT>(data.data(), size);
+}
+
+template<typename FieldT>
+libsnark::r1cs_constraint_system<FieldT> r1cs_read_compact_file(
+    const std::string &file_name)
+{
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::invalid_argument("failed to open file: " + file_name);
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        throw std::invalid_argument("failed to stat file: " + file_name);
+    }
+    const size_t size = (size_t)file_stat.st_size;
+    if (size == 0) {
+        close(fd);
+        return r1cs_read_compact<FieldT>("", 0);
+    }
+
+    void *const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw std::invalid_argument("failed to map file: " + file_name);
+    }
+
+    try {
+        libsnark::r1cs_constraint_system<FieldT> r1cs =
+            r1cs_read_compact<FieldT>(data, size);
+        munmap(data, size);
+        return r1cs;
+    } catch (...) {
+        munmap(data, size);
+        throw;
+    }
+}
+
 } // namespace libzeth
 
 #endif // __ZETH_SERIALIZATION_R1CS_SERIALIZATION_TCC__
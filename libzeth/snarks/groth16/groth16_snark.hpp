@@ -5,18 +5,45 @@
 #ifndef __ZETH_SNARKS_GROTH16_GROTH16_SNARK_HPP__
 #define __ZETH_SNARKS_GROTH16_GROTH16_SNARK_HPP__
 
+#include "libzeth/core/extended_proof.hpp"
+
+#include <libff/algebra/scalar_multiplication/multiexp.hpp>
 #include <libsnark/gadgetlib1/protoboard.hpp>
 #include <libsnark/zk_proof_systems/ppzksnark/r1cs_gg_ppzksnark/r1cs_gg_ppzksnark.hpp>
 
 namespace libzeth
 {
 
+/// Verification key with precomputed data for its fixed elements: the G2
+/// precomputations used in Miller loops, the pairing $e(\alpha, \beta)$, and
+/// fixed-base window tables for the ABC_g1 entries. Derived once from a
+/// verification key, and reused across verifications.
+template<typename ppT> class groth16_prepared_verification_key
+{
+public:
+    /// Window size for the ABC_g1 tables
+    static const size_t abc_window_size = 8;
+
+    libsnark::r1cs_gg_ppzksnark_verification_key<ppT> vk;
+    libff::GT<ppT> alpha_g1_beta_g2;
+    libff::G2_precomp<ppT> generator_g2_precomp;
+    libff::G2_precomp<ppT> delta_g2_precomp;
+
+    /// Window tables for the entries of vk.ABC_g1.rest.values
+    std::vector<libff::window_table<libff::G1<ppT>>> ABC_g1_tables;
+
+    explicit groth16_prepared_verification_key(
+        const libsnark::r1cs_gg_ppzksnark_verification_key<ppT>
+            &verification_key);
+};
+
 /// Core types and operations for the GROTH16 snark
 template<typename ppT> class groth16_snark
 {
 public:
     typedef libsnark::r1cs_gg_ppzksnark_proving_key<ppT> ProvingKeyT;
     typedef libsnark::r1cs_gg_ppzksnark_verification_key<ppT> VerificationKeyT;
+    typedef groth16_prepared_verification_key<ppT> PreparedVerificationKeyT;
     typedef libsnark::r1cs_gg_ppzksnark_keypair<ppT> KeypairT;
     typedef libsnark::r1cs_gg_ppzksnark_proof<ppT> ProofT;
 
@@ -24,17 +51,60 @@ public:
     static KeypairT generate_setup(
         const libsnark::protoboard<libff::Fr<ppT>> &pb);
 
+    /// Run the trusted setup and return the keypair for a constraint system
+    static KeypairT generate_setup(
+        const libsnark::r1cs_constraint_system<libff::Fr<ppT>> &cs);
+
     /// Generate the proof
     static ProofT generate_proof(
         const libsnark::protoboard<libff::Fr<ppT>> &pb,
         const ProvingKeyT &proving_key);
 
+    /// Generate the proof for the given primary and auxiliary inputs (for
+    /// proving keys generated from a constraint system which does not
+    /// correspond directly to a protoboard).
+    static ProofT generate_proof(
+        const ProvingKeyT &proving_key,
+        const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_input,
+        const libsnark::r1cs_auxiliary_input<libff::Fr<ppT>> &auxiliary_input);
+
     /// Verify proof
     static bool verify(
         const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_inputs,
         const ProofT &proof,
         const VerificationKeyT &verification_key);
 
+    /// Compute the prepared form of a verification key
+    static PreparedVerificationKeyT prepare_verification_key(
+        const VerificationKeyT &verification_key);
+
+    /// Verify proof using a prepared verification key
+    static bool verify(
+        const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_inputs,
+        const ProofT &proof,
+        const PreparedVerificationKeyT &prepared_verification_key);
+
+    /// Verify a batch of proofs against a single verification key. Proofs
+    /// are combined using random scalars and checked with a single
+    /// multi-pairing (N+3 Miller loops and one final exponentiation). If the
+    /// combined check fails, the batch is bisected to locate the invalid
+    /// proofs. Returns true if all proofs are valid. Otherwise, the indices
+    /// of invalid proofs are written to `out_invalid_indices`, in increasing
+    /// order.
+    static bool verify_batch(
+        const std::vector<extended_proof<ppT, groth16_snark<ppT>>>
+            &ext_proofs,
+        const VerificationKeyT &verification_key,
+        std::vector<size_t> &out_invalid_indices);
+
+    /// Verify a batch of proofs using a prepared verification key (see
+    /// above).
+    static bool verify_batch(
+        const std::vector<extended_proof<ppT, groth16_snark<ppT>>>
+            &ext_proofs,
+        const PreparedVerificationKeyT &prepared_verification_key,
+        std::vector<size_t> &out_invalid_indices);
+
     /// Write verification as json
     static std::ostream &verification_key_write_json(
         const VerificationKeyT &, std::ostream &);
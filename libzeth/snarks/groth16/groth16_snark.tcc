@@ -6,19 +6,28 @@
 #define __ZETH_SNARKS_GROTH16_GROTH16_SNARK_TCC__
 
 #include "libzeth/core/group_element_utils.hpp"
+#include "libzeth/core/multi_exp.hpp"
 #include "libzeth/core/utils.hpp"
 #include "libzeth/snarks/groth16/groth16_snark.hpp"
 
+#include <algorithm>
+
 namespace libzeth
 {
 
 template<typename ppT>
 typename groth16_snark<ppT>::KeypairT groth16_snark<ppT>::generate_setup(
     const libsnark::protoboard<libff::Fr<ppT>> &pb)
+{
+    return generate_setup(pb.get_constraint_system());
+}
+
+template<typename ppT>
+typename groth16_snark<ppT>::KeypairT groth16_snark<ppT>::generate_setup(
+    const libsnark::r1cs_constraint_system<libff::Fr<ppT>> &cs)
 {
     // Generate verification and proving key from the R1CS
-    return libsnark::r1cs_gg_ppzksnark_generator<ppT>(
-        pb.get_constraint_system(), true);
+    return libsnark::r1cs_gg_ppzksnark_generator<ppT>(cs, true);
 }
 
 template<typename ppT>
@@ -26,11 +35,16 @@ typename groth16_snark<ppT>::ProofT groth16_snark<ppT>::generate_proof(
     const libsnark::protoboard<libff::Fr<ppT>> &pb,
     const typename groth16_snark<ppT>::ProvingKeyT &proving_key)
 {
-    libsnark::r1cs_primary_input<libff::Fr<ppT>> primary_input =
-        pb.primary_input();
-    libsnark::r1cs_auxiliary_input<libff::Fr<ppT>> auxiliary_input =
-        pb.auxiliary_input();
+    return generate_proof(
+        proving_key, pb.primary_input(), pb.auxiliary_input());
+}
 
+template<typename ppT>
+typename groth16_snark<ppT>::ProofT groth16_snark<ppT>::generate_proof(
+    const typename groth16_snark<ppT>::ProvingKeyT &proving_key,
+    const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_input,
+    const libsnark::r1cs_auxiliary_input<libff::Fr<ppT>> &auxiliary_input)
+{
     // Generate proof from public input, auxiliary input and proving key.
     // For now, force a pow2 domain, in case the key came from the MPC.
     libsnark::r1cs_gg_ppzksnark_proof<ppT> proof =
@@ -50,6 +64,244 @@ bool groth16_snark<ppT>::verify(
         verification_key, primary_inputs, proof);
 }
 
+template<typename ppT>
+groth16_prepared_verification_key<ppT>::groth16_prepared_verification_key(
+    const libsnark::r1cs_gg_ppzksnark_verification_key<ppT> &verification_key)
+    : vk(verification_key)
+    , alpha_g1_beta_g2(ppT::reduced_pairing(vk.alpha_g1, vk.beta_g2))
+    , generator_g2_precomp(ppT::precompute_G2(libff::G2<ppT>::one()))
+    , delta_g2_precomp(ppT::precompute_G2(vk.delta_g2))
+    , ABC_g1_tables(vk.ABC_g1.rest.values.size())
+{
+    const size_t scalar_size = libff::Fr<ppT>::size_in_bits();
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < ABC_g1_tables.size(); ++i) {
+        ABC_g1_tables[i] = libff::get_window_table(
+            scalar_size, abc_window_size, vk.ABC_g1.rest.values[i]);
+    }
+}
+
+template<typename ppT>
+typename groth16_snark<ppT>::PreparedVerificationKeyT groth16_snark<
+    ppT>::prepare_verification_key(const VerificationKeyT &verification_key)
+{
+    return PreparedVerificationKeyT(verification_key);
+}
+
+template<typename ppT>
+bool groth16_snark<ppT>::verify(
+    const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_inputs,
+    const groth16_snark<ppT>::ProofT &proof,
+    const groth16_snark<ppT>::PreparedVerificationKeyT &pvk)
+{
+    using G1 = libff::G1<ppT>;
+
+    // Same checks as r1cs_gg_ppzksnark_verifier_strong_IC, using the
+    // precomputed values:
+    //
+    //   e(A, B) = e(alpha, beta) . e(acc, g2) . e(C, delta)
+    //
+    // where acc = ABC_0 + sum_j x_j . ABC_j.
+    if (primary_inputs.size() != pvk.vk.ABC_g1.domain_size() ||
+        !proof.is_well_formed()) {
+        return false;
+    }
+
+    const size_t scalar_size = libff::Fr<ppT>::size_in_bits();
+    const libsnark::sparse_vector<G1> &abc_rest = pvk.vk.ABC_g1.rest;
+    G1 acc = pvk.vk.ABC_g1.first;
+    for (size_t k = 0; k < abc_rest.indices.size(); ++k) {
+        acc = acc + libff::windowed_exp(
+                        scalar_size,
+                        PreparedVerificationKeyT::abc_window_size,
+                        pvk.ABC_g1_tables[k],
+                        primary_inputs[abc_rest.indices[k]]);
+    }
+
+    const libff::Fqk<ppT> QAP1 = ppT::miller_loop(
+        ppT::precompute_G1(proof.g_A), ppT::precompute_G2(proof.g_B));
+    const libff::Fqk<ppT> QAP2 = ppT::double_miller_loop(
+        ppT::precompute_G1(acc),
+        pvk.generator_g2_precomp,
+        ppT::precompute_G1(proof.g_C),
+        pvk.delta_g2_precomp);
+    return ppT::final_exponentiation(QAP1 * QAP2.unitary_inverse()) ==
+           pvk.alpha_g1_beta_g2;
+}
+
+// Check the (well-formed) proofs ext_proofs[indices[begin]], ...,
+// ext_proofs[indices[end-1]] with a single random linear combination of the
+// verification equations
+//
+//   e(A_i, B_i) = e(alpha, beta) . e(acc_i, g2) . e(C_i, delta)
+//
+// where acc_i = ABC_0 + sum_j x_{i,j} . ABC_j. That is, for random r_i,
+// check:
+//
+//   prod_i e(r_i.A_i, B_i) . e(-sum_i r_i.acc_i, g2) . e(-sum_i r_i.C_i, delta)
+//     = e(alpha, beta)^(sum_i r_i)
+//
+// where sum_i r_i.acc_i is computed as a single multi-exponentiation over
+// ABC_g1.
+template<typename ppT>
+static bool groth16_verify_batch_check(
+    const std::vector<extended_proof<ppT, groth16_snark<ppT>>> &ext_proofs,
+    const typename groth16_snark<ppT>::PreparedVerificationKeyT &pvk,
+    const std::vector<size_t> &indices,
+    const size_t begin,
+    const size_t end)
+{
+    using Fr = libff::Fr<ppT>;
+    using G1 = libff::G1<ppT>;
+    using Fqk = libff::Fqk<ppT>;
+
+    const size_t num_proofs = end - begin;
+    std::vector<Fr> rs(num_proofs);
+    for (Fr &r : rs) {
+        r = Fr::random_element();
+    }
+
+    // Miller loops e(r_i.A_i, B_i), and the terms r_i.C_i
+    std::vector<Fqk> proof_miller_loops(num_proofs);
+    libff::G1_vector<ppT> r_Cs(num_proofs);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < num_proofs; ++i) {
+        const typename groth16_snark<ppT>::ProofT &proof =
+            ext_proofs[indices[begin + i]].get_proof();
+        proof_miller_loops[i] = ppT::miller_loop(
+            ppT::precompute_G1(rs[i] * proof.g_A),
+            ppT::precompute_G2(proof.g_B));
+        r_Cs[i] = rs[i] * proof.g_C;
+    }
+
+    // Combined scalars for the ABC_g1 multi-exponentiation
+    const libsnark::sparse_vector<G1> &abc_rest = pvk.vk.ABC_g1.rest;
+    Fr r_sum = Fr::zero();
+    for (const Fr &r : rs) {
+        r_sum += r;
+    }
+    libff::Fr_vector<ppT> abc_scalars(abc_rest.indices.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t k = 0; k < abc_rest.indices.size(); ++k) {
+        Fr scalar = Fr::zero();
+        for (size_t i = 0; i < num_proofs; ++i) {
+            const libsnark::r1cs_primary_input<Fr> &inputs =
+                ext_proofs[indices[begin + i]].get_primary_inputs();
+            scalar += rs[i] * inputs[abc_rest.indices[k]];
+        }
+        abc_scalars[k] = scalar;
+    }
+
+    G1 acc = r_sum * pvk.vk.ABC_g1.first;
+    if (!abc_scalars.empty()) {
+        acc = acc + multi_exp<ppT, G1>(abc_rest.values, abc_scalars);
+    }
+
+    G1 C_sum = G1::zero();
+    for (const G1 &r_C : r_Cs) {
+        C_sum = C_sum + r_C;
+    }
+
+    Fqk product = ppT::double_miller_loop(
+        ppT::precompute_G1(-acc),
+        pvk.generator_g2_precomp,
+        ppT::precompute_G1(-C_sum),
+        pvk.delta_g2_precomp);
+    for (const Fqk &miller_loop : proof_miller_loops) {
+        product = product * miller_loop;
+    }
+
+    return ppT::final_exponentiation(product) ==
+           (pvk.alpha_g1_beta_g2 ^ r_sum.as_bigint());
+}
+
+// Check the proofs indexed by indices[begin], ..., indices[end-1], bisecting
+// on failure, and append the indices of invalid proofs to
+// out_invalid_indices.
+template<typename ppT>
+static void groth16_verify_batch_bisect(
+    const std::vector<extended_proof<ppT, groth16_snark<ppT>>> &ext_proofs,
+    const typename groth16_snark<ppT>::PreparedVerificationKeyT &pvk,
+    const std::vector<size_t> &indices,
+    const size_t begin,
+    const size_t end,
+    std::vector<size_t> &out_invalid_indices)
+{
+    if (begin == end) {
+        return;
+    }
+
+    if (end - begin == 1) {
+        const extended_proof<ppT, groth16_snark<ppT>> &ext_proof =
+            ext_proofs[indices[begin]];
+        if (!groth16_snark<ppT>::verify(
+                ext_proof.get_primary_inputs(), ext_proof.get_proof(), pvk)) {
+            out_invalid_indices.push_back(indices[begin]);
+        }
+        return;
+    }
+
+    if (groth16_verify_batch_check(ext_proofs, pvk, indices, begin, end)) {
+        return;
+    }
+
+    const size_t mid = begin + (end - begin) / 2;
+    groth16_verify_batch_bisect(
+        ext_proofs, pvk, indices, begin, mid, out_invalid_indices);
+    groth16_verify_batch_bisect(
+        ext_proofs, pvk, indices, mid, end, out_invalid_indices);
+}
+
+template<typename ppT>
+bool groth16_snark<ppT>::verify_batch(
+    const std::vector<extended_proof<ppT, groth16_snark<ppT>>> &ext_proofs,
+    const groth16_snark<ppT>::VerificationKeyT &verification_key,
+    std::vector<size_t> &out_invalid_indices)
+{
+    return verify_batch(
+        ext_proofs,
+        prepare_verification_key(verification_key),
+        out_invalid_indices);
+}
+
+template<typename ppT>
+bool groth16_snark<ppT>::verify_batch(
+    const std::vector<extended_proof<ppT, groth16_snark<ppT>>> &ext_proofs,
+    const groth16_snark<ppT>::PreparedVerificationKeyT &pvk,
+    std::vector<size_t> &out_invalid_indices)
+{
+    libff::enter_block("Call to groth16_snark::verify_batch");
+    out_invalid_indices.clear();
+
+    // Malformed proofs and proofs with the wrong number of inputs are
+    // rejected immediately (as in r1cs_gg_ppzksnark_verifier_strong_IC).
+    // All others take part in the batch check.
+    const size_t num_inputs = pvk.vk.ABC_g1.domain_size();
+    std::vector<size_t> indices;
+    indices.reserve(ext_proofs.size());
+    for (size_t i = 0; i < ext_proofs.size(); ++i) {
+        if (ext_proofs[i].get_proof().is_well_formed() &&
+            ext_proofs[i].get_primary_inputs().size() == num_inputs) {
+            indices.push_back(i);
+        } else {
+            out_invalid_indices.push_back(i);
+        }
+    }
+
+    groth16_verify_batch_bisect(
+        ext_proofs, pvk, indices, 0, indices.size(), out_invalid_indices);
+    std::sort(out_invalid_indices.begin(), out_invalid_indices.end());
+
+    libff::leave_block("Call to groth16_snark::verify_batch");
+    return out_invalid_indices.empty();
+}
+
 template<typename ppT>
 std::ostream &groth16_snark<ppT>::verification_key_write_json(
     const VerificationKeyT &vk, std::ostream &os)
@@ -5,6 +5,8 @@
 #ifndef __ZETH_SNARKS_PGHR13_PGHR13_SNARK_HPP__
 #define __ZETH_SNARKS_PGHR13_PGHR13_SNARK_HPP__
 
+#include "libzeth/core/extended_proof.hpp"
+
 #include <boost/filesystem.hpp>
 #include <libsnark/gadgetlib1/protoboard.hpp>
 #include <libsnark/zk_proof_systems/ppzksnark/r1cs_ppzksnark/r1cs_ppzksnark.hpp>
@@ -17,6 +19,8 @@ template<typename ppT> class pghr13_snark
 public:
     typedef libsnark::r1cs_ppzksnark_proving_key<ppT> ProvingKeyT;
     typedef libsnark::r1cs_ppzksnark_verification_key<ppT> VerificationKeyT;
+    typedef libsnark::r1cs_ppzksnark_processed_verification_key<ppT>
+        PreparedVerificationKeyT;
     typedef libsnark::r1cs_ppzksnark_keypair<ppT> KeypairT;
     typedef libsnark::r1cs_ppzksnark_proof<ppT> ProofT;
 
@@ -24,17 +28,54 @@ public:
     static KeypairT generate_setup(
         const libsnark::protoboard<libff::Fr<ppT>> &pb);
 
+    /// Run the trusted setup and return the keypair for a constraint system
+    static KeypairT generate_setup(
+        const libsnark::r1cs_constraint_system<libff::Fr<ppT>> &cs);
+
     /// Generate the proof
     static ProofT generate_proof(
         const libsnark::protoboard<libff::Fr<ppT>> &pb,
         const ProvingKeyT &proving_key);
 
+    /// Generate the proof for the given primary and auxiliary inputs (for
+    /// proving keys generated from a constraint system which does not
+    /// correspond directly to a protoboard).
+    static ProofT generate_proof(
+        const ProvingKeyT &proving_key,
+        const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_input,
+        const libsnark::r1cs_auxiliary_input<libff::Fr<ppT>> &auxiliary_input);
+
     /// Verify proof
     static bool verify(
         const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_inputs,
         const ProofT &proof,
         const VerificationKeyT &verification_key);
 
+    /// Compute the prepared (processed) form of a verification key
+    static PreparedVerificationKeyT prepare_verification_key(
+        const VerificationKeyT &verification_key);
+
+    /// Verify proof using a prepared verification key
+    static bool verify(
+        const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_inputs,
+        const ProofT &proof,
+        const PreparedVerificationKeyT &prepared_verification_key);
+
+    /// Verify a batch of proofs against a single verification key. PGHR13
+    /// proofs are verified individually (in parallel). Returns true if all
+    /// proofs are valid. Otherwise, the indices of invalid proofs are
+    /// written to `out_invalid_indices`, in increasing order.
+    static bool verify_batch(
+        const std::vector<extended_proof<ppT, pghr13_snark<ppT>>> &ext_proofs,
+        const VerificationKeyT &verification_key,
+        std::vector<size_t> &out_invalid_indices);
+
+    /// Verify a batch of proofs using a prepared verification key.
+    static bool verify_batch(
+        const std::vector<extended_proof<ppT, pghr13_snark<ppT>>> &ext_proofs,
+        const PreparedVerificationKeyT &prepared_verification_key,
+        std::vector<size_t> &out_invalid_indices);
+
     /// Write verification as json
     static std::ostream &verification_key_write_json(
         const VerificationKeyT &, std::ostream &);
@@ -16,7 +16,14 @@ template<typename ppT>
 typename pghr13_snark<ppT>::KeypairT pghr13_snark<ppT>::generate_setup(
     const libsnark::protoboard<libff::Fr<ppT>> &pb)
 {
-    return libsnark::r1cs_ppzksnark_generator<ppT>(pb.get_constraint_system());
+    return generate_setup(pb.get_constraint_system());
+}
+
+template<typename ppT>
+typename pghr13_snark<ppT>::KeypairT pghr13_snark<ppT>::generate_setup(
+    const libsnark::r1cs_constraint_system<libff::Fr<ppT>> &cs)
+{
+    return libsnark::r1cs_ppzksnark_generator<ppT>(cs);
 }
 
 template<typename ppT>
@@ -27,11 +34,16 @@ typename pghr13_snark<ppT>::ProofT pghr13_snark<ppT>::generate_proof(
     // See:
     // https://github.com/scipr-lab/libsnark/blob/92a80f74727091fdc40e6021dc42e9f6b67d5176/libsnark/relations/constraint_satisfaction_problems/r1cs/r1cs.hpp#L81
     // For the definition of r1cs_primary_input and r1cs_auxiliary_input
-    libsnark::r1cs_primary_input<libff::Fr<ppT>> primary_input =
-        pb.primary_input();
-    libsnark::r1cs_auxiliary_input<libff::Fr<ppT>> auxiliary_input =
-        pb.auxiliary_input();
+    return generate_proof(
+        proving_key, pb.primary_input(), pb.auxiliary_input());
+}
 
+template<typename ppT>
+typename pghr13_snark<ppT>::ProofT pghr13_snark<ppT>::generate_proof(
+    const pghr13_snark<ppT>::ProvingKeyT &proving_key,
+    const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_input,
+    const libsnark::r1cs_auxiliary_input<libff::Fr<ppT>> &auxiliary_input)
+{
     // Generate proof from public input, auxiliary input (private/secret data),
     // and proving key
     ProofT proof = libsnark::r1cs_ppzksnark_prover(
@@ -50,6 +62,63 @@ bool pghr13_snark<ppT>::verify(
         verification_key, primary_inputs, proof);
 }
 
+template<typename ppT>
+typename pghr13_snark<ppT>::PreparedVerificationKeyT pghr13_snark<
+    ppT>::prepare_verification_key(const VerificationKeyT &verification_key)
+{
+    return libsnark::r1cs_ppzksnark_verifier_process_vk<ppT>(verification_key);
+}
+
+template<typename ppT>
+bool pghr13_snark<ppT>::verify(
+    const libsnark::r1cs_primary_input<libff::Fr<ppT>> &primary_inputs,
+    const pghr13_snark<ppT>::ProofT &proof,
+    const pghr13_snark<ppT>::PreparedVerificationKeyT
+        &prepared_verification_key)
+{
+    return libsnark::r1cs_ppzksnark_online_verifier_strong_IC<ppT>(
+        prepared_verification_key, primary_inputs, proof);
+}
+
+template<typename ppT>
+bool pghr13_snark<ppT>::verify_batch(
+    const std::vector<extended_proof<ppT, pghr13_snark<ppT>>> &ext_proofs,
+    const pghr13_snark<ppT>::VerificationKeyT &verification_key,
+    std::vector<size_t> &out_invalid_indices)
+{
+    return verify_batch(
+        ext_proofs,
+        prepare_verification_key(verification_key),
+        out_invalid_indices);
+}
+
+template<typename ppT>
+bool pghr13_snark<ppT>::verify_batch(
+    const std::vector<extended_proof<ppT, pghr13_snark<ppT>>> &ext_proofs,
+    const pghr13_snark<ppT>::PreparedVerificationKeyT
+        &prepared_verification_key,
+    std::vector<size_t> &out_invalid_indices)
+{
+    std::vector<char> valid(ext_proofs.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < ext_proofs.size(); ++i) {
+        valid[i] = verify(
+            ext_proofs[i].get_primary_inputs(),
+            ext_proofs[i].get_proof(),
+            prepared_verification_key);
+    }
+
+    out_invalid_indices.clear();
+    for (size_t i = 0; i < ext_proofs.size(); ++i) {
+        if (!valid[i]) {
+            out_invalid_indices.push_back(i);
+        }
+    }
+    return out_invalid_indices.empty();
+}
+
 template<typename ppT>
 std::ostream &pghr13_snark<ppT>::verification_key_write_json(
     const pghr13_snark<ppT>::VerificationKeyT &vk, std::ostream &os)
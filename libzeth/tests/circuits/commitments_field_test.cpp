@@ -0,0 +1,76 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/circuits/circuit_types.hpp"
+#include "libzeth/circuits/commitments/commitment_field.hpp"
+#include "libzeth/circuits/poseidon/poseidon_sponge.hpp"
+#include "libzeth/zeth_constants.hpp"
+
+#include <gtest/gtest.h>
+#include <libsnark/gadgetlib1/gadgets/basic_gadgets.hpp>
+
+using namespace libzeth;
+
+typedef libzeth::ppT ppT;
+typedef libff::Fr<ppT> FieldT;
+typedef PoseidonSponge128<1, FieldT> HashT;
+
+namespace
+{
+
+TEST(TestCOMMField, COMMCmMatchesNative)
+{
+    libsnark::protoboard<FieldT> pb;
+
+    const FieldT a_pk(
+        "4173619287346192873461928734619287346192873461928734619287346192873"
+        "461");
+    const FieldT rho(
+        "1234987612349876123498761234987612349876123498761234987612349876123"
+        "498");
+    const FieldT trap_r(
+        "9876123498761234987612349876123498761234987612349876123498761234987"
+        "61");
+    const uint64_t value = 0x2F0000000000000FULL;
+
+    libsnark::pb_variable_array<FieldT> note;
+    note.allocate(pb, 3, "note");
+    note.fill_with_field_elements(pb, {a_pk, rho, trap_r});
+
+    // The value is only available as bits, and is packed in the hash input
+    libsnark::pb_variable_array<FieldT> value_bits;
+    value_bits.allocate(pb, ZETH_V_SIZE, "value_bits");
+    value_bits.fill_with_bits_of_ulong(pb, value);
+
+    COMM_cm_field_gadget<FieldT, HashT> comm(
+        pb,
+        note[0],
+        note[1],
+        note[2],
+        libsnark::pb_packing_sum<FieldT>(value_bits),
+        "comm");
+    comm.generate_r1cs_constraints();
+    comm.generate_r1cs_witness();
+
+    ASSERT_TRUE(pb.is_satisfied());
+    const FieldT cm = COMM_cm_field_gadget<FieldT, HashT>::get_hash(
+        a_pk, rho, trap_r, FieldT(value, true));
+    ASSERT_EQ(cm, pb.val(comm.result()));
+    ASSERT_EQ(1U, comm.hasher.permutations.size());
+
+    // Changing any element of the note changes the commitment
+    pb.val(note[2]) = trap_r + FieldT::one();
+    comm.generate_r1cs_witness();
+    ASSERT_TRUE(pb.is_satisfied());
+    ASSERT_NE(cm, pb.val(comm.result()));
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ppT::init_public_params();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/circuits/circuit_types.hpp"
+#include "libzeth/circuits/merkle_tree/merkle_path_compute_kary.hpp"
+#include "libzeth/circuits/merkle_tree/merkle_path_selector_kary.hpp"
+#include "libzeth/circuits/poseidon/poseidon.hpp"
+#include "libzeth/core/merkle_tree_field.hpp"
+#include "libzeth/core/merkle_tree_field_kary.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace libzeth;
+
+// Instantiation of the templates for the tests
+typedef libzeth::ppT ppT;
+typedef libff::Fr<ppT> FieldT;
+typedef Poseidon128<2, 1, FieldT> HashTree2T;
+typedef Poseidon128<4, 1, FieldT> HashTree4T;
+
+namespace
+{
+
+libsnark::pb_variable_array<FieldT> allocate_bits(
+    libsnark::protoboard<FieldT> &pb,
+    const size_t value,
+    const size_t num_bits,
+    const std::string &annotation)
+{
+    libsnark::pb_variable_array<FieldT> bits;
+    bits.allocate(pb, num_bits, annotation);
+    for (size_t i = 0; i < num_bits; ++i) {
+        pb.val(bits[i]) = FieldT((value >> i) & 1);
+    }
+    return bits;
+}
+
+TEST(MerkleTreeKaryTest, SelectorAllPositions)
+{
+    const size_t arity = 4;
+    for (size_t position = 0; position < arity; ++position) {
+        libsnark::protoboard<FieldT> pb;
+
+        libsnark::pb_variable<FieldT> input;
+        input.allocate(pb, "input");
+        pb.val(input) = FieldT(100);
+
+        libsnark::pb_variable_array<FieldT> siblings;
+        siblings.allocate(pb, arity - 1, "siblings");
+        for (size_t i = 0; i < arity - 1; ++i) {
+            pb.val(siblings[i]) = FieldT(i + 1);
+        }
+
+        const libsnark::pb_variable_array<FieldT> bits =
+            allocate_bits(pb, position, 2, "bits");
+
+        merkle_path_selector_kary<FieldT> selector(
+            pb, input, siblings, bits, "selector");
+        selector.generate_r1cs_constraints();
+        selector.generate_r1cs_witness();
+        ASSERT_TRUE(pb.is_satisfied());
+
+        // The input is at `position`. The sibling in the same pair comes
+        // first, followed by the other pair.
+        const std::vector<FieldT> children =
+            selector.get_children().get_vals(pb);
+        ASSERT_EQ(arity, children.size());
+        ASSERT_EQ(FieldT(100), children[position]);
+        ASSERT_EQ(FieldT(1), children[position ^ 1]);
+        ASSERT_EQ(FieldT(2), children[(position & 2) ^ 2]);
+        ASSERT_EQ(FieldT(3), children[((position & 2) ^ 2) + 1]);
+    }
+}
+
+TEST(MerkleTreeKaryTest, BinaryTreeMatchesMerkleTreeField)
+{
+    const size_t depth = 3;
+    const std::vector<FieldT> leaves{
+        FieldT(11), FieldT(12), FieldT(13), FieldT(14), FieldT(15)};
+
+    merkle_tree_field<FieldT, HashTree2T> tree(depth);
+    for (size_t address = 0; address < leaves.size(); ++address) {
+        tree.set_value(address, leaves[address]);
+    }
+    merkle_tree_field_kary<FieldT, HashTree2T> tree_kary(depth, 2, leaves);
+    ASSERT_EQ(tree.get_root(), tree_kary.get_root());
+    ASSERT_EQ(tree.get_path(3), tree_kary.get_path(3));
+
+    tree.set_value(6, FieldT(16));
+    tree_kary.set_value(6, FieldT(16));
+    ASSERT_EQ(tree.get_root(), tree_kary.get_root());
+    ASSERT_EQ(tree.get_path(5), tree_kary.get_path(5));
+}
+
+TEST(MerkleTreeKaryTest, SetValueMatchesConstruction)
+{
+    const size_t depth = 2;
+    const std::vector<FieldT> leaves{
+        FieldT(21), FieldT(22), FieldT(23), FieldT(24), FieldT(25), FieldT(26)};
+
+    merkle_tree_field_kary<FieldT, HashTree4T> tree(depth, 4, leaves);
+    merkle_tree_field_kary<FieldT, HashTree4T> tree_incremental(depth, 4);
+    for (size_t address = 0; address < leaves.size(); ++address) {
+        tree_incremental.set_value(address, leaves[address]);
+    }
+
+    ASSERT_EQ(tree.get_root(), tree_incremental.get_root());
+    ASSERT_EQ(tree.get_path(5), tree_incremental.get_path(5));
+}
+
+TEST(MerkleTreeKaryTest, PathComputeQuaternary)
+{
+    const size_t depth = 3;
+    const size_t arity = 4;
+    const size_t address = 45;
+
+    merkle_tree_field_kary<FieldT, HashTree4T> tree(depth, arity);
+    tree.set_value(3, FieldT(31));
+    tree.set_value(44, FieldT(32));
+    tree.set_value(address, FieldT(33));
+    tree.set_value(60, FieldT(34));
+    const std::vector<FieldT> path_values = tree.get_path(address);
+    ASSERT_EQ(depth * (arity - 1), path_values.size());
+
+    libsnark::protoboard<FieldT> pb;
+    const libsnark::pb_variable_array<FieldT> address_bits =
+        allocate_bits(pb, address, depth * 2, "address_bits");
+
+    libsnark::pb_variable<FieldT> leaf;
+    leaf.allocate(pb, "leaf");
+    pb.val(leaf) = tree.get_value(address);
+
+    libsnark::pb_variable_array<FieldT> path;
+    path.allocate(pb, path_values.size(), "path");
+    path.fill_with_field_elements(pb, path_values);
+
+    merkle_path_compute_kary<FieldT, HashTree4T> compute(
+        pb, depth, arity, address_bits, leaf, path, "compute");
+    compute.generate_r1cs_constraints();
+    compute.generate_r1cs_witness();
+
+    ASSERT_TRUE(pb.is_satisfied());
+    ASSERT_EQ(tree.get_root(), pb.val(compute.result()));
+
+    // A different leaf value gives a different root
+    pb.val(leaf) = FieldT(35);
+    compute.generate_r1cs_witness();
+    ASSERT_NE(tree.get_root(), pb.val(compute.result()));
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ppT::init_public_params();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
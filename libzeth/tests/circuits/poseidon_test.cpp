@@ -2,6 +2,7 @@
 // License: LGPL-3.0+
 #include "libzeth/circuits/circuit_types.hpp"
 #include "libzeth/circuits/poseidon/poseidon.hpp"
+#include "libzeth/circuits/poseidon/poseidon_sponge.hpp"
 
 #include "gtest/gtest.h"
 
@@ -53,6 +54,118 @@ namespace
     FieldT expected_out = FieldT("12242166908188651009877250812424843524687801523336557272219921456462821518061");
     ASSERT_TRUE(expected_out == pb.val(the_gadget.result()));
 }
+
+    TEST(TestPoseidon, ConstantsTableMatchesDerivation)
+{
+    const unsigned t = 6;
+    const unsigned F = 8;
+    const unsigned P = 57;
+
+#if defined(CURVE_ALT_BN128)
+    const bool precomputed = PoseidonConstantsTable<t, F, P, FieldT>::precomputed;
+    ASSERT_TRUE(precomputed);
+#endif
+
+    const PoseidonConstants<FieldT> &constants = poseidon_params<t, F, P, FieldT>();
+    const PoseidonConstants<FieldT> derived = poseidon_params_derive<t, F, P, FieldT>();
+    ASSERT_EQ(derived.C, constants.C);
+    ASSERT_EQ(derived.M, constants.M);
+
+    const PoseidonPartialRoundConstants<FieldT> &partial = poseidon_partial_round_params<t, F, P, FieldT>();
+    const PoseidonPartialRoundConstants<FieldT> derived_partial =
+        poseidon_partial_round_params_derive<t, F, P, FieldT>(derived);
+    ASSERT_EQ(derived_partial.M_initial, partial.M_initial);
+    ASSERT_EQ(derived_partial.C_sbox, partial.C_sbox);
+    ASSERT_EQ(derived_partial.M_00, partial.M_00);
+    ASSERT_EQ(derived_partial.M_row, partial.M_row);
+    ASSERT_EQ(derived_partial.M_col, partial.M_col);
+    ASSERT_EQ(derived_partial.C_final, partial.C_final);
+}
+
+    TEST(TestPoseidon, PartialRoundsMatchDenseRounds)
+{
+    // The sparse partial rounds must compute the same outputs as the
+    // straightforward dense rounds, for an arbitrary input state.
+    const unsigned t = 6;
+    const unsigned F = 8;
+    const unsigned P = 57;
+    const PoseidonConstants<FieldT> &constants = poseidon_params<t, F, P, FieldT>();
+
+    libsnark::protoboard<FieldT> pb;
+    libsnark::pb_variable_array<FieldT> x;
+    x.allocate(pb, t, "x");
+    for (unsigned i = 0; i < t; ++i) {
+        pb.val(x[i]) = FieldT::random_element();
+    }
+    const std::vector<libsnark::linear_combination<FieldT>> state = VariableArrayT_to_lc(x);
+
+    typedef Poseidon_Round<t, 1, t, t, FieldT> DenseRoundT;
+    std::vector<DenseRoundT> dense_rounds;
+    dense_rounds.reserve(P);
+    for (unsigned i = 0; i < P; ++i) {
+        const std::vector<libsnark::linear_combination<FieldT>> &in_state =
+            (i == 0) ? state : dense_rounds.back().outputs;
+        dense_rounds.emplace_back(pb, constants.C[F / 2 + i], constants.M, in_state, FMT("dense", ".round[%u]", i));
+    }
+
+    Poseidon_PartialRounds<t, P, FieldT> sparse_rounds(
+        pb, poseidon_partial_round_params<t, F, P, FieldT>(), state, F / 2, "sparse");
+
+    for (const DenseRoundT &round : dense_rounds) {
+        round.generate_r1cs_constraints();
+        round.generate_r1cs_witness();
+    }
+    sparse_rounds.generate_r1cs_constraints();
+    sparse_rounds.generate_r1cs_witness();
+
+    ASSERT_TRUE(pb.is_satisfied());
+    for (unsigned i = 0; i < t; ++i) {
+        ASSERT_EQ(
+            lc_val<FieldT>(pb, dense_rounds.back().outputs[i]),
+            lc_val<FieldT>(pb, sparse_rounds.outputs[i]));
+    }
+}
+
+    TEST(TestPoseidon, NativePermutationMatchesGadget)
+{
+    // Poseidon128<2,1> is the permutation of (x, y, 0, 0, 0, 0), keeping the
+    // first element.
+    std::vector<FieldT> state{FieldT("1"), FieldT("2"), FieldT::zero(), FieldT::zero(), FieldT::zero(), FieldT::zero()};
+    poseidon_permute_native<6, 8, 57, FieldT>(state);
+    ASSERT_EQ(FieldT("12242166908188651009877250812424843524687801523336557272219921456462821518061"), state[0]);
+}
+
+    TEST(TestPoseidon, SpongeMatchesNative)
+{
+    for (const size_t num_inputs : {0, 1, 4, 5, 6, 11}) {
+        std::vector<FieldT> values;
+        for (size_t i = 0; i < num_inputs; ++i) {
+            values.push_back(FieldT::random_element());
+        }
+
+        libsnark::protoboard<FieldT> pb;
+        libsnark::pb_variable_array<FieldT> inputs;
+        inputs.allocate(pb, num_inputs, "inputs");
+        inputs.fill_with_field_elements(pb, values);
+
+        PoseidonSponge128<2, FieldT> sponge(pb, inputs, "sponge");
+        sponge.generate_r1cs_constraints();
+        sponge.generate_r1cs_witness();
+
+        ASSERT_TRUE(pb.is_satisfied());
+        ASSERT_EQ(PoseidonSponge128<2, FieldT>::hash(values), sponge.results().get_vals(pb));
+        ASSERT_EQ(std::max<size_t>(1, (num_inputs + 4) / 5), sponge.permutations.size());
+    }
+}
+
+    TEST(TestPoseidon, SpongeSeparatesLengths)
+{
+    const FieldT empty = PoseidonSponge128<1, FieldT>::hash({})[0];
+    const FieldT one_zero = PoseidonSponge128<1, FieldT>::hash({FieldT::zero()})[0];
+    const FieldT two_zeros = PoseidonSponge128<1, FieldT>::hash({FieldT::zero(), FieldT::zero()})[0];
+    ASSERT_NE(empty, one_zero);
+    ASSERT_NE(one_zero, two_zeros);
+}
 }
 int main(int argc, char **argv)
 {
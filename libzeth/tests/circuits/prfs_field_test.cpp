@@ -0,0 +1,159 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/circuits/circuit_types.hpp"
+#include "libzeth/circuits/poseidon/poseidon_sponge.hpp"
+#include "libzeth/circuits/prfs/prf_field.hpp"
+
+#include <gtest/gtest.h>
+#include <libsnark/gadgetlib1/gadgets/basic_gadgets.hpp>
+
+using namespace libzeth;
+
+typedef libzeth::ppT ppT;
+typedef libff::Fr<ppT> FieldT;
+typedef PoseidonSponge128<1, FieldT> HashT;
+
+namespace
+{
+
+libsnark::pb_variable<FieldT> allocate_value(
+    libsnark::protoboard<FieldT> &pb,
+    const FieldT &value,
+    const std::string &annotation)
+{
+    libsnark::pb_variable<FieldT> var;
+    var.allocate(pb, annotation);
+    pb.val(var) = value;
+    return var;
+}
+
+const FieldT a_sk(
+    "1900457186217296212436271426829017853702553689580437010290963609008569"
+    "0917");
+const FieldT rho(
+    "9102736416925377616423758743512736354578129356401871034975382102173412"
+    "356");
+const FieldT h_sig(
+    "3276139841213948216379461283746217384612873461283746128734612873462387"
+    "46");
+
+TEST(TestPRFField, PRFAddrApkMatchesNative)
+{
+    libsnark::protoboard<FieldT> pb;
+    const libsnark::pb_variable<FieldT> a_sk_var =
+        allocate_value(pb, a_sk, "a_sk");
+
+    PRF_addr_a_pk_field_gadget<FieldT, HashT> prf(pb, a_sk_var);
+    prf.generate_r1cs_constraints();
+    prf.generate_r1cs_witness();
+
+    ASSERT_TRUE(pb.is_satisfied());
+    ASSERT_EQ(
+        (PRF_addr_a_pk_field_gadget<FieldT, HashT>::get_hash(a_sk)),
+        pb.val(prf.result()));
+    ASSERT_EQ(
+        (HashT::get_hash(
+            {prf_field_tag<FieldT>(prf_field_domain_addr, 0), a_sk})),
+        pb.val(prf.result()));
+
+    // A single permutation, and no bits
+    ASSERT_EQ(1U, prf.hasher.permutations.size());
+
+    pb.val(prf.result()) = pb.val(prf.result()) + FieldT::one();
+    ASSERT_FALSE(pb.is_satisfied());
+}
+
+TEST(TestPRFField, PRFNfMatchesNative)
+{
+    libsnark::protoboard<FieldT> pb;
+    const libsnark::pb_variable<FieldT> a_sk_var =
+        allocate_value(pb, a_sk, "a_sk");
+    const libsnark::pb_variable<FieldT> rho_var =
+        allocate_value(pb, rho, "rho");
+
+    PRF_nf_field_gadget<FieldT, HashT> prf(pb, a_sk_var, rho_var);
+    prf.generate_r1cs_constraints();
+    prf.generate_r1cs_witness();
+
+    ASSERT_TRUE(pb.is_satisfied());
+    ASSERT_EQ(
+        (PRF_nf_field_gadget<FieldT, HashT>::get_hash(a_sk, rho)),
+        pb.val(prf.result()));
+}
+
+TEST(TestPRFField, PRFPkAndRhoMatchNative)
+{
+    for (size_t index = 0; index < 2; ++index) {
+        libsnark::protoboard<FieldT> pb;
+        const libsnark::pb_variable<FieldT> a_sk_var =
+            allocate_value(pb, a_sk, "a_sk");
+        const libsnark::pb_variable<FieldT> h_sig_var =
+            allocate_value(pb, h_sig, "h_sig");
+
+        PRF_pk_field_gadget<FieldT, HashT> prf_pk(
+            pb, a_sk_var, h_sig_var, index);
+        PRF_rho_field_gadget<FieldT, HashT> prf_rho(
+            pb, a_sk_var, h_sig_var, index);
+        prf_pk.generate_r1cs_constraints();
+        prf_rho.generate_r1cs_constraints();
+        prf_pk.generate_r1cs_witness();
+        prf_rho.generate_r1cs_witness();
+
+        ASSERT_TRUE(pb.is_satisfied());
+        ASSERT_EQ(
+            (PRF_pk_field_gadget<FieldT, HashT>::get_hash(a_sk, h_sig, index)),
+            pb.val(prf_pk.result()));
+        ASSERT_EQ(
+            (PRF_rho_field_gadget<FieldT, HashT>::get_hash(
+                a_sk, h_sig, index)),
+            pb.val(prf_rho.result()));
+    }
+}
+
+TEST(TestPRFField, PRFsAreDomainSeparated)
+{
+    const std::vector<FieldT> outputs{
+        PRF_nf_field_gadget<FieldT, HashT>::get_hash(a_sk, h_sig),
+        PRF_pk_field_gadget<FieldT, HashT>::get_hash(a_sk, h_sig, 0),
+        PRF_pk_field_gadget<FieldT, HashT>::get_hash(a_sk, h_sig, 1),
+        PRF_rho_field_gadget<FieldT, HashT>::get_hash(a_sk, h_sig, 0),
+        PRF_rho_field_gadget<FieldT, HashT>::get_hash(a_sk, h_sig, 1),
+    };
+
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        for (size_t j = i + 1; j < outputs.size(); ++j) {
+            ASSERT_NE(outputs[i], outputs[j]);
+        }
+    }
+}
+
+TEST(TestPRFField, PRFAcceptsPackedInputs)
+{
+    // A key given as bits is packed into a linear combination, without
+    // allocating a field variable
+    libsnark::protoboard<FieldT> pb;
+    libsnark::pb_variable_array<FieldT> a_sk_bits;
+    a_sk_bits.allocate(pb, 8, "a_sk_bits");
+    a_sk_bits.fill_with_bits_of_ulong(pb, 0xa5);
+
+    PRF_addr_a_pk_field_gadget<FieldT, HashT> prf(
+        pb, libsnark::pb_packing_sum<FieldT>(a_sk_bits));
+    prf.generate_r1cs_constraints();
+    prf.generate_r1cs_witness();
+
+    ASSERT_TRUE(pb.is_satisfied());
+    ASSERT_EQ(
+        (PRF_addr_a_pk_field_gadget<FieldT, HashT>::get_hash(FieldT(0xa5))),
+        pb.val(prf.result()));
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ppT::init_public_params();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
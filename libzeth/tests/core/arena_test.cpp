@@ -0,0 +1,121 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/arena.hpp"
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <string>
+
+using namespace libzeth;
+
+namespace
+{
+
+TEST(ArenaTest, AllocationAndReset)
+{
+    arena a(256);
+    ASSERT_EQ(0U, a.num_blocks());
+
+    void *const p1 = a.allocate(3, 1);
+    void *const p2 = a.allocate(8, 8);
+    ASSERT_EQ(0U, reinterpret_cast<uintptr_t>(p2) % 8);
+    ASSERT_NE(p1, p2);
+    ASSERT_EQ(2U, a.num_allocations());
+    ASSERT_EQ(11U, a.bytes_allocated());
+    ASSERT_EQ(1U, a.num_blocks());
+
+    // Allocations larger than the block size get a dedicated block
+    a.allocate(1000, 16);
+    ASSERT_EQ(2U, a.num_blocks());
+
+    // Reset releases the allocations, but keeps the blocks
+    const size_t capacity = a.capacity();
+    a.reset();
+    ASSERT_EQ(0U, a.num_allocations());
+    ASSERT_EQ(0U, a.bytes_allocated());
+    ASSERT_EQ(capacity, a.capacity());
+
+    // The retained blocks are reused, in order
+    ASSERT_EQ(p1, a.allocate(3, 1));
+    a.allocate(1000, 16);
+    ASSERT_EQ(2U, a.num_blocks());
+
+    ASSERT_THROW(a.allocate(8, 3), std::invalid_argument);
+}
+
+TEST(ArenaTest, AllocatorWithContainers)
+{
+    arena a(64);
+    std::vector<uint64_t, arena_allocator<uint64_t>> v{
+        arena_allocator<uint64_t>(a)};
+    for (uint64_t i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+    ASSERT_EQ(4950U, std::accumulate(v.begin(), v.end(), uint64_t(0)));
+    ASSERT_LT(0U, a.num_allocations());
+
+    // Rebound allocators draw from the same arena
+    const arena_allocator<char> rebound(v.get_allocator());
+    ASSERT_EQ(&a, &rebound.get_arena());
+    ASSERT_TRUE(rebound == v.get_allocator());
+}
+
+TEST(ArenaTest, MakeSharedInScope)
+{
+    // Without a scope, objects are allocated from the heap
+    ASSERT_EQ(nullptr, current_arena());
+    const std::shared_ptr<std::string> heap_str =
+        arena_make_shared<std::string>("heap");
+    ASSERT_EQ("heap", *heap_str);
+
+    arena a;
+    {
+        arena_scope scope(a);
+        ASSERT_EQ(&a, current_arena());
+        {
+            const std::shared_ptr<std::string> str =
+                arena_make_shared<std::string>("arena");
+            const std::shared_ptr<uint64_t> value =
+                arena_make_shared<uint64_t>(7U);
+            ASSERT_EQ("arena", *str);
+            ASSERT_EQ(7U, *value);
+            ASSERT_EQ(2U, a.num_allocations());
+
+            // Nested scopes of the same arena do not reset it
+            {
+                arena_scope nested(a);
+            }
+            ASSERT_EQ(2U, a.num_allocations());
+        }
+    }
+
+    // Leaving the scope resets the arena
+    ASSERT_EQ(nullptr, current_arena());
+    ASSERT_EQ(0U, a.num_allocations());
+}
+
+TEST(ArenaTest, ThreadArenaIsReused)
+{
+    arena &a = thread_arena();
+    ASSERT_EQ(&a, &thread_arena());
+    {
+        arena_scope scope(a);
+        arena_make_shared<uint64_t>(1U);
+    }
+    const size_t num_blocks = a.num_blocks();
+    {
+        arena_scope scope(a);
+        arena_make_shared<uint64_t>(2U);
+    }
+    ASSERT_EQ(num_blocks, a.num_blocks());
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
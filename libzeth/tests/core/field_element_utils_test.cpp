@@ -44,6 +44,14 @@ TEST(FieldElementUtilsTest, FieldElementEncodeDecode)
     ASSERT_EQ(fe, fe_decoded);
 }
 
+TEST(FieldElementUtilsTest, FieldElementEncodePrefixed)
+{
+    Fr fe = dummy_field_element();
+    std::string fe_hex = libzeth::field_element_to_prefixed_hex<Fr>(fe);
+    ASSERT_EQ("0x" + libzeth::field_element_to_hex<Fr>(fe), fe_hex);
+    ASSERT_EQ(fe, libzeth::field_element_from_hex<Fr>(fe_hex));
+}
+
 TEST(FieldElementUtilsTest, FieldElementDecodeBadString)
 {
     std::string invalid_hex = "xxx";
@@ -0,0 +1,77 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/circuits/circuit_types.hpp"
+#include "libzeth/core/fixed_base_table.hpp"
+
+#include <gtest/gtest.h>
+
+using ppT = libzeth::ppT;
+using Fr = libff::Fr<ppT>;
+using G1 = libff::G1<ppT>;
+using G2 = libff::G2<ppT>;
+
+namespace
+{
+
+template<typename GroupT>
+void check_fixed_base_table(
+    const libzeth::fixed_base_table<GroupT, Fr> &table, const GroupT &base)
+{
+    const std::vector<Fr> scalars{
+        Fr::zero(),
+        Fr::one(),
+        -Fr::one(),
+        Fr(13),
+        Fr::random_element(),
+        Fr::random_element(),
+    };
+
+    for (const Fr &s : scalars) {
+        ASSERT_EQ(s * base, table.multiply(s));
+    }
+
+    const std::vector<GroupT> batch = table.batch_multiply(scalars);
+    ASSERT_EQ(scalars.size(), batch.size());
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        ASSERT_EQ(scalars[i] * base, batch[i]);
+    }
+
+    const std::vector<GroupT> partial_batch = table.batch_multiply(scalars, 2);
+    ASSERT_EQ(2U, partial_batch.size());
+    ASSERT_EQ(batch[0], partial_batch[0]);
+    ASSERT_EQ(batch[1], partial_batch[1]);
+    ASSERT_THROW(
+        table.batch_multiply(scalars, scalars.size() + 1),
+        std::invalid_argument);
+}
+
+TEST(FixedBaseTableTest, G1GeneratorTable)
+{
+    check_fixed_base_table(libzeth::g1_generator_table<ppT>(), G1::one());
+}
+
+TEST(FixedBaseTableTest, G2GeneratorTable)
+{
+    check_fixed_base_table(libzeth::g2_generator_table<ppT>(), G2::one());
+}
+
+TEST(FixedBaseTableTest, ArbitraryBaseAndWindowSize)
+{
+    // Window sizes which do and do not divide the scalar size
+    const G1 base = Fr::random_element() * G1::one();
+    for (const size_t window_size : {1U, 4U, 5U, 11U}) {
+        check_fixed_base_table(
+            libzeth::fixed_base_table<G1, Fr>(base, window_size), base);
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ppT::init_public_params();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
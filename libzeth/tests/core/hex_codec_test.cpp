@@ -0,0 +1,108 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/hex_codec.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace libzeth;
+
+namespace
+{
+
+// Reference encoding, one byte at a time
+std::string reference_hex(const std::vector<uint8_t> &bytes)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    for (const uint8_t byte : bytes) {
+        hex.push_back(digits[byte >> 4]);
+        hex.push_back(digits[byte & 0x0f]);
+    }
+    return hex;
+}
+
+std::vector<uint8_t> dummy_bytes(const size_t num_bytes)
+{
+    std::vector<uint8_t> bytes(num_bytes);
+    for (size_t i = 0; i < num_bytes; ++i) {
+        bytes[i] = (uint8_t)(37 * i + 11);
+    }
+    return bytes;
+}
+
+// Sizes covering the vector blocks (16 and 32 bytes) and the scalar tails
+const std::vector<size_t> sizes{0, 1, 15, 16, 17, 31, 32, 33, 48, 64, 97};
+
+TEST(HexCodecTest, EncodeDecode)
+{
+    for (const size_t num_bytes : sizes) {
+        const std::vector<uint8_t> bytes = dummy_bytes(num_bytes);
+        const std::string expect = reference_hex(bytes);
+
+        std::string hex(2 * num_bytes, ' ');
+        hex_encode(bytes.data(), num_bytes, &hex[0]);
+        ASSERT_EQ(expect, hex);
+
+        std::vector<uint8_t> decoded(num_bytes);
+        ASSERT_TRUE(hex_decode(hex.c_str(), num_bytes, decoded.data()));
+        ASSERT_EQ(bytes, decoded);
+    }
+}
+
+TEST(HexCodecTest, EncodeDecodeReversed)
+{
+    for (const size_t num_bytes : sizes) {
+        const std::vector<uint8_t> bytes = dummy_bytes(num_bytes);
+        const std::string expect =
+            reference_hex(std::vector<uint8_t>(bytes.rbegin(), bytes.rend()));
+
+        std::string hex(2 * num_bytes, ' ');
+        hex_encode_reversed(bytes.data(), num_bytes, &hex[0]);
+        ASSERT_EQ(expect, hex);
+
+        std::vector<uint8_t> decoded(num_bytes);
+        ASSERT_TRUE(
+            hex_decode_reversed(hex.c_str(), num_bytes, decoded.data()));
+        ASSERT_EQ(bytes, decoded);
+    }
+}
+
+TEST(HexCodecTest, DecodeUpperCase)
+{
+    const std::string hex = "00112233445566778899AABBCCDDEEFF"
+                            "00112233445566778899aAbBcCdDeEfF";
+    std::vector<uint8_t> decoded(32);
+    ASSERT_TRUE(hex_decode(hex.c_str(), 32, decoded.data()));
+    for (size_t i = 0; i < 32; ++i) {
+        ASSERT_EQ((uint8_t)(0x11 * (i % 16)), decoded[i]);
+    }
+}
+
+TEST(HexCodecTest, DecodeInvalid)
+{
+    // Invalid characters are detected in every position, including those
+    // processed by vector instructions.
+    const std::string invalid_chars = " /:@G`gx\xff";
+    const size_t num_bytes = 40;
+    const std::string valid = reference_hex(dummy_bytes(num_bytes));
+    std::vector<uint8_t> decoded(num_bytes);
+    for (size_t i = 0; i < valid.size(); ++i) {
+        for (const char c : invalid_chars) {
+            std::string hex = valid;
+            hex[i] = c;
+            ASSERT_FALSE(hex_decode(hex.c_str(), num_bytes, decoded.data()));
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
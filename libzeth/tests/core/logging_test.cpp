@@ -0,0 +1,117 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/logging.hpp"
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace libzeth;
+
+namespace
+{
+
+std::vector<std::string> split_lines(const std::string &text)
+{
+    std::vector<std::string> lines;
+    std::istringstream in(text);
+    std::string line;
+    while (std::getline(in, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+size_t evaluate(size_t &num_evaluations)
+{
+    return ++num_evaluations;
+}
+
+TEST(LoggingTest, LevelNames)
+{
+    ASSERT_EQ(std::string("INFO"), log_level_name(log_level::info));
+    ASSERT_EQ(log_level::warning, log_level_from_string("warning"));
+    ASSERT_EQ(log_level::debug, log_level_from_string("DEBUG"));
+    ASSERT_EQ(log_level::off, log_level_from_string("Off"));
+    ASSERT_THROW(log_level_from_string("verbose"), std::invalid_argument);
+}
+
+TEST(LoggingTest, RuntimeLevel)
+{
+    std::ostringstream out;
+    log_set_output(out);
+    log_set_level(log_level::info);
+
+    // Disabled records are not formatted
+    size_t num_evaluations = 0;
+    ZETH_LOG(debug) << "not written " << evaluate(num_evaluations);
+    ZETH_LOG(info) << "written " << evaluate(num_evaluations);
+    ZETH_LOG(error) << "error " << 7U;
+    log_flush();
+    ASSERT_EQ(1U, num_evaluations);
+
+    const std::vector<std::string> lines = split_lines(out.str());
+    ASSERT_EQ(2U, lines.size());
+    ASSERT_NE(std::string::npos, lines[0].find(" INFO [t"));
+    ASSERT_NE(std::string::npos, lines[0].find("] written 1"));
+    ASSERT_NE(std::string::npos, lines[1].find(" ERROR [t"));
+    ASSERT_NE(std::string::npos, lines[1].find("] error 7"));
+
+    log_set_level(log_level::off);
+    ZETH_LOG(error) << "not written";
+    log_set_level(log_level::info);
+    log_flush();
+    ASSERT_EQ(2U, split_lines(out.str()).size());
+
+    log_set_output(std::cout);
+}
+
+TEST(LoggingTest, ConcurrentRecords)
+{
+    const size_t num_threads = 4;
+    const size_t records_per_thread = 1000;
+
+    std::ostringstream out;
+    log_set_output(out);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([t]() {
+            for (size_t i = 0; i < records_per_thread; ++i) {
+                ZETH_LOG(info) << "thread " << t << " record " << i;
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    log_flush();
+
+    // All records are written, each on its own line, in order for each thread
+    const std::vector<std::string> lines = split_lines(out.str());
+    ASSERT_EQ(num_threads * records_per_thread, lines.size());
+    std::vector<size_t> next_record(num_threads, 0);
+    for (const std::string &line : lines) {
+        size_t t;
+        size_t i;
+        std::istringstream in(line.substr(line.find("] thread ") + 9));
+        std::string record;
+        in >> t >> record >> i;
+        ASSERT_EQ(next_record[t], i);
+        ++next_record[t];
+    }
+
+    log_set_output(std::cout);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/bits.hpp"
+#include "libzeth/core/packed_bits.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace libzeth;
+
+namespace
+{
+
+TEST(PackedBitsTest, HexAndArrayConversions)
+{
+    const std::string hex = "0123456789abcdef";
+    const packed_bits<64> a = packed_bits<64>::from_hex(hex);
+    ASSERT_EQ(1U, packed_bits<64>::num_limbs);
+    ASSERT_EQ(0x0123456789abcdefULL, a.limbs()[0]);
+    ASSERT_EQ(hex, a.to_hex());
+    ASSERT_EQ(bits64_from_hex(hex), a.to_array());
+    ASSERT_EQ(bit_vector_from_hex(hex), a.to_vector());
+    ASSERT_EQ(a, packed_bits<64>::from_array(a.to_array()));
+    ASSERT_EQ(a, packed_bits<64>::from_vector(a.to_vector()));
+
+    // Bits are ordered from the most significant
+    ASSERT_FALSE(a.test(0));
+    ASSERT_TRUE(a.test(7));
+    ASSERT_TRUE(a.test(63));
+}
+
+TEST(PackedBitsTest, Bits254)
+{
+    const std::string hex =
+        "15b86771a6ac5a24fb0a9a4d369d00070f495685c1783bec6b2d21f5efa24eef";
+    const packed_bits<254> a = packed_bits<254>::from_hex(hex);
+    ASSERT_EQ(4U, packed_bits<254>::num_limbs);
+    ASSERT_EQ(0x6b2d21f5efa24eefULL, a.limbs()[0]);
+    ASSERT_EQ(0x15b86771a6ac5a24ULL, a.limbs()[3]);
+    ASSERT_EQ(hex, a.to_hex());
+
+    // Matches the bit-by-bit decoding
+    ASSERT_EQ(bits254_from_vector(bit_vector_254_from_hex(hex)), a.to_array());
+    ASSERT_EQ(a, packed_bits<254>::from_array(bits254_from_hex(hex)));
+
+    // Values which do not fit in 254 bits are rejected
+    ASSERT_THROW(
+        packed_bits<254>::from_hex(
+            "45b86771a6ac5a24fb0a9a4d369d00070f495685c1783bec6b2d21f5efa24eef"),
+        std::length_error);
+    ASSERT_THROW(
+        packed_bits<64>::from_hex("0123456789abcdeg"), std::invalid_argument);
+}
+
+TEST(PackedBitsTest, AddAndXor)
+{
+    const packed_bits<64> a = packed_bits<64>::from_hex("ffffffffffffffff");
+    const packed_bits<64> one = packed_bits<64>::from_hex("1");
+
+    // Addition wraps, unless the carry is checked
+    ASSERT_TRUE(a.add(one).is_zero());
+    ASSERT_THROW(a.add(one, true), std::overflow_error);
+
+    // Carry across limbs, and out of the last (partial) limb
+    const packed_bits<254> b = packed_bits<254>::from_hex(
+        "000000000000000000000000000000000000000000000000ffffffffffffffff");
+    const packed_bits<254> b_one = packed_bits<254>::from_hex("1");
+    ASSERT_EQ(
+        "0000000000000000000000000000000000000000000000010000000000000000",
+        b.add(b_one, true).to_hex());
+    const packed_bits<254> max = packed_bits<254>::from_hex(
+        "3fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+    ASSERT_TRUE(max.add(b_one).is_zero());
+    ASSERT_THROW(max.add(b_one, true), std::overflow_error);
+
+    // Compare with the bit-by-bit implementation
+    const bits64 x = bits64_from_hex("2f0000000000000f");
+    const bits64 y = bits64_from_hex("10000000000000f1");
+    ASSERT_EQ(bits64_from_hex("3f00000000000100"), bits_add<64>(x, y, true));
+    ASSERT_EQ(bits64_from_hex("3f000000000000fe"), bits_xor<64>(x, y));
+    ASSERT_EQ(
+        packed_bits<64>::from_hex("3f000000000000fe"),
+        packed_bits<64>::from_array(x) ^ packed_bits<64>::from_array(y));
+}
+
+TEST(PackedBitsTest, BigintConversions)
+{
+    const packed_bits<254> a = packed_bits<254>::from_hex(
+        "15b86771a6ac5a24fb0a9a4d369d00070f495685c1783bec6b2d21f5efa24eef");
+    const libff::bigint<4> a_bigint = a.to_bigint<4>();
+    ASSERT_EQ(0x6b2d21f5efa24eefULL, (uint64_t)a_bigint.data[0]);
+    ASSERT_EQ(0x15b86771a6ac5a24ULL, (uint64_t)a_bigint.data[3]);
+    ASSERT_EQ(a, packed_bits<254>::from_bigint(a_bigint));
+
+    // Values which do not fit are rejected
+    ASSERT_THROW(packed_bits<64>::from_bigint(a_bigint), std::overflow_error);
+    libff::bigint<4> too_large = a_bigint;
+    too_large.data[3] |= 0x4000000000000000ULL;
+    ASSERT_THROW(packed_bits<254>::from_bigint(too_large), std::overflow_error);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
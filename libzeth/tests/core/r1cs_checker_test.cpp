@@ -0,0 +1,142 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/circuits/circuit_types.hpp"
+#include "libzeth/core/r1cs_checker.hpp"
+#include "libzeth/tests/circuits/simple_test.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+
+using ppT = libzeth::ppT;
+using Fr = libff::Fr<ppT>;
+
+namespace
+{
+
+// Constraint system with num_constraints constraints of the form:
+//
+//   x_i * x_i = y_i
+//
+// and a satisfying assignment.
+void square_constraints(
+    const size_t num_constraints,
+    libsnark::r1cs_constraint_system<Fr> &cs,
+    libsnark::r1cs_variable_assignment<Fr> &assignment)
+{
+    cs.primary_input_size = 0;
+    cs.auxiliary_input_size = 2 * num_constraints;
+    assignment.resize(2 * num_constraints);
+    for (size_t i = 0; i < num_constraints; ++i) {
+        const libsnark::variable<Fr> x(2 * i + 1);
+        const libsnark::variable<Fr> y(2 * i + 2);
+        cs.add_constraint(libsnark::r1cs_constraint<Fr>(x, x, y));
+
+        const Fr x_value = Fr::random_element();
+        assignment[2 * i] = x_value;
+        assignment[2 * i + 1] = x_value * x_value;
+    }
+}
+
+TEST(R1CSCheckerTest, SimpleCircuit)
+{
+    libsnark::protoboard<Fr> pb;
+    libzeth::test::simple_circuit<Fr>(pb);
+
+    // x = 3 => g1 = 9, g2 = 27, y = 27 + 36 + 6 + 5 = 74
+    pb.val(libsnark::variable<Fr>(1)) = Fr(74);
+    pb.val(libsnark::variable<Fr>(2)) = Fr(3);
+    pb.val(libsnark::variable<Fr>(3)) = Fr(9);
+    pb.val(libsnark::variable<Fr>(4)) = Fr(27);
+
+    const libzeth::r1cs_checker<Fr> checker(pb.get_constraint_system());
+    ASSERT_TRUE(checker
+                    .check(
+                        pb.full_variable_assignment(),
+                        libzeth::r1cs_check_mode::full,
+                        4)
+                    .empty());
+
+    // Invalid y
+    pb.val(libsnark::variable<Fr>(1)) = Fr(75);
+    const std::vector<libzeth::r1cs_unsatisfied_constraint> unsatisfied =
+        checker.check(
+            pb.full_variable_assignment(), libzeth::r1cs_check_mode::full, 4);
+    ASSERT_EQ(1U, unsatisfied.size());
+    ASSERT_EQ(2U, unsatisfied[0].index);
+#ifdef ZETH_ANNOTATIONS
+    ASSERT_EQ("y", unsatisfied[0].annotation);
+#endif
+
+    // Checking disabled
+    ASSERT_TRUE(checker
+                    .check(
+                        pb.full_variable_assignment(),
+                        libzeth::r1cs_check_mode::off,
+                        4)
+                    .empty());
+}
+
+TEST(R1CSCheckerTest, FirstFailuresInOrder)
+{
+    const size_t num_constraints = 10000;
+    libsnark::r1cs_constraint_system<Fr> cs;
+    libsnark::r1cs_variable_assignment<Fr> assignment;
+    square_constraints(num_constraints, cs, assignment);
+
+    const libzeth::r1cs_checker<Fr> checker(cs);
+    ASSERT_TRUE(
+        checker.check(assignment, libzeth::r1cs_check_mode::full, 8).empty());
+
+    // Break constraints (spanning several chunks), in descending order.
+    const std::vector<size_t> broken{9999, 7000, 4096, 1025, 1024, 3};
+    for (const size_t i : broken) {
+        assignment[2 * i + 1] += Fr::one();
+    }
+
+    const std::vector<libzeth::r1cs_unsatisfied_constraint> first_4 =
+        checker.check(assignment, libzeth::r1cs_check_mode::full, 4);
+    ASSERT_EQ(4U, first_4.size());
+    ASSERT_EQ(3U, first_4[0].index);
+    ASSERT_EQ(1024U, first_4[1].index);
+    ASSERT_EQ(1025U, first_4[2].index);
+    ASSERT_EQ(4096U, first_4[3].index);
+
+    const std::vector<libzeth::r1cs_unsatisfied_constraint> all =
+        checker.check(assignment, libzeth::r1cs_check_mode::full, 100);
+    ASSERT_EQ(broken.size(), all.size());
+
+    // Sampled checks only report broken constraints, and cover everything
+    // when the sample is at least as large as the constraint system.
+    const std::vector<libzeth::r1cs_unsatisfied_constraint> sampled =
+        checker.check(assignment, libzeth::r1cs_check_mode::sampled, 100, 500);
+    for (const libzeth::r1cs_unsatisfied_constraint &c : sampled) {
+        ASSERT_NE(
+            broken.end(), std::find(broken.begin(), broken.end(), c.index));
+    }
+    ASSERT_EQ(
+        broken.size(),
+        checker
+            .check(
+                assignment,
+                libzeth::r1cs_check_mode::sampled,
+                100,
+                num_constraints)
+            .size());
+
+    // Assignment of the wrong size
+    assignment.pop_back();
+    ASSERT_THROW(
+        checker.check(assignment, libzeth::r1cs_check_mode::full, 1),
+        std::invalid_argument);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ppT::init_public_params();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/circuits/circuit_types.hpp"
+#include "libzeth/core/r1cs_compaction.hpp"
+#include "libzeth/snarks/groth16/groth16_snark.hpp"
+#include "libzeth/tests/circuits/simple_test.hpp"
+
+#include <gtest/gtest.h>
+
+using ppT = libzeth::ppT;
+using Fr = libff::Fr<ppT>;
+using snark = libzeth::groth16_snark<ppT>;
+
+namespace
+{
+
+// Simple circuit, with witness for x = `x_value`.
+void simple_circuit_with_witness(
+    libsnark::protoboard<Fr> &pb, const size_t x_value)
+{
+    libzeth::test::simple_circuit<Fr>(pb);
+    const Fr x(x_value);
+    const Fr g1 = x * x;
+    const Fr g2 = g1 * x;
+    pb.val(libsnark::variable<Fr>(1)) = g2 + Fr(4) * g1 + Fr(2) * x + Fr(5);
+    pb.val(libsnark::variable<Fr>(2)) = x;
+    pb.val(libsnark::variable<Fr>(3)) = g1;
+    pb.val(libsnark::variable<Fr>(4)) = g2;
+}
+
+TEST(R1CSCompactionTest, SimpleCircuit)
+{
+    libsnark::protoboard<Fr> pb;
+    simple_circuit_with_witness(pb, 3);
+    ASSERT_TRUE(pb.is_satisfied());
+
+    // The final (linear) constraint defines g2 in terms of y, g1 and x.
+    const libzeth::r1cs_compaction<Fr> compaction(pb.get_constraint_system());
+    const libsnark::r1cs_constraint_system<Fr> &cs =
+        compaction.constraint_system();
+    ASSERT_EQ(2U, cs.num_constraints());
+    ASSERT_EQ(3U, cs.num_variables());
+    ASSERT_EQ(1U, cs.num_inputs());
+
+    const libsnark::r1cs_auxiliary_input<Fr> auxiliary =
+        compaction.auxiliary_input(pb.full_variable_assignment());
+    ASSERT_TRUE(cs.is_satisfied(pb.primary_input(), auxiliary));
+
+    // Invalid witnesses remain invalid
+    pb.val(libsnark::variable<Fr>(1)) += Fr::one();
+    ASSERT_FALSE(cs.is_satisfied(
+        pb.primary_input(),
+        compaction.auxiliary_input(pb.full_variable_assignment())));
+}
+
+TEST(R1CSCompactionTest, ChainedDefinitions)
+{
+    // Variables: 1 = y (primary), 2 = x, 3 = a, 4 = b, 5 = c, 6 = d
+    //   1 * (a + b) = c
+    //   (x + 1) * 1 = a
+    //   2 * (a + x) = b
+    //   c * c = d
+    //   d * 1 = y
+    // The definition of c must be updated as a and b are eliminated.
+    const libsnark::variable<Fr> y(1), x(2), a(3), b(4), c(5), d(6);
+    libsnark::r1cs_constraint_system<Fr> cs;
+    cs.primary_input_size = 1;
+    cs.auxiliary_input_size = 5;
+    cs.add_constraint(libsnark::r1cs_constraint<Fr>(1, a + b, c));
+    cs.add_constraint(libsnark::r1cs_constraint<Fr>(x + 1, 1, a));
+    cs.add_constraint(libsnark::r1cs_constraint<Fr>(2, a + x, b));
+    cs.add_constraint(libsnark::r1cs_constraint<Fr>(c, c, d));
+    cs.add_constraint(libsnark::r1cs_constraint<Fr>(d, 1, y));
+
+    const Fr x_value(7);
+    const Fr a_value = x_value + Fr::one();
+    const Fr b_value = Fr(2) * (a_value + x_value);
+    const Fr c_value = a_value + b_value;
+    const Fr d_value = c_value * c_value;
+    const libsnark::r1cs_primary_input<Fr> primary{d_value};
+    const libsnark::r1cs_variable_assignment<Fr> assignment{
+        d_value, x_value, a_value, b_value, c_value, d_value};
+    ASSERT_TRUE(cs.is_satisfied(
+        primary,
+        libsnark::r1cs_auxiliary_input<Fr>(
+            assignment.begin() + 1, assignment.end())));
+
+    // All linear constraints are removed, leaving c (in terms of x) * c = y.
+    const libzeth::r1cs_compaction<Fr> compaction(cs);
+    const libsnark::r1cs_constraint_system<Fr> &compacted =
+        compaction.constraint_system();
+    ASSERT_EQ(1U, compacted.num_constraints());
+    ASSERT_EQ(2U, compacted.num_variables());
+    ASSERT_TRUE(compacted.is_satisfied(
+        primary, compaction.auxiliary_input(assignment)));
+}
+
+TEST(R1CSCompactionTest, ProveAndVerify)
+{
+    libsnark::protoboard<Fr> pb;
+    simple_circuit_with_witness(pb, 5);
+
+    const libzeth::r1cs_compaction<Fr> compaction(pb.get_constraint_system());
+    const snark::KeypairT keypair =
+        snark::generate_setup(compaction.constraint_system());
+    const snark::ProofT proof = snark::generate_proof(
+        keypair.pk,
+        pb.primary_input(),
+        compaction.auxiliary_input(pb.full_variable_assignment()));
+    ASSERT_TRUE(snark::verify(pb.primary_input(), proof, keypair.vk));
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ppT::init_public_params();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
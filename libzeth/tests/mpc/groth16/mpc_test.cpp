@@ -14,9 +14,11 @@
 #include "libzeth/snarks/groth16/groth16_snark.hpp"
 #include "libzeth/tests/circuits/simple_test.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <thread>
+#include <vector>
 
 using namespace libzeth;
 using namespace libsnark;
@@ -513,6 +515,36 @@ TEST(MPCTests, Phase2AccumulatorReadWrite)
     ASSERT_LT(accumulator_compressed.size(), accumulator_serialized.size());
 }
 
+TEST(MPCTests, Phase2AccumulatorCompressedReadWriteLarge)
+{
+    // Enough L elements that (de)compression is split into several chunks,
+    // including a partial final chunk and a point at infinity.
+    const size_t seed = 9;
+    const size_t degree = 16;
+    const size_t num_L_elements = 5000;
+    srs_mpc_phase2_accumulator<ppT> accumulator =
+        dummy_initial_accumulator<ppT>(
+            libff::Fr<ppT>(seed), degree, num_L_elements);
+    accumulator.L_g1[4097] = G1::zero();
+
+    std::string accumulator_compressed;
+    {
+        std::ostringstream out;
+        accumulator.write_compressed(out);
+        accumulator_compressed = out.str();
+    }
+
+    srs_mpc_phase2_accumulator<ppT> accumulator_decompressed = [&]() {
+        std::istringstream in(accumulator_compressed);
+        in.exceptions(
+            std::ios_base::eofbit | std::ios_base::badbit |
+            std::ios_base::failbit);
+        return srs_mpc_phase2_accumulator<ppT>::read_compressed(in);
+    }();
+
+    ASSERT_EQ(accumulator, accumulator_decompressed);
+}
+
 TEST(MPCTests, Phase2ChallengeReadWrite)
 {
     const size_t seed = 9;
@@ -547,6 +579,54 @@ TEST(MPCTests, Phase2ChallengeReadWrite)
     ASSERT_EQ(challenge, challenge_deserialized);
 }
 
+TEST(MPCTests, Phase2BeginWriteChallenge)
+{
+    const r1cs_constraint_system<Fr> constraint_system =
+        get_simple_constraint_system();
+    qap_instance<Fr> qap = r1cs_to_qap_instance_map(constraint_system, true);
+    const srs_powersoftau<ppT> pot = dummy_powersoftau<ppT>(qap.degree());
+    const srs_lagrange_evaluations<ppT> lagrange =
+        powersoftau_compute_lagrange_evaluations<ppT>(pot, qap.degree());
+    const srs_mpc_layer_L1<ppT> layer1 =
+        mpc_compute_linearcombination<ppT>(pot, lagrange, qap);
+    const size_t num_inputs = qap.num_inputs();
+
+    std::string layer1_serialized;
+    {
+        std::ostringstream out;
+        layer1.write(out);
+        layer1_serialized = out.str();
+    }
+
+    mpc_hash_t cs_hash;
+    mpc_compute_hash(cs_hash, layer1_serialized);
+
+    // Challenge computed in memory
+    std::string expect_challenge_serialized;
+    {
+        std::ostringstream out;
+        srs_mpc_phase2_initial_challenge<ppT>(
+            srs_mpc_phase2_begin<ppT>(cs_hash, layer1, num_inputs))
+            .write(out);
+        expect_challenge_serialized = out.str();
+    }
+
+    // Challenge streamed from the serialized layer1
+    std::string challenge_serialized;
+    {
+        std::istringstream in(layer1_serialized);
+        in.exceptions(
+            std::ios_base::eofbit | std::ios_base::badbit |
+            std::ios_base::failbit);
+        std::ostringstream out;
+        srs_mpc_phase2_begin_write_challenge<ppT>(
+            cs_hash, in, num_inputs, out);
+        challenge_serialized = out.str();
+    }
+
+    ASSERT_EQ(expect_challenge_serialized, challenge_serialized);
+}
+
 TEST(MPCTests, Phase2ResponseReadWrite)
 {
     const size_t seed = 9;
@@ -577,6 +657,57 @@ TEST(MPCTests, Phase2ResponseReadWrite)
     ASSERT_EQ(response, response_deserialized);
 }
 
+TEST(MPCTests, Phase2ResponseChunked)
+{
+    const size_t seed = 9;
+    const size_t degree = 16;
+    const size_t num_L_elements = 7;
+    const srs_mpc_phase2_challenge<ppT> challenge =
+        srs_mpc_phase2_initial_challenge(dummy_initial_accumulator<ppT>(
+            libff::Fr<ppT>(seed), degree, num_L_elements));
+    const srs_mpc_phase2_accumulator<ppT> &last = challenge.accumulator;
+    const size_t H_size = last.H_g1.size();
+    const size_t num_entries = H_size + num_L_elements;
+    const libff::Fr<ppT> secret = libff::Fr<ppT>(seed - 1);
+    const srs_mpc_phase2_response<ppT> expect_response =
+        srs_mpc_phase2_compute_response<ppT>(challenge, secret);
+    const srs_mpc_phase2_accumulator<ppT> &expect_accum =
+        expect_response.new_accumulator;
+
+    // Resume from several points (including part way through H_g1 and
+    // L_g1), with chunks which span the end of H_g1.
+    const size_t chunk_size = 5;
+    for (const size_t num_completed : {(size_t)0, (size_t)3, H_size + 2}) {
+        libff::G1_vector<ppT> H_g1(H_size);
+        libff::G1_vector<ppT> L_g1(num_L_elements);
+        for (size_t i = 0; i < std::min(num_completed, H_size); ++i) {
+            H_g1[i] = expect_accum.H_g1[i];
+        }
+        for (size_t i = H_size; i < num_completed; ++i) {
+            L_g1[i - H_size] = expect_accum.L_g1[i - H_size];
+        }
+
+        std::vector<size_t> completed;
+        srs_mpc_phase2_publickey<ppT> publickey = expect_response.publickey;
+        const srs_mpc_phase2_response<ppT> response =
+            srs_mpc_phase2_compute_response_chunked<ppT>(
+                challenge,
+                secret,
+                std::move(publickey),
+                H_g1,
+                L_g1,
+                num_completed,
+                chunk_size,
+                [&completed](size_t n) { completed.push_back(n); });
+
+        ASSERT_EQ(expect_response, response);
+        ASSERT_EQ(
+            (num_entries - num_completed + chunk_size - 1) / chunk_size,
+            completed.size());
+        ASSERT_EQ(num_entries, completed.back());
+    }
+}
+
 TEST(MPCTests, Phase2Accumulation)
 {
     const size_t seed = 9;
@@ -876,6 +1007,45 @@ TEST(MPCTests, Phase2TranscriptVerification)
     }
 }
 
+TEST(MPCTests, Phase2PublicKeysVerification)
+{
+    const size_t seed = 9;
+    const size_t degree = 16;
+    const size_t num_L_elements = 7;
+
+    // Simulate 4 contributions and collect the public keys.
+    srs_mpc_phase2_challenge<ppT> challenge =
+        srs_mpc_phase2_initial_challenge(dummy_initial_accumulator<ppT>(
+            libff::Fr<ppT>(seed), degree, num_L_elements));
+    const G1 initial_delta = challenge.accumulator.delta_g1;
+    std::vector<srs_mpc_phase2_publickey<ppT>> publickeys;
+    for (size_t i = 1; i < 5; ++i) {
+        srs_mpc_phase2_response<ppT> response =
+            srs_mpc_phase2_compute_response<ppT>(
+                challenge, libff::Fr<ppT>(seed + i));
+        publickeys.push_back(response.publickey);
+        challenge = srs_mpc_phase2_compute_challenge<ppT>(std::move(response));
+    }
+
+    ASSERT_EQ(
+        publickeys.size(),
+        srs_mpc_phase2_verify_publickeys<ppT>(initial_delta, publickeys));
+    ASSERT_EQ(
+        0U,
+        srs_mpc_phase2_verify_publickeys<ppT>(
+            initial_delta + G1::one(), publickeys));
+
+    // Invalidate the POK of the 3rd contribution, and check that it is
+    // identified as the first invalid key.
+    std::vector<srs_mpc_phase2_publickey<ppT>> invalid_publickeys = publickeys;
+    invalid_publickeys[2].s_delta_j_g1 =
+        invalid_publickeys[2].s_delta_j_g1 + G1::one();
+    ASSERT_EQ(
+        2U,
+        srs_mpc_phase2_verify_publickeys<ppT>(
+            initial_delta, invalid_publickeys));
+}
+
 } // namespace
 
 int main(int argc, char **argv)
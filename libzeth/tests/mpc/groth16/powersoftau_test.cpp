@@ -162,6 +162,54 @@ TEST(PowersOfTauTests, SameRatioBatchTest)
     ASSERT_FALSE(invalid_consecutive_g2);
 }
 
+TEST(PowersOfTauTests, SameRatioAccumulatorTest)
+{
+    const size_t num_powers = 8;
+    const Fr x = Fr::random_element();
+    const Fr xx = x + Fr::one();
+    const G1 x_g1 = x * G1::one();
+    const G2 x_g2 = x * G2::one();
+
+    std::vector<G1> powers_g1(num_powers);
+    std::vector<G2> powers_g2(num_powers);
+    powers_g1[0] = G1::one();
+    powers_g2[0] = G2::one();
+    for (size_t i = 1; i < num_powers; ++i) {
+        powers_g1[i] = x * powers_g1[i - 1];
+        powers_g2[i] = x * powers_g2[i - 1];
+    }
+
+    std::vector<G1> invalid_powers_g1(powers_g1);
+    invalid_powers_g1[4] = xx * invalid_powers_g1[3];
+
+    // Valid equations. All terms share G2 elements, so only 2 Miller loops
+    // should be required.
+    same_ratio_accumulator<ppT> valid;
+    valid.add(G1::one(), x_g1, G2::one(), x_g2);
+    valid.add(powers_g1[2], powers_g1[3], G2::one(), x_g2);
+    valid.add_consecutive(powers_g1, G2::one(), x_g2);
+    ASSERT_EQ(2U, valid.num_terms());
+    ASSERT_TRUE(valid.check());
+
+    valid.add_consecutive(G1::one(), x_g1, powers_g2);
+    ASSERT_TRUE(valid.check());
+
+    // A single invalid equation causes the whole check to fail.
+    same_ratio_accumulator<ppT> invalid_single(valid);
+    invalid_single.add(G1::one(), x_g1, G2::one(), xx * G2::one());
+    ASSERT_FALSE(invalid_single.check());
+
+    same_ratio_accumulator<ppT> invalid_consecutive(valid);
+    invalid_consecutive.add_consecutive(invalid_powers_g1, G2::one(), x_g2);
+    ASSERT_FALSE(invalid_consecutive.check());
+
+    // Products of Miller loops can be combined across accumulators.
+    ASSERT_TRUE(miller_loop_product_is_one<ppT>(
+        valid.miller_loop_product() * valid.miller_loop_product()));
+    ASSERT_FALSE(miller_loop_product_is_one<ppT>(
+        valid.miller_loop_product() * invalid_single.miller_loop_product()));
+}
+
 TEST(PowersOfTauTests, PowersOfTauIsWellFormed)
 {
     const size_t n = 16;
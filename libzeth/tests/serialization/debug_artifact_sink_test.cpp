@@ -0,0 +1,200 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/serialization/debug_artifact_sink.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <future>
+#include <gtest/gtest.h>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace libzeth;
+
+namespace
+{
+
+boost::filesystem::path temp_directory()
+{
+    const boost::filesystem::path dir =
+        boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("zeth_debug_artifacts_%%%%%%%%");
+    boost::filesystem::create_directories(dir);
+    return dir;
+}
+
+std::vector<std::string> list_files(const boost::filesystem::path &dir)
+{
+    std::vector<std::string> files;
+    for (boost::filesystem::directory_iterator it(dir), end; it != end;
+         ++it) {
+        files.push_back(it->path().filename().string());
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+std::string read_file(const boost::filesystem::path &path)
+{
+    std::ifstream in(path.c_str());
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+TEST(DebugArtifactSinkTest, WriteArtifacts)
+{
+    const boost::filesystem::path dir = temp_directory();
+    {
+        debug_artifact_sink sink(dir, true);
+        const std::string request = sink.begin_request("prove");
+        ASSERT_NE("", request);
+        ASSERT_NE(std::string::npos, request.find("-prove"));
+
+        const std::string content = "{\"proof\": 1}";
+        ASSERT_TRUE(sink.write(
+            request, "proof.json", [content](std::ostream &out) {
+                out << content;
+            }));
+        sink.flush();
+
+        const std::vector<std::string> files = list_files(dir);
+        ASSERT_EQ(1U, files.size());
+        ASSERT_EQ(request + "-proof.json", files[0]);
+        ASSERT_EQ(content, read_file(dir / files[0]));
+        ASSERT_EQ(content.size(), sink.num_bytes());
+
+        // Disabled sinks do not record requests
+        sink.set_enabled(false);
+        ASSERT_EQ("", sink.begin_request("prove"));
+    }
+    boost::filesystem::remove_all(dir);
+}
+
+TEST(DebugArtifactSinkTest, Sampling)
+{
+    const boost::filesystem::path dir = temp_directory();
+    {
+        debug_artifact_sink sink(dir, true, 0.25);
+        size_t num_recorded = 0;
+        for (size_t i = 0; i < 100; ++i) {
+            if (!sink.begin_request("prove").empty()) {
+                ++num_recorded;
+            }
+        }
+        ASSERT_EQ(25U, num_recorded);
+
+        sink.set_sample_rate(0.0);
+        ASSERT_EQ("", sink.begin_request("prove"));
+        ASSERT_NE("", sink.begin_unsampled_request("setup"));
+        ASSERT_THROW(sink.set_sample_rate(1.5), std::invalid_argument);
+    }
+    boost::filesystem::remove_all(dir);
+}
+
+TEST(DebugArtifactSinkTest, RingDirectory)
+{
+    const boost::filesystem::path dir = temp_directory();
+    const std::string content(100, 'x');
+    const auto writer = [&content](std::ostream &out) { out << content; };
+
+    std::vector<std::string> requests;
+    {
+        debug_artifact_sink sink(dir, true, 1.0, 350);
+        for (size_t i = 0; i < 5; ++i) {
+            requests.push_back(sink.begin_request("prove"));
+            sink.write(requests.back(), "proof.json", writer);
+        }
+        sink.flush();
+
+        // Only the 3 most recent artifacts are kept
+        const std::vector<std::string> files = list_files(dir);
+        ASSERT_EQ(3U, files.size());
+        for (size_t i = 0; i < 3; ++i) {
+            ASSERT_EQ(requests[i + 2] + "-proof.json", files[i]);
+        }
+        ASSERT_EQ(300U, sink.num_bytes());
+    }
+
+    // Files from a previous sink are part of the ring
+    {
+        debug_artifact_sink sink(dir, true, 1.0, 350);
+        ASSERT_EQ(300U, sink.num_bytes());
+        sink.write(sink.begin_request("prove"), "proof.json", writer);
+        sink.flush();
+        ASSERT_EQ(3U, list_files(dir).size());
+        ASSERT_FALSE(
+            boost::filesystem::exists(dir / (requests[2] + "-proof.json")));
+    }
+    boost::filesystem::remove_all(dir);
+}
+
+TEST(DebugArtifactSinkTest, ConcurrentRequests)
+{
+    const boost::filesystem::path dir = temp_directory();
+    const size_t num_threads = 4;
+    const size_t requests_per_thread = 8;
+    {
+        debug_artifact_sink sink(
+            dir, true, 1.0, debug_artifact_sink::default_max_bytes, 1024);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&sink, t]() {
+                for (size_t i = 0; i < requests_per_thread; ++i) {
+                    const std::string request = sink.begin_request("prove");
+                    sink.write(request, "proof.json", [t](std::ostream &out) {
+                        out << t;
+                    });
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    }
+
+    // All artifacts are written by the time the sink is destroyed, each to
+    // its own file.
+    const std::vector<std::string> files = list_files(dir);
+    ASSERT_EQ(num_threads * requests_per_thread, files.size());
+    ASSERT_EQ(
+        files.size(), std::set<std::string>(files.begin(), files.end()).size());
+    boost::filesystem::remove_all(dir);
+}
+
+TEST(DebugArtifactSinkTest, DropWhenQueueIsFull)
+{
+    const boost::filesystem::path dir = temp_directory();
+    {
+        debug_artifact_sink sink(dir, true, 1.0, 1024, 1);
+        std::promise<void> started;
+        std::promise<void> release;
+        std::shared_future<void> released(release.get_future());
+
+        // The first artifact blocks the writer thread, and the second fills
+        // the queue.
+        ASSERT_TRUE(sink.write(
+            "a", "1", [&started, released](std::ostream &) {
+                started.set_value();
+                released.wait();
+            }));
+        started.get_future().wait();
+        ASSERT_TRUE(sink.write("b", "1", [](std::ostream &) {}));
+        ASSERT_FALSE(sink.write("b", "2", [](std::ostream &) {}));
+        ASSERT_EQ(1U, sink.num_dropped());
+        release.set_value();
+    }
+    boost::filesystem::remove_all(dir);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
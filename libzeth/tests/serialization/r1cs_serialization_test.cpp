@@ -0,0 +1,146 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/circuits/circuit_types.hpp"
+#include "libzeth/serialization/r1cs_serialization.hpp"
+#include "libzeth/tests/circuits/simple_test.hpp"
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+using ppT = libzeth::ppT;
+using Fr = libff::Fr<ppT>;
+using r1cs_constraint_system = libsnark::r1cs_constraint_system<Fr>;
+
+namespace
+{
+
+r1cs_constraint_system simple_r1cs()
+{
+    libsnark::protoboard<Fr> pb;
+    libzeth::test::simple_circuit<Fr>(pb);
+    return pb.get_constraint_system();
+}
+
+void assert_linear_combinations_equal(
+    const libsnark::linear_combination<Fr> &expect,
+    const libsnark::linear_combination<Fr> &actual)
+{
+    ASSERT_EQ(expect.terms.size(), actual.terms.size());
+    for (size_t i = 0; i < expect.terms.size(); ++i) {
+        ASSERT_EQ(expect.terms[i].index, actual.terms[i].index);
+        ASSERT_EQ(expect.terms[i].coeff, actual.terms[i].coeff);
+    }
+}
+
+void assert_r1cs_equal(
+    const r1cs_constraint_system &expect, const r1cs_constraint_system &actual)
+{
+    ASSERT_EQ(expect.num_inputs(), actual.num_inputs());
+    ASSERT_EQ(expect.num_variables(), actual.num_variables());
+    ASSERT_EQ(expect.num_constraints(), actual.num_constraints());
+    for (size_t i = 0; i < expect.num_constraints(); ++i) {
+        assert_linear_combinations_equal(
+            expect.constraints[i].a, actual.constraints[i].a);
+        assert_linear_combinations_equal(
+            expect.constraints[i].b, actual.constraints[i].b);
+        assert_linear_combinations_equal(
+            expect.constraints[i].c, actual.constraints[i].c);
+    }
+}
+
+TEST(R1CSSerializationTest, CompactEncodeDecode)
+{
+    const r1cs_constraint_system r1cs = simple_r1cs();
+
+    std::stringstream ss;
+    libzeth::r1cs_write_compact(r1cs, ss);
+    const std::string encoded = ss.str();
+
+    // Decode from a buffer and from a stream
+    assert_r1cs_equal(
+        r1cs,
+        libzeth::r1cs_read_compact<Fr>(encoded.data(), encoded.size()));
+    assert_r1cs_equal(r1cs, libzeth::r1cs_read_compact<Fr>(ss));
+
+    // Encoding is canonical
+    std::stringstream ss2;
+    libzeth::r1cs_write_compact(
+        libzeth::r1cs_read_compact<Fr>(encoded.data(), encoded.size()), ss2);
+    ASSERT_EQ(encoded, ss2.str());
+}
+
+TEST(R1CSSerializationTest, CompactCoefficientsDeduplicated)
+{
+    // Many constraints sharing a single large coefficient.
+    const Fr coeff = -Fr(3);
+    r1cs_constraint_system r1cs;
+    r1cs.primary_input_size = 1;
+    r1cs.auxiliary_input_size = 300;
+    for (size_t i = 1; i <= 300; ++i) {
+        const libsnark::variable<Fr> var(i);
+        r1cs.add_constraint(
+            libsnark::r1cs_constraint<Fr>(coeff * var, Fr::one(), var));
+    }
+
+    std::stringstream ss;
+    libzeth::r1cs_write_compact(r1cs, ss);
+    const std::string encoded = ss.str();
+    assert_r1cs_equal(
+        r1cs,
+        libzeth::r1cs_read_compact<Fr>(encoded.data(), encoded.size()));
+
+    // Only 2 distinct coefficients (coeff and 1) are written in full.
+    const size_t coeff_size = sizeof(coeff.as_bigint().data);
+    ASSERT_LT(encoded.size(), 2 * coeff_size + 300 * 16);
+}
+
+TEST(R1CSSerializationTest, CompactInvalidData)
+{
+    const r1cs_constraint_system r1cs = simple_r1cs();
+    std::stringstream ss;
+    libzeth::r1cs_write_compact(r1cs, ss);
+    std::string encoded = ss.str();
+
+    // Truncated
+    ASSERT_THROW(
+        libzeth::r1cs_read_compact<Fr>(encoded.data(), encoded.size() - 1),
+        std::invalid_argument);
+
+    // Trailing data
+    const std::string trailing = encoded + '\0';
+    ASSERT_THROW(
+        libzeth::r1cs_read_compact<Fr>(trailing.data(), trailing.size()),
+        std::invalid_argument);
+
+    // Bad magic
+    encoded[0] = 'x';
+    ASSERT_THROW(
+        libzeth::r1cs_read_compact<Fr>(encoded.data(), encoded.size()),
+        std::invalid_argument);
+
+    // Header declaring 2^60 constraints, with no constraint data
+    const std::string huge_header(
+        "zr1c\x01\x00\x00\x80\x80\x80\x80\x80\x80\x80\x80\x10", 16);
+    ASSERT_THROW(
+        libzeth::r1cs_read_compact<Fr>(huge_header.data(), huge_header.size()),
+        std::invalid_argument);
+
+    // Version varint with bits beyond 64
+    const std::string overflow_header(
+        "zr1c\xff\xff\xff\xff\xff\xff\xff\xff\xff\x02", 14);
+    ASSERT_THROW(
+        libzeth::r1cs_read_compact<Fr>(
+            overflow_header.data(), overflow_header.size()),
+        std::invalid_argument);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ppT::init_public_params();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,127 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/extended_proof.hpp"
+#include "libzeth/snarks/groth16/groth16_snark.hpp"
+#include "libzeth/tests/circuits/simple_test.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+
+using ppT = libff::default_ec_pp;
+using FieldT = libff::Fr<ppT>;
+using snark = libzeth::groth16_snark<ppT>;
+using namespace libsnark;
+using namespace libzeth;
+
+namespace
+{
+
+// Proof for the simple circuit, with x = `x_value`.
+extended_proof<ppT, snark> simple_circuit_proof(
+    const snark::ProvingKeyT &pk, const size_t x_value)
+{
+    const FieldT x(x_value);
+    const FieldT g1 = x * x;
+    const FieldT g2 = g1 * x;
+    const FieldT y = g2 + FieldT(4) * g1 + FieldT(2) * x + FieldT(5);
+
+    r1cs_primary_input<FieldT> primary{y};
+    const r1cs_auxiliary_input<FieldT> auxiliary{x, g1, g2};
+    snark::ProofT proof =
+        r1cs_gg_ppzksnark_prover(pk, primary, auxiliary, true);
+    return extended_proof<ppT, snark>(proof, primary);
+}
+
+TEST(Groth16SnarkTests, VerifyBatch)
+{
+    protoboard<FieldT> pb;
+    test::simple_circuit<FieldT>(pb);
+    const snark::KeypairT keypair = snark::generate_setup(pb);
+
+    const size_t num_proofs = 9;
+    std::vector<extended_proof<ppT, snark>> ext_proofs;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        ext_proofs.push_back(simple_circuit_proof(keypair.pk, i + 1));
+    }
+
+    // All valid
+    std::vector<size_t> invalid_indices;
+    ASSERT_TRUE(snark::verify_batch(ext_proofs, keypair.vk, invalid_indices));
+    ASSERT_TRUE(invalid_indices.empty());
+
+    // Empty batch
+    ASSERT_TRUE(snark::verify_batch({}, keypair.vk, invalid_indices));
+    ASSERT_TRUE(invalid_indices.empty());
+
+    // Invalidate some proofs: wrong public input, swapped proof element, and
+    // wrong number of inputs.
+    {
+        r1cs_primary_input<FieldT> inputs = ext_proofs[2].get_primary_inputs();
+        inputs[0] = inputs[0] + FieldT::one();
+        snark::ProofT proof = ext_proofs[2].get_proof();
+        ext_proofs[2] = extended_proof<ppT, snark>(proof, inputs);
+    }
+    {
+        r1cs_primary_input<FieldT> inputs = ext_proofs[5].get_primary_inputs();
+        snark::ProofT proof = ext_proofs[5].get_proof();
+        proof.g_C = ext_proofs[6].get_proof().g_C;
+        ext_proofs[5] = extended_proof<ppT, snark>(proof, inputs);
+    }
+    {
+        r1cs_primary_input<FieldT> inputs = ext_proofs[8].get_primary_inputs();
+        inputs.push_back(FieldT::one());
+        snark::ProofT proof = ext_proofs[8].get_proof();
+        ext_proofs[8] = extended_proof<ppT, snark>(proof, inputs);
+    }
+
+    const std::vector<size_t> expect_invalid_indices{2, 5, 8};
+    ASSERT_FALSE(snark::verify_batch(ext_proofs, keypair.vk, invalid_indices));
+    ASSERT_EQ(expect_invalid_indices, invalid_indices);
+
+    // Batch results must agree with individual verification
+    for (size_t i = 0; i < num_proofs; ++i) {
+        const bool valid = snark::verify(
+            ext_proofs[i].get_primary_inputs(),
+            ext_proofs[i].get_proof(),
+            keypair.vk);
+        const bool expect_valid =
+            expect_invalid_indices.end() == std::find(
+                                                expect_invalid_indices.begin(),
+                                                expect_invalid_indices.end(),
+                                                i);
+        ASSERT_EQ(expect_valid, valid);
+    }
+}
+
+TEST(Groth16SnarkTests, VerifyPrepared)
+{
+    protoboard<FieldT> pb;
+    test::simple_circuit<FieldT>(pb);
+    const snark::KeypairT keypair = snark::generate_setup(pb);
+    const snark::PreparedVerificationKeyT pvk =
+        snark::prepare_verification_key(keypair.vk);
+
+    const extended_proof<ppT, snark> ext_proof =
+        simple_circuit_proof(keypair.pk, 3);
+    ASSERT_TRUE(snark::verify(
+        ext_proof.get_primary_inputs(), ext_proof.get_proof(), pvk));
+
+    r1cs_primary_input<FieldT> invalid_inputs = ext_proof.get_primary_inputs();
+    invalid_inputs[0] = invalid_inputs[0] + FieldT::one();
+    ASSERT_FALSE(snark::verify(invalid_inputs, ext_proof.get_proof(), pvk));
+    ASSERT_FALSE(snark::verify(
+        r1cs_primary_input<FieldT>{}, ext_proof.get_proof(), pvk));
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    ppT::init_public_params();
+    libff::inhibit_profiling_info = true;
+    libff::inhibit_profiling_counters = true;
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
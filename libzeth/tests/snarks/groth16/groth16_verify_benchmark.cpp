@@ -0,0 +1,125 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/core/extended_proof.hpp"
+#include "libzeth/snarks/groth16/groth16_snark.hpp"
+#include "libzeth/tests/circuits/simple_test.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+// Compares the latency of single-proof verification using the verification
+// key, and using the prepared verification key, and reports the one-off cost
+// of preparing the key. Usage:
+//
+//   groth16_verify_benchmark [<num iterations>]
+
+using ppT = libff::default_ec_pp;
+using FieldT = libff::Fr<ppT>;
+using snark = libzeth::groth16_snark<ppT>;
+using clock_type = std::chrono::steady_clock;
+
+namespace
+{
+
+const size_t default_num_iterations = 64;
+
+// Proof for the simple circuit, with x = `x_value`.
+libzeth::extended_proof<ppT, snark> simple_circuit_proof(
+    const snark::ProvingKeyT &pk, const size_t x_value)
+{
+    const FieldT x(x_value);
+    const FieldT g1 = x * x;
+    const FieldT g2 = g1 * x;
+    const FieldT y = g2 + FieldT(4) * g1 + FieldT(2) * x + FieldT(5);
+
+    libsnark::r1cs_primary_input<FieldT> primary{y};
+    const libsnark::r1cs_auxiliary_input<FieldT> auxiliary{x, g1, g2};
+    snark::ProofT proof =
+        libsnark::r1cs_gg_ppzksnark_prover(pk, primary, auxiliary, true);
+    return libzeth::extended_proof<ppT, snark>(proof, primary);
+}
+
+double microseconds(const clock_type::duration &duration)
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               duration)
+               .count() /
+           1000.0;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    size_t num_iterations = default_num_iterations;
+    if (argc > 2) {
+        std::cerr << "Usage: " << argv[0] << " [<num iterations>]"
+                  << std::endl;
+        return 1;
+    }
+    if (argc == 2) {
+        try {
+            num_iterations = std::stoul(argv[1]);
+        } catch (const std::exception &) {
+            num_iterations = 0;
+        }
+        if (0 == num_iterations) {
+            std::cerr << "invalid number of iterations: " << argv[1]
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    ppT::init_public_params();
+    libff::inhibit_profiling_info = true;
+    libff::inhibit_profiling_counters = true;
+
+    libsnark::protoboard<FieldT> pb;
+    libzeth::test::simple_circuit<FieldT>(pb);
+    const snark::KeypairT keypair = snark::generate_setup(pb);
+    const libzeth::extended_proof<ppT, snark> ext_proof =
+        simple_circuit_proof(keypair.pk, 5);
+
+    // Verification with the verification key
+    const clock_type::time_point vk_start = clock_type::now();
+    for (size_t i = 0; i < num_iterations; ++i) {
+        if (!snark::verify(
+                ext_proof.get_primary_inputs(),
+                ext_proof.get_proof(),
+                keypair.vk)) {
+            std::cerr << "verification failed (vk)" << std::endl;
+            return 1;
+        }
+    }
+    const clock_type::duration vk_time = clock_type::now() - vk_start;
+
+    // One-off preparation of the key
+    const clock_type::time_point prepare_start = clock_type::now();
+    const snark::PreparedVerificationKeyT pvk =
+        snark::prepare_verification_key(keypair.vk);
+    const clock_type::duration prepare_time =
+        clock_type::now() - prepare_start;
+
+    // Verification with the prepared verification key
+    const clock_type::time_point pvk_start = clock_type::now();
+    for (size_t i = 0; i < num_iterations; ++i) {
+        if (!snark::verify(
+                ext_proof.get_primary_inputs(), ext_proof.get_proof(), pvk)) {
+            std::cerr << "verification failed (pvk)" << std::endl;
+            return 1;
+        }
+    }
+    const clock_type::duration pvk_time = clock_type::now() - pvk_start;
+
+    const double vk_us = microseconds(vk_time) / (double)num_iterations;
+    const double pvk_us = microseconds(pvk_time) / (double)num_iterations;
+    std::cout << "iterations:   " << num_iterations << "\n"
+              << "verify (vk):  " << vk_us << " us/proof\n"
+              << "prepare vk:   " << microseconds(prepare_time) << " us\n"
+              << "verify (pvk): " << pvk_us << " us/proof\n"
+              << "speedup:      " << (vk_us / pvk_us) << "x" << std::endl;
+    return 0;
+}
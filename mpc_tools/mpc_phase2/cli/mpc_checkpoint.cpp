@@ -0,0 +1,159 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "mpc_checkpoint.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <libff/common/profiling.hpp>
+
+using namespace libzeth;
+namespace po = boost::program_options;
+
+mpc_checkpoint::mpc_checkpoint()
+    : file_name()
+    , resume_enabled(false)
+    , interval_seconds(0)
+    , inputs_digest()
+    , last_save(std::chrono::steady_clock::now())
+{
+}
+
+void mpc_checkpoint::initialize_options(po::options_description &options)
+{
+    options.add_options()(
+        "resume", "Resume from an existing checkpoint (if any)")(
+        "checkpoint-interval",
+        po::value<size_t>(),
+        "Write a checkpoint at most every N seconds (default: disabled)");
+}
+
+void mpc_checkpoint::parse_options(
+    const po::variables_map &vm, const std::string &out_file)
+{
+    file_name = out_file + ".checkpoint";
+    resume_enabled = (bool)vm.count("resume");
+    interval_seconds = vm.count("checkpoint-interval")
+                           ? vm["checkpoint-interval"].as<size_t>()
+                           : 0;
+}
+
+bool mpc_checkpoint::enabled() const { return 0 != interval_seconds; }
+
+size_t mpc_checkpoint::begin(
+    const mpc_hash_t inputs_digest, const read_state_fn &read_state)
+{
+    memcpy(this->inputs_digest, inputs_digest, sizeof(mpc_hash_t));
+    last_save = std::chrono::steady_clock::now();
+
+    if (!resume_enabled) {
+        return 0;
+    }
+
+    std::ifstream inf(file_name, std::ios_base::binary | std::ios_base::in);
+    if (!inf.good()) {
+        std::cout << "no checkpoint found at " << file_name
+                  << ", starting from the beginning" << std::endl;
+        return 0;
+    }
+
+    inf.exceptions(
+        std::ios_base::eofbit | std::ios_base::badbit | std::ios_base::failbit);
+    mpc_hash_istream_wrapper in(inf);
+    in.exceptions(
+        std::ios_base::eofbit | std::ios_base::badbit | std::ios_base::failbit);
+
+    mpc_hash_t checkpoint_inputs_digest;
+    in.read((char *)checkpoint_inputs_digest, sizeof(mpc_hash_t));
+    if (0 != memcmp(
+                 checkpoint_inputs_digest, inputs_digest, sizeof(mpc_hash_t))) {
+        throw std::invalid_argument(
+            "checkpoint " + file_name + " was created from different inputs");
+    }
+
+    size_t num_completed;
+    in.read((char *)&num_completed, sizeof(num_completed));
+    read_state(in, num_completed);
+
+    // The trailing digest is not part of the hashed data, so read it directly
+    // from the underlying stream.
+    mpc_hash_t digest;
+    in.get_hash(digest);
+    mpc_hash_t expect_digest;
+    inf.read((char *)expect_digest, sizeof(mpc_hash_t));
+    if (0 != memcmp(digest, expect_digest, sizeof(mpc_hash_t))) {
+        throw std::invalid_argument("checkpoint " + file_name + " is corrupt");
+    }
+
+    std::cout << "resuming from checkpoint " << file_name << " ("
+              << num_completed << " entries completed)" << std::endl;
+    return num_completed;
+}
+
+void mpc_checkpoint::chunk_completed(
+    size_t num_completed, const write_state_fn &write_state)
+{
+    if (!enabled()) {
+        return;
+    }
+
+    const std::chrono::steady_clock::time_point now =
+        std::chrono::steady_clock::now();
+    if (now - last_save < std::chrono::seconds(interval_seconds)) {
+        return;
+    }
+
+    save(num_completed, write_state);
+    last_save = std::chrono::steady_clock::now();
+}
+
+void mpc_checkpoint::complete() const
+{
+    if (enabled() || resume_enabled) {
+        std::remove(file_name.c_str());
+    }
+}
+
+void mpc_checkpoint::save(
+    size_t num_completed, const write_state_fn &write_state)
+{
+    libff::enter_block("Writing checkpoint");
+    libff::print_indent();
+    std::cout << file_name << " (" << num_completed << " entries)"
+              << std::endl;
+
+    // Failure to write a checkpoint is reported, but does not abort the
+    // computation.
+    const std::string tmp_file_name = file_name + ".tmp";
+    try {
+        std::ofstream outf(
+            tmp_file_name, std::ios_base::binary | std::ios_base::out);
+        outf.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+        mpc_hash_ostream_wrapper out(outf);
+        out.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+
+        out.write((const char *)inputs_digest, sizeof(mpc_hash_t));
+        out.write((const char *)&num_completed, sizeof(num_completed));
+        write_state(out, num_completed);
+
+        mpc_hash_t digest;
+        out.get_hash(digest);
+        outf.write((const char *)digest, sizeof(mpc_hash_t));
+        outf.close();
+    } catch (std::ios_base::failure &e) {
+        std::cerr << "failed to write checkpoint " << tmp_file_name << ": "
+                  << e.what() << std::endl;
+        libff::leave_block("Writing checkpoint");
+        return;
+    }
+
+    if (0 != std::rename(tmp_file_name.c_str(), file_name.c_str())) {
+        std::cerr << "failed to rename checkpoint " << tmp_file_name
+                  << std::endl;
+    }
+
+    libff::leave_block("Writing checkpoint");
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#ifndef __ZETH_MPC_CLI_CHECKPOINT_HPP__
+#define __ZETH_MPC_CLI_CHECKPOINT_HPP__
+
+#include "libzeth/mpc/groth16/mpc_hash.hpp"
+
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// Number of entries computed between opportunities to write a checkpoint.
+const size_t MPC_CHECKPOINT_CHUNK_SIZE = 1 << 14;
+
+/// Periodic checkpoints for long-running subcommands, allowing them to be
+/// resumed after a crash or preemption. Work is performed in chunks of
+/// consecutive entries, in order, so that progress is described by the
+/// number of completed entries. A checkpoint file holds:
+///
+///   - the digest of the command inputs (so that a computation cannot be
+///     resumed with different inputs)
+///   - the number of completed entries
+///   - command-specific state (partial outputs, etc)
+///   - the digest of all of the above, to detect corrupted checkpoints.
+///
+/// Checkpoints are written to a temporary file which is then renamed, so that
+/// a crash during a write never destroys the previous checkpoint. Since
+/// results are fully determined by the inputs and the checkpointed state,
+/// resumed commands produce output identical to uninterrupted ones.
+class mpc_checkpoint
+{
+private:
+    std::string file_name;
+    bool resume_enabled;
+    size_t interval_seconds;
+    libzeth::mpc_hash_t inputs_digest;
+    std::chrono::steady_clock::time_point last_save;
+
+public:
+    /// Functions to read and write the command-specific state, given the
+    /// number of completed entries.
+    using read_state_fn = std::function<void(std::istream &, size_t)>;
+    using write_state_fn = std::function<void(std::ostream &, size_t)>;
+
+    mpc_checkpoint();
+
+    /// Add the `--resume` and `--checkpoint-interval` options.
+    static void initialize_options(
+        boost::program_options::options_description &options);
+
+    /// Parse options added by `initialize_options`. Checkpoints are written
+    /// to `<out_file>.checkpoint`.
+    void parse_options(
+        const boost::program_options::variables_map &vm,
+        const std::string &out_file);
+
+    /// True if checkpoints will be written.
+    bool enabled() const;
+
+    /// Record the digest of the command inputs and, if `--resume` was given
+    /// and a checkpoint for the same inputs exists, load it. Returns the
+    /// number of completed entries (0 if no checkpoint was loaded).
+    /// `read_state` is only called if a checkpoint is loaded.
+    size_t begin(
+        const libzeth::mpc_hash_t inputs_digest,
+        const read_state_fn &read_state);
+
+    /// Called after each chunk of work. Writes a checkpoint if checkpoints
+    /// are enabled and the checkpoint interval has elapsed since the last
+    /// one.
+    void chunk_completed(
+        size_t num_completed, const write_state_fn &write_state);
+
+    /// Called when the command has written its output. Removes any
+    /// checkpoint file.
+    void complete() const;
+
+private:
+    void save(size_t num_completed, const write_state_fn &write_state);
+};
+
+/// Write the first `num_entries` entries of `values` (of some type with
+/// stream operators, such as group elements) to a checkpoint.
+template<typename T>
+void mpc_checkpoint_write_entries(
+    std::ostream &out, const std::vector<T> &values, size_t num_entries)
+{
+    for (size_t i = 0; i < num_entries; ++i) {
+        out << values[i];
+    }
+}
+
+/// Read the first `num_entries` entries of `values` (which must be
+/// preallocated) from a checkpoint.
+template<typename T>
+void mpc_checkpoint_read_entries(
+    std::istream &in, std::vector<T> &values, size_t num_entries)
+{
+    if (num_entries > values.size()) {
+        throw std::invalid_argument("too many entries in checkpoint");
+    }
+    for (size_t i = 0; i < num_entries; ++i) {
+        in >> values[i];
+    }
+}
+
+#endif // __ZETH_MPC_CLI_CHECKPOINT_HPP__
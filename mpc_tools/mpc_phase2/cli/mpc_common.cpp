@@ -4,6 +4,8 @@
 
 #include "mpc_common.hpp"
 
+#include "libzeth/serialization/r1cs_serialization.hpp"
+
 #include <iostream>
 
 namespace po = boost::program_options;
@@ -17,10 +19,12 @@ subcommand::subcommand(
 {
 }
 
-void subcommand::set_global_options(bool verbose, ProtoboardInitFn pb_init)
+void subcommand::set_global_options(
+    bool verbose, ProtoboardInitFn pb_init, const std::string &r1cs_file)
 {
     this->verbose = verbose;
     this->protoboard_init = pb_init;
+    this->r1cs_file = r1cs_file;
 }
 
 int subcommand::execute(const std::vector<std::string> &args)
@@ -69,10 +73,47 @@ const std::string &subcommand::description() const
     return subcommand_description;
 }
 
-void subcommand::init_protoboard(
-    libsnark::protoboard<libzeth::FieldT> &pb) const
+libsnark::r1cs_constraint_system<libzeth::FieldT> subcommand::
+    get_constraint_system() const
 {
+    if (!r1cs_file.empty()) {
+        libff::enter_block("Load constraint system");
+        libff::print_indent();
+        std::cout << r1cs_file << std::endl;
+        libsnark::r1cs_constraint_system<libzeth::FieldT> cs =
+            libzeth::r1cs_read_compact_file<libzeth::FieldT>(r1cs_file);
+        libff::leave_block("Load constraint system");
+        return cs;
+    }
+
+    libff::enter_block("Generate constraint system");
+    libsnark::protoboard<libzeth::FieldT> pb;
     protoboard_init(pb);
+    libsnark::r1cs_constraint_system<libzeth::FieldT> cs =
+        pb.get_constraint_system();
+    libff::leave_block("Generate constraint system");
+    return cs;
+}
+
+size_t subcommand::get_num_inputs() const
+{
+    if (!r1cs_file.empty()) {
+        // The header is at the start of the file, and is small. Read enough
+        // data to decode it, without reading any constraints.
+        std::ifstream in(r1cs_file, std::ios_base::binary | std::ios_base::in);
+        if (!in.good()) {
+            throw std::invalid_argument("failed to open file: " + r1cs_file);
+        }
+        char header[64];
+        in.read(header, sizeof(header));
+        const libzeth::r1cs_compact_reader<libzeth::FieldT> reader(
+            header, (size_t)in.gcount());
+        return reader.num_inputs();
+    }
+
+    libsnark::protoboard<libzeth::FieldT> pb;
+    protoboard_init(pb);
+    return pb.num_inputs();
 }
 
 void subcommand::usage(const po::options_description &options)
@@ -82,6 +123,24 @@ void subcommand::usage(const po::options_description &options)
     std::cout << options << std::endl;
 }
 
+void hash_file(const std::string &file_name, libzeth::mpc_hash_t out_hash)
+{
+    std::ifstream in(file_name, std::ios_base::binary | std::ios_base::in);
+    in.exceptions(std::ios_base::badbit);
+    if (!in.good()) {
+        throw std::invalid_argument("failed to open file: " + file_name);
+    }
+
+    libzeth::mpc_hash_state_t state;
+    libzeth::mpc_hash_init(state);
+    std::vector<char> buffer(1 << 20);
+    while (in) {
+        in.read(buffer.data(), buffer.size());
+        libzeth::mpc_hash_update(state, buffer.data(), (size_t)in.gcount());
+    }
+    libzeth::mpc_hash_final(state, out_hash);
+}
+
 void list_commands(const std::map<std::string, subcommand *> &commands)
 {
     using entry_t = std::pair<std::string, subcommand *>;
@@ -109,7 +168,10 @@ int mpc_main(
 {
     libzeth::ppT::init_public_params();
     po::options_description global("Global options");
-    global.add_options()("help,h", "This help")("verbose,v", "Verbose output");
+    global.add_options()("help,h", "This help")("verbose,v", "Verbose output")(
+        "r1cs",
+        po::value<std::string>(),
+        "Load the constraint system from a file (see export-r1cs)");
 
     po::options_description all("");
     all.add(global).add_options()(
@@ -168,7 +230,10 @@ int mpc_main(
             throw po::error("invalid command");
         }
 
-        sub->set_global_options(verbose, pb_init);
+        const std::string r1cs_file =
+            vm.count("r1cs") ? vm["r1cs"].as<std::string>() : "";
+
+        sub->set_global_options(verbose, pb_init, r1cs_file);
         return sub->execute(subargs);
     } catch (po::error &error) {
         std::cerr << " ERROR: " << error.what() << std::endl;
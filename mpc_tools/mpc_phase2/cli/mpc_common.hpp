@@ -24,6 +24,7 @@ protected:
     std::string subcommand_description;
     bool verbose;
     ProtoboardInitFn protoboard_init;
+    std::string r1cs_file;
 
 private:
     bool help;
@@ -31,12 +32,23 @@ private:
 public:
     subcommand(
         const std::string &subcommand_name, const std::string &description);
-    void set_global_options(bool verbose, ProtoboardInitFn protoboard_init);
+    void set_global_options(
+        bool verbose,
+        ProtoboardInitFn protoboard_init,
+        const std::string &r1cs_file);
     int execute(const std::vector<std::string> &args);
     const std::string &description() const;
 
 protected:
-    void init_protoboard(libsnark::protoboard<libzeth::FieldT> &pb) const;
+    /// The constraint system, loaded from the file given by the global
+    /// `--r1cs` option (in the compact R1CS format) if present, and
+    /// otherwise constructed using the protoboard init function.
+    libsnark::r1cs_constraint_system<libzeth::FieldT> get_constraint_system()
+        const;
+
+    /// The number of primary inputs of the circuit. If `--r1cs` is given,
+    /// only the file header is read.
+    size_t get_num_inputs() const;
 
 private:
     void usage(const boost::program_options::options_description &all_options);
@@ -83,6 +95,11 @@ inline ReadableT read_from_file_and_hash(
     return v;
 }
 
+// Compute the hash of the full contents of a file, without holding the
+// contents in memory. Equal to the hash computed by read_from_file_and_hash
+// for files holding a single serialized structure.
+void hash_file(const std::string &file_name, libzeth::mpc_hash_t out_hash);
+
 extern subcommand *mpc_linear_combination_cmd;
 extern subcommand *mpc_dummy_phase2_cmd;
 extern subcommand *mpc_phase2_begin_cmd;
@@ -90,6 +107,7 @@ extern subcommand *mpc_phase2_contribute_cmd;
 extern subcommand *mpc_phase2_verify_contribution_cmd;
 extern subcommand *mpc_phase2_verify_transcript_cmd;
 extern subcommand *mpc_create_keypair_cmd;
+extern subcommand *mpc_export_r1cs_cmd;
 
 /// Main entry point into the mpc command for a given circuit.
 int mpc_main(
@@ -147,10 +147,7 @@ private:
 
         // Compute circuit
         libff::enter_block("Generate QAP");
-        libsnark::protoboard<FieldT> pb;
-        init_protoboard(pb);
-        libsnark::r1cs_constraint_system<FieldT> cs =
-            pb.get_constraint_system();
+        libsnark::r1cs_constraint_system<FieldT> cs = get_constraint_system();
         const libsnark::qap_instance<FieldT> qap =
             libsnark::r1cs_to_qap_instance_map(cs, true);
         libff::leave_block("Generate QAP");
@@ -82,13 +82,9 @@ private:
             read_from_file<srs_mpc_layer_L1<ppT>>(linear_combination_file);
         libff::leave_block("reading linear combination data");
 
-        // Generate the zeth circuit (to determine the number of inputs)
+        // Determine the number of inputs of the circuit
         libff::enter_block("computing num_inputs");
-        const size_t num_inputs = [this]() {
-            libsnark::protoboard<FieldT> pb;
-            init_protoboard(pb);
-            return pb.num_inputs();
-        }();
+        const size_t num_inputs = get_num_inputs();
         libff::print_indent();
         std::cout << std::to_string(num_inputs) << std::endl;
         libff::leave_block("computing num_inputs");
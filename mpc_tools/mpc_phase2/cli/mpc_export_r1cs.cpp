@@ -0,0 +1,80 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/serialization/r1cs_serialization.hpp"
+#include "mpc_common.hpp"
+
+using namespace libzeth;
+namespace po = boost::program_options;
+
+namespace
+{
+
+// Usage:
+//     mpc export-r1cs [<option>] <r1cs_file>
+class mpc_export_r1cs : public subcommand
+{
+    std::string out_file;
+
+public:
+    mpc_export_r1cs()
+        : subcommand(
+              "export-r1cs",
+              "Write the constraint system in compact binary format")
+        , out_file()
+    {
+    }
+
+private:
+    void initialize_suboptions(
+        po::options_description &options,
+        po::options_description &all_options,
+        po::positional_options_description &pos) override
+    {
+        all_options.add(options).add_options()(
+            "r1cs_file", po::value<std::string>(), "Output file");
+        pos.add("r1cs_file", 1);
+    }
+
+    void parse_suboptions(const po::variables_map &vm) override
+    {
+        if (0 == vm.count("r1cs_file")) {
+            throw po::error("r1cs_file not specified");
+        }
+        out_file = vm["r1cs_file"].as<std::string>();
+    }
+
+    void subcommand_usage() override
+    {
+        std::cout << "Usage:" << std::endl
+                  << "  " << subcommand_name << " [<options>] <r1cs_file>\n";
+    }
+
+    int execute_subcommand() override
+    {
+        if (verbose) {
+            std::cout << "out_file: " << out_file << std::endl;
+        }
+
+        const libsnark::r1cs_constraint_system<FieldT> cs =
+            get_constraint_system();
+
+        libff::enter_block("Writing constraint system");
+        libff::print_indent();
+        std::cout << out_file << std::endl;
+        {
+            std::ofstream out(
+                out_file, std::ios_base::binary | std::ios_base::out);
+            out.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+            r1cs_write_compact(cs, out);
+        }
+        libff::leave_block("Writing constraint system");
+
+        return 0;
+    }
+};
+
+} // namespace
+
+subcommand *mpc_export_r1cs_cmd = new mpc_export_r1cs();
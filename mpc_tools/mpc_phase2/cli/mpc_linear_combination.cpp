@@ -6,9 +6,11 @@
 #include "libzeth/core/utils.hpp"
 #include "libzeth/mpc/groth16/mpc_utils.hpp"
 #include "libzeth/mpc/groth16/powersoftau_utils.hpp"
+#include "mpc_checkpoint.hpp"
 #include "mpc_common.hpp"
 
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <functional>
 #include <vector>
 
@@ -26,6 +28,9 @@ namespace
 //     -h,--help        This message
 //     --pot-degree     powersoftau degree (assumed equal to lagrange file)
 //     --verify         Skip computation.  Load and verify input data.
+//     --checkpoint-interval <seconds>
+//                      Periodically write a checkpoint
+//     --resume         Resume from a checkpoint
 class mpc_linear_combination : public subcommand
 {
     std::string powersoftau_file;
@@ -33,6 +38,7 @@ class mpc_linear_combination : public subcommand
     size_t powersoftau_degree;
     std::string out_file;
     bool verify;
+    mpc_checkpoint checkpoint;
 
 public:
     mpc_linear_combination()
@@ -43,6 +49,7 @@ public:
         , powersoftau_degree(0)
         , out_file()
         , verify(false)
+        , checkpoint()
     {
     }
 
@@ -57,6 +64,7 @@ private:
             po::value<size_t>(),
             "powersoftau degree (assumed equal to lagrange file)")(
             "verify", "Skip compuation. Load and verify input data");
+        mpc_checkpoint::initialize_options(options);
         all_options.add(options).add_options()(
             "powersoftau_file", po::value<std::string>(), "powersoftau file")(
             "lagrange_file", po::value<std::string>(), "lagrange file")(
@@ -86,6 +94,7 @@ private:
         powersoftau_degree =
             vm.count("pot-degree") ? vm["pot-degree"].as<size_t>() : 0;
         verify = (bool)vm.count("verify");
+        checkpoint.parse_options(vm, out_file);
     }
 
     void subcommand_usage() override
@@ -109,31 +118,36 @@ private:
         // Load lagrange evaluations to determine n, then load powersoftau
         // TODO: Load just degree from lagrange data, then load the two
         // files in parallel.
+        // The inputs are hashed as they are loaded, to identify checkpoints.
         libff::enter_block("Load Lagrange data");
         libff::print_indent();
         std::cout << lagrange_file << std::endl;
+        mpc_hash_t lagrange_digest;
         const srs_lagrange_evaluations<ppT> lagrange =
-            read_from_file<srs_lagrange_evaluations<ppT>>(lagrange_file);
+            read_from_file_and_hash<srs_lagrange_evaluations<ppT>>(
+                lagrange_file, lagrange_digest);
         libff::leave_block("Load Lagrange data");
 
         libff::enter_block("Load powers of tau");
         libff::print_indent();
         std::cout << powersoftau_file << std::endl;
-        const srs_powersoftau<ppT> pot = [this, &lagrange]() {
-            std::ifstream in(
+        mpc_hash_t pot_digest;
+        const srs_powersoftau<ppT> pot = [this, &lagrange, &pot_digest]() {
+            std::ifstream inf(
                 powersoftau_file, std::ios_base::binary | std::ios_base::in);
+            mpc_hash_istream_wrapper in(inf);
             const size_t pot_degree =
                 powersoftau_degree ? powersoftau_degree : lagrange.degree;
-            return powersoftau_load(in, pot_degree);
+            srs_powersoftau<ppT> pot = powersoftau_load(in, pot_degree);
+            in.get_hash(pot_digest);
+            return pot;
         }();
         libff::leave_block("Load powers of tau");
 
         // Compute circuit
         libff::enter_block("Generate QAP");
-        libsnark::protoboard<FieldT> pb;
-        init_protoboard(pb);
         const libsnark::r1cs_constraint_system<FieldT> cs =
-            pb.get_constraint_system();
+            get_constraint_system();
         const libsnark::qap_instance<FieldT> qap =
             libsnark::r1cs_to_qap_instance_map(cs, true);
         libff::leave_block("Generate QAP");
@@ -154,9 +168,62 @@ private:
                 "degree.");
         }
 
-        // Compute layer1 and write to a file
-        const srs_mpc_layer_L1<ppT> lin_comb =
-            mpc_compute_linearcombination<ppT>(pot, lagrange, qap);
+        // Compute layer1 in chunks, checkpointing the partial vectors. The
+        // inputs digest covers the input files and the shape of the
+        // circuit.
+        mpc_hash_t inputs_digest;
+        {
+            const size_t num_variables = qap.num_variables();
+            const size_t num_inputs = qap.num_inputs();
+            const size_t degree = qap.degree();
+            mpc_hash_ostream hs;
+            hs.write((const char *)lagrange_digest, sizeof(mpc_hash_t));
+            hs.write((const char *)pot_digest, sizeof(mpc_hash_t));
+            hs.write((const char *)&num_variables, sizeof(num_variables));
+            hs.write((const char *)&num_inputs, sizeof(num_inputs));
+            hs.write((const char *)&degree, sizeof(degree));
+            hs.get_hash(inputs_digest);
+        }
+
+        const size_t num_entries = qap.num_variables() + 1;
+        libff::G1_vector<ppT> As_g1(num_entries);
+        libff::G1_vector<ppT> Bs_g1(num_entries);
+        libff::G2_vector<ppT> Bs_g2(num_entries);
+        libff::G1_vector<ppT> ABCs_g1(num_entries);
+        const mpc_checkpoint::read_state_fn read_state =
+            [&](std::istream &in, size_t num_completed) {
+                mpc_checkpoint_read_entries(in, As_g1, num_completed);
+                mpc_checkpoint_read_entries(in, Bs_g1, num_completed);
+                mpc_checkpoint_read_entries(in, Bs_g2, num_completed);
+                mpc_checkpoint_read_entries(in, ABCs_g1, num_completed);
+            };
+        const mpc_checkpoint::write_state_fn write_state =
+            [&](std::ostream &out, size_t num_completed) {
+                mpc_checkpoint_write_entries(out, As_g1, num_completed);
+                mpc_checkpoint_write_entries(out, Bs_g1, num_completed);
+                mpc_checkpoint_write_entries(out, Bs_g2, num_completed);
+                mpc_checkpoint_write_entries(out, ABCs_g1, num_completed);
+            };
+        const size_t num_completed =
+            checkpoint.begin(inputs_digest, read_state);
+
+        libff::enter_block("computing A_i, B_i, C_i, ABC_i at x");
+        for (size_t begin = num_completed; begin < num_entries;) {
+            const size_t end =
+                std::min(begin + MPC_CHECKPOINT_CHUNK_SIZE, num_entries);
+            mpc_compute_linearcombination_range<ppT>(
+                lagrange, qap, begin, end, As_g1, Bs_g1, Bs_g2, ABCs_g1);
+            checkpoint.chunk_completed(end, write_state);
+            begin = end;
+        }
+        libff::leave_block("computing A_i, B_i, C_i, ABC_i at x");
+
+        const srs_mpc_layer_L1<ppT> lin_comb(
+            mpc_compute_T_tau_powers_g1<ppT>(pot, qap.degree()),
+            std::move(As_g1),
+            std::move(Bs_g1),
+            std::move(Bs_g2),
+            std::move(ABCs_g1));
 
         libff::enter_block("Writing linear combination file");
         libff::print_indent();
@@ -168,6 +235,7 @@ private:
         }
         libff::leave_block("Writing linear combination file");
 
+        checkpoint.complete();
         return 0;
     }
 };
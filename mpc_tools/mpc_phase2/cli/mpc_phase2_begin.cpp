@@ -74,37 +74,37 @@ private:
             std::cout << "out: " << out_file << std::endl;
         }
 
-        libff::enter_block("Load linear combination file");
+        // The linear combination file is processed in two passes, neither of
+        // which holds its contents in memory: the cs_hash is computed over
+        // the raw file, and then only the sections required for the initial
+        // challenge are read and streamed to the output.
+        libff::enter_block("Hashing linear combination file");
         mpc_hash_t cs_hash;
-        srs_mpc_layer_L1<ppT> lin_comb =
-            read_from_file_and_hash<srs_mpc_layer_L1<ppT>>(
-                lin_comb_file, cs_hash);
-        libff::leave_block("Load linear combination file");
+        hash_file(lin_comb_file, cs_hash);
+        libff::leave_block("Hashing linear combination file");
 
         // Compute circuit
         libff::enter_block("Computing num inputs");
-        const size_t num_inputs = [this]() {
-            libsnark::protoboard<FieldT> pb;
-            init_protoboard(pb);
-            return pb.num_inputs();
-        }();
+        const size_t num_inputs = get_num_inputs();
         libff::print_indent();
         std::cout << std::to_string(num_inputs) << std::endl;
         libff::leave_block("Computing num inputs");
 
         // Initial challenge
-        libff::enter_block("Computing initial challenge");
-        const srs_mpc_phase2_challenge<ppT> initial_challenge =
-            srs_mpc_phase2_initial_challenge<ppT>(
-                srs_mpc_phase2_begin<ppT>(cs_hash, lin_comb, num_inputs));
-        libff::leave_block("Computing initial challenge");
-
         libff::enter_block("Writing initial challenge");
         libff::print_indent();
         std::cout << out_file << std::endl;
         {
-            std::ofstream out(out_file);
-            initial_challenge.write(out);
+            std::ifstream in(
+                lin_comb_file, std::ios_base::binary | std::ios_base::in);
+            in.exceptions(
+                std::ios_base::eofbit | std::ios_base::badbit |
+                std::ios_base::failbit);
+            std::ofstream out(
+                out_file, std::ios_base::binary | std::ios_base::out);
+            out.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+            srs_mpc_phase2_begin_write_challenge<ppT>(
+                cs_hash, in, num_inputs, out);
         }
         libff::leave_block("Writing initial challenge");
 
@@ -3,8 +3,12 @@
 // SPDX-License-Identifier: LGPL-3.0+
 
 #include "libzeth/mpc/groth16/phase2.hpp"
+#include "mpc_checkpoint.hpp"
 #include "mpc_common.hpp"
 
+#include <algorithm>
+#include <memory>
+
 using namespace libzeth;
 namespace po = boost::program_options;
 
@@ -17,6 +21,9 @@ namespace
 // Options:
 //   --digest <file>     Write contribution hash to file
 //   --skip-user-input   Use only system randomness
+//   --checkpoint-interval <seconds>
+//                       Periodically write a checkpoint (contains the secret)
+//   --resume            Resume from a checkpoint
 class mpc_phase2_contribute : public subcommand
 {
 private:
@@ -24,6 +31,7 @@ private:
     std::string out_file;
     std::string digest;
     bool skip_user_input;
+    mpc_checkpoint checkpoint;
 
 public:
     mpc_phase2_contribute()
@@ -34,6 +42,7 @@ public:
         , out_file()
         , digest()
         , skip_user_input(false)
+        , checkpoint()
     {
     }
 
@@ -48,6 +57,7 @@ private:
             po::value<std::string>(),
             "Write contribution digest to file")(
             "skip-user-input", "Use only system randomness");
+        mpc_checkpoint::initialize_options(options);
         all_options.add(options).add_options()(
             "challenge_file", po::value<std::string>(), "challenge file")(
             "response_file", po::value<std::string>(), "response output file");
@@ -66,6 +76,7 @@ private:
         out_file = vm["response_file"].as<std::string>();
         digest = vm.count("digest") ? vm["digest"].as<std::string>() : "";
         skip_user_input = (bool)vm.count("skip-user-input");
+        checkpoint.parse_options(vm, out_file);
     }
 
     void subcommand_usage() override
@@ -84,17 +95,77 @@ private:
         }
 
         libff::enter_block("Load challenge file");
+        mpc_hash_t challenge_digest;
         srs_mpc_phase2_challenge<ppT> challenge =
-            read_from_file<srs_mpc_phase2_challenge<ppT>>(challenge_file);
+            read_from_file_and_hash<srs_mpc_phase2_challenge<ppT>>(
+                challenge_file, challenge_digest);
         libff::leave_block("Load challenge file");
 
-        libff::enter_block("Computing randomness");
-        libff::Fr<ppT> contribution = get_randomness();
-        libff::leave_block("Computing randomness");
+        if (checkpoint.enabled()) {
+            std::cout << "WARNING: checkpoints contain the secret "
+                         "contribution. They are deleted on completion, but "
+                         "must not be shared."
+                      << std::endl;
+        }
+
+        // The response is computed in chunks (see
+        // srs_mpc_phase2_compute_response_chunked). The secret and public key
+        // are part of the checkpoint state, so that a resumed contribution
+        // produces exactly the same response.
+        const srs_mpc_phase2_accumulator<ppT> &last = challenge.accumulator;
+        const size_t H_size = last.H_g1.size();
+        libff::G1_vector<ppT> H_g1(H_size);
+        libff::G1_vector<ppT> L_g1(last.L_g1.size());
+        libff::Fr<ppT> contribution;
+        std::unique_ptr<srs_mpc_phase2_publickey<ppT>> publickey;
+
+        const mpc_checkpoint::read_state_fn read_state =
+            [&](std::istream &in, size_t num_completed) {
+                in >> contribution;
+                publickey.reset(new srs_mpc_phase2_publickey<ppT>(
+                    srs_mpc_phase2_publickey<ppT>::read(in)));
+                mpc_checkpoint_read_entries(
+                    in, H_g1, std::min(num_completed, H_size));
+                mpc_checkpoint_read_entries(
+                    in, L_g1, std::max(num_completed, H_size) - H_size);
+            };
+        const mpc_checkpoint::write_state_fn write_state =
+            [&](std::ostream &out, size_t num_completed) {
+                out << contribution;
+                publickey->write(out);
+                mpc_checkpoint_write_entries(
+                    out, H_g1, std::min(num_completed, H_size));
+                mpc_checkpoint_write_entries(
+                    out, L_g1, std::max(num_completed, H_size) - H_size);
+            };
+        const size_t num_completed =
+            checkpoint.begin(challenge_digest, read_state);
+
+        if (!publickey) {
+            libff::enter_block("Computing randomness");
+            contribution = get_randomness();
+            libff::leave_block("Computing randomness");
+
+            libff::enter_block("computing contribution public key");
+            publickey.reset(new srs_mpc_phase2_publickey<ppT>(
+                srs_mpc_phase2_compute_public_key<ppT>(
+                    challenge.transcript_digest, last.delta_g1, contribution)));
+            libff::leave_block("computing contribution public key");
+        }
 
         libff::enter_block("Computing response");
         const srs_mpc_phase2_response<ppT> response =
-            srs_mpc_phase2_compute_response<ppT>(challenge, contribution);
+            srs_mpc_phase2_compute_response_chunked<ppT>(
+                challenge,
+                contribution,
+                std::move(*publickey),
+                H_g1,
+                L_g1,
+                num_completed,
+                MPC_CHECKPOINT_CHUNK_SIZE,
+                [&](size_t completed) {
+                    checkpoint.chunk_completed(completed, write_state);
+                });
         libff::leave_block("Computing response");
 
         libff::enter_block("Writing response");
@@ -105,6 +176,7 @@ private:
             response.write(out);
         }
         libff::leave_block("Writing response");
+        checkpoint.complete();
 
         mpc_hash_t contrib_digest;
         response.publickey.compute_digest(contrib_digest);
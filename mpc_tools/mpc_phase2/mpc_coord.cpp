@@ -39,6 +39,7 @@ int main(int argc, char **argv)
         {"phase2-verify-contribution", mpc_phase2_verify_contribution_cmd},
         {"phase2-verify-transcript", mpc_phase2_verify_transcript_cmd},
         {"create-keypair", mpc_create_keypair_cmd},
+        {"export-r1cs", mpc_export_r1cs_cmd},
     };
     return mpc_main(argc, argv, commands, zeth_protoboard);
 }
@@ -4,7 +4,10 @@
 
 #include "libzeth/circuits/circuit_types.hpp"
 #include "libzeth/core/extended_proof.hpp"
+#include "libzeth/core/logging.hpp"
 #include "libzeth/core/utils.hpp"
+#include "libzeth/mpc/groth16/mpc_hash.hpp"
+#include "libzeth/serialization/debug_artifact_sink.hpp"
 #include "libzeth/serialization/proto_utils.hpp"
 #include "libzeth/serialization/r1cs_serialization.hpp"
 #include "libzeth/snarks/default/default_api_handler.hpp"
@@ -12,6 +15,7 @@
 #include "zeth_config.h"
 
 #include <api/prover.grpc.pb.h>
+#include <atomic>
 #include <boost/program_options.hpp>
 #include <fstream>
 #include <grpc/grpc.h>
@@ -20,9 +24,14 @@
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
 #include <libsnark/common/data_structures/merkle_tree.hpp>
+#include <map>
 #include <memory>
+#include <signal.h>
 #include <stdio.h>
+#include <stdexcept>
 #include <string>
+#include <unistd.h>
+#include <utility>
 
 using snark = libzeth::default_snark<libzeth::ppT>;
 using api_handler = libzeth::default_api_handler<libzeth::ppT>;
@@ -41,7 +50,6 @@ static void serialize_setup_to_file(
     const boost::filesystem::path path_vk_json = setup_path / "vk.json";
     const boost::filesystem::path path_vk_raw = setup_path / "vk.raw";
     const boost::filesystem::path path_pk_raw = setup_path / "pk.raw";
-    const boost::filesystem::path path_keypair = "/home/zeth/build/keypair";
 
     const typename snark::ProvingKeyT &proving_key = keypair.pk;
     const typename snark::VerificationKeyT &verification_key = keypair.vk;
@@ -61,26 +69,32 @@ static void serialize_setup_to_file(
         std::ofstream pk_bytes_s(path_pk_raw.c_str());
         snark::proving_key_write_bytes(proving_key, pk_bytes_s);
     }
-    {
-        std::ofstream keypair_bytes(path_keypair.c_str());
-        snark::keypair_write_bytes(keypair_bytes, keypair);
-    }
 }
 
-static void write_ext_proof_to_file(
-    const libzeth::extended_proof<libzeth::ppT, snark> &ext_proof,
-    boost::filesystem::path proof_path = "")
+static libzeth::r1cs_check_mode check_mode_from_proto(
+    const zeth_proto::SatisfiabilityCheck check)
 {
-    if (proof_path.empty()) {
-        // Used for debugging
-        const boost::filesystem::path tmp_path =
-            libzeth::get_path_to_debug_directory();
-        proof_path = tmp_path / "proof_and_inputs.json";
+    switch (check) {
+    case zeth_proto::SATISFIABILITY_CHECK_OFF:
+        return libzeth::r1cs_check_mode::off;
+    case zeth_proto::SATISFIABILITY_CHECK_FULL:
+        return libzeth::r1cs_check_mode::full;
+    case zeth_proto::SATISFIABILITY_CHECK_SAMPLED:
+        return libzeth::r1cs_check_mode::sampled;
+    default:
+        throw std::invalid_argument("invalid satisfiability check");
     }
+}
 
-    std::cout << "[DEBUG] Writing extended proof to" << proof_path << std::endl;
-    std::ofstream os(proof_path.c_str());
-    ext_proof.write_json(os);
+// Sink receiving SIGUSR1, which toggles the recording of debug artifacts
+static std::atomic<libzeth::debug_artifact_sink *> signal_debug_sink(nullptr);
+
+static void toggle_debug_artifacts(int)
+{
+    libzeth::debug_artifact_sink *const sink = signal_debug_sink.load();
+    if (sink != nullptr) {
+        sink->set_enabled(!sink->is_enabled());
+    }
 }
 
 /// The prover_server class inherits from the Prover service
@@ -104,6 +118,12 @@ private:
     // The keypair is the result of the setup
     snark::KeypairT keypair;
 
+    // Prepared form of keypair.vk, computed once and reused
+    snark::PreparedVerificationKeyT prepared_verification_key;
+
+    // Receives the inputs and proofs of a sample of the requests
+    libzeth::debug_artifact_sink &debug_sink;
+
 public:
     explicit prover_server(
         libzeth::circuit_wrapper<
@@ -114,8 +134,13 @@ public:
             libzeth::ZETH_NUM_JS_INPUTS,
             libzeth::ZETH_NUM_JS_OUTPUTS,
             libzeth::ZETH_MERKLE_TREE_DEPTH> &prover,
-        snark::KeypairT &keypair)
-        : prover(prover), keypair(keypair)
+        snark::KeypairT &keypair,
+        libzeth::debug_artifact_sink &debug_sink)
+        : prover(prover)
+        , keypair(keypair)
+        , prepared_verification_key(
+              snark::prepare_verification_key(keypair.vk))
+        , debug_sink(debug_sink)
     {
     }
 
@@ -124,18 +149,16 @@ public:
         const proto::Empty *,
         zeth_proto::VerificationKey *response) override
     {
-        std::cout << "[ACK] Received the request to get the verification key"
-                  << std::endl;
-        std::cout << "[DEBUG] Preparing verification key for response..."
-                  << std::endl;
+        ZETH_LOG(info) << "Received the request to get the verification key";
+        ZETH_LOG(debug) << "Preparing verification key for response...";
         try {
             api_handler::verification_key_to_proto(this->keypair.vk, response);
         } catch (const std::exception &e) {
-            std::cout << "[ERROR] " << e.what() << std::endl;
+            ZETH_LOG(error) << e.what();
             return grpc::Status(
                 grpc::StatusCode::INVALID_ARGUMENT, grpc::string(e.what()));
         } catch (...) {
-            std::cout << "[ERROR] In catch all" << std::endl;
+            ZETH_LOG(error) << "In catch all";
             return grpc::Status(grpc::StatusCode::UNKNOWN, "");
         }
 
@@ -147,10 +170,20 @@ public:
         const zeth_proto::ProofInputs *proof_inputs,
         zeth_proto::ExtendedProof *proof) override
     {
-        std::cout << "[ACK] Received the request to generate a proof"
-                  << std::endl;
-        std::cout << "[DEBUG] Parse received message to compute proof..."
-                  << std::endl;
+        ZETH_LOG(info) << "Received the request to generate a proof";
+
+        // The inputs of recorded requests are written first, so that they
+        // are available even if no proof can be generated.
+        const std::string debug_request = debug_sink.begin_request("prove");
+        if (!debug_request.empty()) {
+            const zeth_proto::ProofInputs inputs(*proof_inputs);
+            debug_sink.write(
+                debug_request, "inputs.txt", [inputs](std::ostream &out) {
+                    out << inputs.DebugString();
+                });
+        }
+
+        ZETH_LOG(debug) << "Parse received message to compute proof...";
 
         // Parse received message to feed to the prover
         try {
@@ -181,8 +214,7 @@ public:
                 throw std::invalid_argument("Invalid number of JS outputs");
             }
 
-            std::cout << "[DEBUG] Process all inputs of the JoinSplit"
-                      << std::endl;
+            ZETH_LOG(debug) << "Process all inputs of the JoinSplit";
             std::array<
                 libzeth::joinsplit_input<
                     libzeth::FieldT,
@@ -190,11 +222,10 @@ public:
                 libzeth::ZETH_NUM_JS_INPUTS>
                 joinsplit_inputs;
             for (size_t i = 0; i < libzeth::ZETH_NUM_JS_INPUTS; i++) {
-                printf(
-                    "\r  input (%zu / %zu)\n", i, libzeth::ZETH_NUM_JS_INPUTS);
+                ZETH_LOG(trace) << "input (" << i << " / "
+                                << libzeth::ZETH_NUM_JS_INPUTS << ")";
                 zeth_proto::JoinsplitInput received_input =
                     proof_inputs->js_inputs(i);
-                std::cout << "here" << std::endl;
                 libzeth::joinsplit_input<
                     libzeth::FieldT,
                     libzeth::ZETH_MERKLE_TREE_DEPTH>
@@ -204,15 +235,12 @@ public:
                 joinsplit_inputs[i] = parsed_input;
             }
 
-            std::cout << "[DEBUG] Process all outputs of the JoinSplit"
-                      << std::endl;
+            ZETH_LOG(debug) << "Process all outputs of the JoinSplit";
             std::array<libzeth::zeth_note, libzeth::ZETH_NUM_JS_OUTPUTS>
                 joinsplit_outputs;
             for (size_t i = 0; i < libzeth::ZETH_NUM_JS_OUTPUTS; i++) {
-                printf(
-                    "\r  output (%zu / %zu)\n",
-                    i,
-                    libzeth::ZETH_NUM_JS_OUTPUTS);
+                ZETH_LOG(trace) << "output (" << i << " / "
+                                << libzeth::ZETH_NUM_JS_OUTPUTS << ")";
                 zeth_proto::ZethNote received_output =
                     proof_inputs->js_outputs(i);
                 libzeth::zeth_note parsed_output =
@@ -220,8 +248,8 @@ public:
                 joinsplit_outputs[i] = parsed_output;
             }
 
-            std::cout << "[DEBUG] Data parsed successfully" << std::endl;
-            std::cout << "[DEBUG] Generating the proof..." << std::endl;
+            ZETH_LOG(debug) << "Data parsed successfully";
+            ZETH_LOG(debug) << "Generating the proof...";
             libzeth::extended_proof<libzeth::ppT, snark> ext_proof =
                 this->prover.prove(
                     roots,
@@ -231,23 +259,72 @@ public:
                     vpub_out,
                     h_sig_in,
                     phi_in,
-                    this->keypair.pk);
+                    this->keypair.pk,
+                    check_mode_from_proto(
+                        proof_inputs->satisfiability_check()));
+
+            // The proof is only formatted if debug records are enabled.
+            if (libzeth::log_enabled(libzeth::log_level::debug)) {
+                libzeth::log_record record(libzeth::log_level::debug);
+                record.stream() << "Extended proof:\n";
+                ext_proof.write_json(record.stream());
+            }
+            if (!debug_request.empty()) {
+                debug_sink.write(
+                    debug_request,
+                    "proof.json",
+                    [ext_proof](std::ostream &out) {
+                        ext_proof.write_json(out);
+                    });
+            }
 
-            std::cout << "[DEBUG] Displaying the extended proof" << std::endl;
-            ext_proof.write_json(std::cout);
+            ZETH_LOG(debug) << "Preparing response...";
+            api_handler::extended_proof_to_proto(ext_proof, proof);
 
-            // Write a copy of the proof for debugging.
-            write_ext_proof_to_file(ext_proof);
+        } catch (const std::exception &e) {
+            ZETH_LOG(error) << e.what();
+            return grpc::Status(
+                grpc::StatusCode::INVALID_ARGUMENT, grpc::string(e.what()));
+        } catch (...) {
+            ZETH_LOG(error) << "In catch all";
+            return grpc::Status(grpc::StatusCode::UNKNOWN, "");
+        }
 
-            std::cout << "[DEBUG] Preparing response..." << std::endl;
-            api_handler::extended_proof_to_proto(ext_proof, proof);
+        return grpc::Status::OK;
+    }
+
+    grpc::Status VerifyBatch(
+        grpc::ServerContext *,
+        const zeth_proto::VerifyBatchRequest *request,
+        zeth_proto::VerifyBatchResponse *response) override
+    {
+        ZETH_LOG(info) << "Received the request to verify a batch of "
+                       << request->extended_proofs_size() << " proofs";
+
+        try {
+            std::vector<libzeth::extended_proof<libzeth::ppT, snark>>
+                ext_proofs;
+            ext_proofs.reserve(request->extended_proofs_size());
+            for (const zeth_proto::ExtendedProof &ext_proof :
+                 request->extended_proofs()) {
+                ext_proofs.push_back(
+                    api_handler::extended_proof_from_proto(ext_proof));
+            }
+
+            std::vector<size_t> invalid_indices;
+            const bool all_valid = snark::verify_batch(
+                ext_proofs, this->prepared_verification_key, invalid_indices);
 
+            response->set_all_valid(all_valid);
+            for (const size_t index : invalid_indices) {
+                response->add_invalid_indices(index);
+            }
         } catch (const std::exception &e) {
-            std::cout << "[ERROR] " << e.what() << std::endl;
+            ZETH_LOG(error) << e.what();
             return grpc::Status(
                 grpc::StatusCode::INVALID_ARGUMENT, grpc::string(e.what()));
         } catch (...) {
-            std::cout << "[ERROR] In catch all" << std::endl;
+            ZETH_LOG(error) << "In catch all";
             return grpc::Status(grpc::StatusCode::UNKNOWN, "");
         }
 
@@ -299,12 +376,13 @@ static void RunServer(
         libzeth::ZETH_NUM_JS_INPUTS,
         libzeth::ZETH_NUM_JS_OUTPUTS,
         libzeth::ZETH_MERKLE_TREE_DEPTH> &prover,
-    typename snark::KeypairT &keypair)
+    typename snark::KeypairT &keypair,
+    libzeth::debug_artifact_sink &debug_sink)
 {
     // Listen for incoming connections on 0.0.0.0:50051
     std::string server_address("0.0.0.0:50051");
 
-    prover_server service(prover, keypair);
+    prover_server service(prover, keypair, debug_sink);
 
     grpc::ServerBuilder builder;
 
@@ -317,7 +395,7 @@ static void RunServer(
 
     // Finally assemble the server.
     std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
-    std::cout << "[DEBUG] Server listening on " << server_address << std::endl;
+    ZETH_LOG(info) << "Server listening on " << server_address;
 
     // Wait for the server to shutdown. Note that some other thread must be
     // responsible for shutting down the server for this call to ever return.
@@ -333,6 +411,116 @@ static snark::KeypairT load_keypair(const std::string &keypair_file)
         std::ios_base::eofbit | std::ios_base::badbit | std::ios_base::failbit);
     return snark::keypair_read_bytes(in);
 }
+
+/// Canonical digest of the constraint system, used as the key for cached
+/// keypairs.
+static std::string constraint_system_digest(
+    const libsnark::r1cs_constraint_system<libff::Fr<libzeth::ppT>> &r1cs)
+{
+    libzeth::mpc_hash_ostream hs;
+    libzeth::r1cs_write_compact(r1cs, hs);
+    libzeth::mpc_hash_t hash;
+    hs.get_hash(hash);
+    return libzeth::bytes_to_hex(hash, sizeof(hash));
+}
+
+/// Write the keypair to the cache. Data is written to a temporary file which
+/// is renamed into place, so that concurrent or interrupted writes never
+/// leave a partial keypair in the cache. Failures are reported but not fatal.
+static void write_cached_keypair(
+    const snark::KeypairT &keypair, const boost::filesystem::path &cache_file)
+{
+    const boost::filesystem::path tmp_file =
+        cache_file.string() + "." + std::to_string(getpid()) + ".tmp";
+    try {
+        boost::filesystem::create_directories(cache_file.parent_path());
+        {
+            std::ofstream out(
+                tmp_file.c_str(), std::ios_base::out | std::ios_base::binary);
+            out.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+            snark::keypair_write_bytes(out, keypair);
+        }
+        boost::filesystem::rename(tmp_file, cache_file);
+        ZETH_LOG(info) << "Cached keypair: " << cache_file;
+    } catch (const std::exception &e) {
+        ZETH_LOG(warning) << "Failed to cache keypair " << cache_file << ": "
+                          << e.what();
+        boost::system::error_code ec;
+        boost::filesystem::remove(tmp_file, ec);
+    }
+}
+
+/// Look up the keypair for the given circuit in the cache directory,
+/// generating (and caching) it on a miss, or if the cached keypair cannot be
+/// read.
+template<typename proverT>
+static snark::KeypairT get_cached_keypair(
+    const proverT &prover, const boost::filesystem::path &cache_dir)
+{
+    const std::string digest =
+        constraint_system_digest(prover.get_proving_constraint_system());
+    const boost::filesystem::path cache_file =
+        cache_dir / ("keypair-" + digest + ".bin");
+
+    if (boost::filesystem::exists(cache_file)) {
+        ZETH_LOG(info) << "Loading cached keypair: " << cache_file;
+        std::unique_ptr<snark::KeypairT> keypair;
+        try {
+            keypair.reset(
+                new snark::KeypairT(load_keypair(cache_file.string())));
+        } catch (const std::exception &e) {
+            // Unreadable or stale (e.g. written in an older format). Discard
+            // it, and regenerate the keypair below.
+            ZETH_LOG(warning) << "Failed to load cached keypair " << cache_file
+                              << ": " << e.what();
+            boost::system::error_code ec;
+            boost::filesystem::remove(cache_file, ec);
+        }
+
+        if (keypair) {
+            // Keep the setup directory consistent with the keypair in use
+            serialize_setup_to_file(*keypair);
+            return std::move(*keypair);
+        }
+    }
+
+    ZETH_LOG(info) << "No cached keypair for this circuit, generating";
+    snark::KeypairT keypair = prover.generate_trusted_setup();
+    serialize_setup_to_file(keypair);
+    write_cached_keypair(keypair, cache_file);
+    return keypair;
+}
+#endif
+
+#ifdef DEBUG
+/// Number of characters held in a map of annotations.
+static size_t annotations_size(const std::map<size_t, std::string> &annotations)
+{
+    size_t size = 0;
+    for (const std::pair<const size_t, std::string> &entry : annotations) {
+        size += entry.second.size();
+    }
+    return size;
+}
+
+/// Report the size of the circuit and of its annotations, for comparison
+/// between builds with and without annotations (see the ANNOTATIONS CMake
+/// option).
+static void log_circuit_stats(
+    const libsnark::protoboard<libff::Fr<libzeth::ppT>> &pb)
+{
+    const libsnark::r1cs_constraint_system<libff::Fr<libzeth::ppT>> cs =
+        pb.get_constraint_system();
+    ZETH_LOG(debug) << "Circuit: " << cs.num_constraints()
+                    << " constraints, " << cs.num_variables() << " variables";
+    ZETH_LOG(debug) << "Variable annotations: "
+                    << cs.variable_annotations.size() << " ("
+                    << annotations_size(cs.variable_annotations) << " chars)";
+    ZETH_LOG(debug) << "Constraint annotations: "
+                    << cs.constraint_annotations.size() << " ("
+                    << annotations_size(cs.constraint_annotations)
+                    << " chars)";
+}
 #endif
 
 int main(int argc, char **argv)
@@ -340,7 +528,35 @@ int main(int argc, char **argv)
     // Options
     po::options_description options("");
     options.add_options()(
-        "keypair,k", po::value<std::string>(), "file to load keypair from");
+        "keypair,k", po::value<std::string>(), "file to load keypair from")(
+        "keypair-cache-dir",
+        po::value<boost::filesystem::path>(),
+        "directory of cached keypairs, keyed by circuit "
+        "(default: $ZETH_TRUSTED_SETUP_DIR/keypair_cache)")(
+        "no-keypair-cache", "always generate a new keypair")(
+        "compact-r1cs",
+        "remove linear-only constraints from the circuit (changes the "
+        "keypair)")(
+        "log-level",
+        po::value<std::string>(),
+        "minimum level of log records: trace, debug, info, warning, error or "
+        "off (default: info)")(
+        "debug-artifacts",
+        "record the inputs and proofs of a sample of the requests (toggled "
+        "at runtime by SIGUSR1)")(
+        "debug-artifacts-dir",
+        po::value<boost::filesystem::path>(),
+        "directory of debug artifacts (default: $ZETH_DEBUG_DIR)")(
+        "debug-sample-rate",
+        po::value<double>(),
+        "fraction of the requests to record (default: 1)")(
+        "debug-max-bytes",
+        po::value<size_t>(),
+        "maximum size of the debug artifacts directory, after which the "
+        "oldest artifacts are deleted (default: 256MiB)")(
+        "debug-r1cs",
+        "record the constraint system at startup (requires "
+        "--debug-artifacts)");
 #ifdef DEBUG
     options.add_options()(
         "jr1cs,j",
@@ -358,6 +574,16 @@ int main(int argc, char **argv)
     };
 
     std::string keypair_file;
+    boost::filesystem::path keypair_cache_dir =
+        libzeth::get_path_to_setup_directory() / "keypair_cache";
+    bool use_keypair_cache = true;
+    bool compact_r1cs = false;
+    bool debug_artifacts = false;
+    boost::filesystem::path debug_artifacts_dir =
+        libzeth::get_path_to_debug_directory();
+    double debug_sample_rate = 1.0;
+    size_t debug_max_bytes = libzeth::debug_artifact_sink::default_max_bytes;
+    bool debug_r1cs = false;
 #ifdef DEBUG
     boost::filesystem::path jr1cs_file;
 #endif
@@ -372,6 +598,43 @@ int main(int argc, char **argv)
         if (vm.count("keypair")) {
             keypair_file = vm["keypair"].as<std::string>();
         }
+        if (vm.count("keypair-cache-dir")) {
+            keypair_cache_dir =
+                vm["keypair-cache-dir"].as<boost::filesystem::path>();
+        }
+        if (vm.count("no-keypair-cache")) {
+            use_keypair_cache = false;
+        }
+        if (vm.count("compact-r1cs")) {
+            compact_r1cs = true;
+        }
+        if (vm.count("log-level")) {
+            try {
+                libzeth::log_set_level(libzeth::log_level_from_string(
+                    vm["log-level"].as<std::string>()));
+            } catch (const std::invalid_argument &e) {
+                throw po::error(e.what());
+            }
+        }
+        if (vm.count("debug-artifacts")) {
+            debug_artifacts = true;
+        }
+        if (vm.count("debug-artifacts-dir")) {
+            debug_artifacts_dir =
+                vm["debug-artifacts-dir"].as<boost::filesystem::path>();
+        }
+        if (vm.count("debug-sample-rate")) {
+            debug_sample_rate = vm["debug-sample-rate"].as<double>();
+            if (!(debug_sample_rate >= 0.0 && debug_sample_rate <= 1.0)) {
+                throw po::error("--debug-sample-rate must be in [0, 1]");
+            }
+        }
+        if (vm.count("debug-max-bytes")) {
+            debug_max_bytes = vm["debug-max-bytes"].as<size_t>();
+        }
+        if (vm.count("debug-r1cs")) {
+            debug_r1cs = true;
+        }
 #ifdef DEBUG
         if (vm.count("jr1cs")) {
             jr1cs_file = vm["jr1cs"].as<boost::filesystem::path>();
@@ -384,9 +647,10 @@ int main(int argc, char **argv)
     }
 
     // We inititalize the curve parameters here
-    std::cout << "[INFO] Init params" << std::endl;
+    ZETH_LOG(info) << "Init params";
     libzeth::ppT::init_public_params();
 
+    libff::enter_block("Construct circuit", true);
     libzeth::circuit_wrapper<
         libzeth::HashT,
         libzeth::HashTreeT,
@@ -395,21 +659,33 @@ int main(int argc, char **argv)
         libzeth::ZETH_NUM_JS_INPUTS,
         libzeth::ZETH_NUM_JS_OUTPUTS,
         libzeth::ZETH_MERKLE_TREE_DEPTH>
-        prover;
-    snark::KeypairT keypair = [&keypair_file, &prover]() {
+        prover(compact_r1cs);
+    libff::leave_block("Construct circuit", true);
+#ifdef DEBUG
+    log_circuit_stats(prover.get_constraint_system());
+#endif
+
+    snark::KeypairT keypair = [&]() {
         if (!keypair_file.empty()) {
 #ifdef ZKSNARK_GROTH16
-            std::cout << "[INFO] Loading keypair: " << keypair_file
-                      << std::endl;
+            ZETH_LOG(info) << "Loading keypair: " << keypair_file;
             return load_keypair(keypair_file);
 #else
-            std::cout << "Keypair loading not supported in this config"
-                      << std::endl;
+            ZETH_LOG(error) << "Keypair loading not supported in this config";
             exit(1);
 #endif
         }
 
-        std::cout << "[INFO] Generate new keypair" << std::endl;
+#ifdef ZKSNARK_GROTH16
+        if (use_keypair_cache) {
+            return get_cached_keypair(prover, keypair_cache_dir);
+        }
+#else
+        (void)use_keypair_cache;
+        (void)keypair_cache_dir;
+#endif
+
+        ZETH_LOG(info) << "Generate new keypair";
         snark::KeypairT keypair = prover.generate_trusted_setup();
 
         // Write the keypair to a file
@@ -420,14 +696,35 @@ int main(int argc, char **argv)
 #ifdef DEBUG
     // Run only if the flag is set
     if (jr1cs_file != "") {
-        std::cout << "[DEBUG] Dump R1CS to json file" << std::endl;
+        ZETH_LOG(debug) << "Dump R1CS to json file";
         std::ofstream jr1cs_stream(jr1cs_file.c_str());
         libzeth::r1cs_write_json<libzeth::ppT>(
             prover.get_constraint_system(), jr1cs_stream);
     }
 #endif
 
-    std::cout << "[INFO] Setup successful, starting the server..." << std::endl;
-    RunServer(prover, keypair);
+    ZETH_LOG(info) << "Setup successful, starting the server...";
+    // Debug artifacts are written asynchronously, and can be enabled or
+    // disabled at runtime by sending SIGUSR1 to the server.
+    libzeth::debug_artifact_sink debug_sink(
+        debug_artifacts_dir,
+        debug_artifacts,
+        debug_sample_rate,
+        debug_max_bytes);
+    signal_debug_sink.store(&debug_sink);
+    signal(SIGUSR1, toggle_debug_artifacts);
+    const std::string debug_setup =
+        debug_sink.begin_unsampled_request("setup");
+    if (debug_r1cs && !debug_setup.empty()) {
+        debug_sink.write(
+            debug_setup, "r1cs.json", [&prover](std::ostream &out) {
+                libzeth::r1cs_write_json<libzeth::ppT>(
+                    prover.get_constraint_system(), out);
+            });
+    }
+
+    RunServer(prover, keypair, debug_sink);
+    signal(SIGUSR1, SIG_IGN);
+    signal_debug_sink.store(nullptr);
     return 0;
 }
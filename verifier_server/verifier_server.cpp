@@ -0,0 +1,318 @@
+// Copyright (c) 2015-2020 Clearmatics Technologies Ltd
+//
+// SPDX-License-Identifier: LGPL-3.0+
+
+#include "libzeth/circuits/circuit_types.hpp"
+#include "libzeth/core/extended_proof.hpp"
+#include "libzeth/core/logging.hpp"
+#include "libzeth/snarks/default/default_api_handler.hpp"
+
+#include <api/verifier.grpc.pb.h>
+#include <atomic>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <fstream>
+#include <grpc/grpc.h>
+#include <grpcpp/resource_quota.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using snark = libzeth::default_snark<libzeth::ppT>;
+using api_handler = libzeth::default_api_handler<libzeth::ppT>;
+
+namespace proto = google::protobuf;
+namespace po = boost::program_options;
+
+/// The verifier_server class implements the Verifier service defined in the
+/// proto files. It holds only the verification key (in its original and
+/// prepared forms), so that it can be started quickly and run separately
+/// from the prover.
+class verifier_server final : public zeth_proto::Verifier::Service
+{
+private:
+    using clock = std::chrono::steady_clock;
+
+    const snark::VerificationKeyT verification_key;
+    const snark::PreparedVerificationKeyT prepared_verification_key;
+
+    // Throughput counters
+    const clock::time_point start_time;
+    std::atomic<uint64_t> num_requests;
+    std::atomic<uint64_t> num_proofs;
+    std::atomic<uint64_t> num_invalid_proofs;
+
+public:
+    explicit verifier_server(const snark::VerificationKeyT &verification_key)
+        : verification_key(verification_key)
+        , prepared_verification_key(
+              snark::prepare_verification_key(verification_key))
+        , start_time(clock::now())
+        , num_requests(0)
+        , num_proofs(0)
+        , num_invalid_proofs(0)
+    {
+    }
+
+    grpc::Status GetVerificationKey(
+        grpc::ServerContext *,
+        const proto::Empty *,
+        zeth_proto::VerificationKey *response) override
+    {
+        try {
+            api_handler::verification_key_to_proto(
+                this->verification_key, response);
+        } catch (const std::exception &e) {
+            ZETH_LOG(error) << e.what();
+            return grpc::Status(
+                grpc::StatusCode::INVALID_ARGUMENT, grpc::string(e.what()));
+        } catch (...) {
+            ZETH_LOG(error) << "In catch all";
+            return grpc::Status(grpc::StatusCode::UNKNOWN, "");
+        }
+
+        return grpc::Status::OK;
+    }
+
+    grpc::Status Verify(
+        grpc::ServerContext *,
+        const zeth_proto::ExtendedProof *ext_proof_proto,
+        zeth_proto::VerifyResponse *response) override
+    {
+        try {
+            const libzeth::extended_proof<libzeth::ppT, snark> ext_proof =
+                api_handler::extended_proof_from_proto(*ext_proof_proto);
+            const bool valid = snark::verify(
+                ext_proof.get_primary_inputs(),
+                ext_proof.get_proof(),
+                thread_prepared_verification_key());
+            response->set_valid(valid);
+            record_request(1, valid ? 0 : 1);
+        } catch (const std::exception &e) {
+            ZETH_LOG(error) << e.what();
+            return grpc::Status(
+                grpc::StatusCode::INVALID_ARGUMENT, grpc::string(e.what()));
+        } catch (...) {
+            ZETH_LOG(error) << "In catch all";
+            return grpc::Status(grpc::StatusCode::UNKNOWN, "");
+        }
+
+        return grpc::Status::OK;
+    }
+
+    grpc::Status VerifyBatch(
+        grpc::ServerContext *,
+        const zeth_proto::VerifyBatchRequest *request,
+        zeth_proto::VerifyBatchResponse *response) override
+    {
+        try {
+            std::vector<libzeth::extended_proof<libzeth::ppT, snark>>
+                ext_proofs;
+            ext_proofs.reserve(request->extended_proofs_size());
+            for (const zeth_proto::ExtendedProof &ext_proof :
+                 request->extended_proofs()) {
+                ext_proofs.push_back(
+                    api_handler::extended_proof_from_proto(ext_proof));
+            }
+
+            std::vector<size_t> invalid_indices;
+            const bool all_valid = snark::verify_batch(
+                ext_proofs,
+                thread_prepared_verification_key(),
+                invalid_indices);
+
+            response->set_all_valid(all_valid);
+            for (const size_t index : invalid_indices) {
+                response->add_invalid_indices(index);
+            }
+            record_request(ext_proofs.size(), invalid_indices.size());
+        } catch (const std::exception &e) {
+            ZETH_LOG(error) << e.what();
+            return grpc::Status(
+                grpc::StatusCode::INVALID_ARGUMENT, grpc::string(e.what()));
+        } catch (...) {
+            ZETH_LOG(error) << "In catch all";
+            return grpc::Status(grpc::StatusCode::UNKNOWN, "");
+        }
+
+        return grpc::Status::OK;
+    }
+
+    grpc::Status GetStatistics(
+        grpc::ServerContext *,
+        const proto::Empty *,
+        zeth_proto::VerifierStatistics *response) override
+    {
+        const uint64_t uptime_ms =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                clock::now() - start_time)
+                .count();
+        const uint64_t proofs = num_proofs;
+        response->set_num_requests(num_requests);
+        response->set_num_proofs(proofs);
+        response->set_num_invalid_proofs(num_invalid_proofs);
+        response->set_uptime_ms(uptime_ms);
+        response->set_proofs_per_second(
+            uptime_ms ? (1000.0 * (double)proofs / (double)uptime_ms) : 0.0);
+        return grpc::Status::OK;
+    }
+
+private:
+    // Each gRPC worker thread verifies using its own copy of the prepared
+    // key, created on first use, so that threads share no key data.
+    const snark::PreparedVerificationKeyT &thread_prepared_verification_key()
+        const
+    {
+        thread_local std::unique_ptr<snark::PreparedVerificationKeyT> pvk;
+        if (!pvk) {
+            pvk.reset(new snark::PreparedVerificationKeyT(
+                prepared_verification_key));
+        }
+        return *pvk;
+    }
+
+    void record_request(uint64_t proofs, uint64_t invalid_proofs)
+    {
+        ++num_requests;
+        num_proofs += proofs;
+        num_invalid_proofs += invalid_proofs;
+    }
+};
+
+static snark::VerificationKeyT load_verification_key(
+    const std::string &vk_file)
+{
+    std::ifstream in(vk_file, std::ios_base::in | std::ios_base::binary);
+    in.exceptions(
+        std::ios_base::eofbit | std::ios_base::badbit | std::ios_base::failbit);
+    return snark::verification_key_read_bytes(in);
+}
+
+static snark::VerificationKeyT load_verification_key_proto(
+    const std::string &vk_proto_file)
+{
+    std::ifstream in(vk_proto_file, std::ios_base::in | std::ios_base::binary);
+    zeth_proto::VerificationKey vk_proto;
+    if (!in.good() || !vk_proto.ParseFromIstream(&in)) {
+        throw std::invalid_argument(
+            "failed to read verification key: " + vk_proto_file);
+    }
+    return api_handler::verification_key_from_proto(vk_proto);
+}
+
+static void RunServer(
+    const snark::VerificationKeyT &verification_key,
+    const std::string &server_address,
+    const size_t num_threads)
+{
+    verifier_server service(verification_key);
+
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    builder.RegisterService(&service);
+
+    // Bound the pool of threads used to serve (synchronous) requests.
+    grpc::ResourceQuota quota("verifier_server");
+    quota.SetMaxThreads((int)num_threads);
+    builder.SetResourceQuota(quota);
+    builder.SetSyncServerOption(
+        grpc::ServerBuilder::SyncServerOption::MAX_POLLERS, (int)num_threads);
+
+    std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+    ZETH_LOG(info) << "Verifier server listening on " << server_address << " ("
+                   << num_threads << " threads)";
+    server->Wait();
+}
+
+int main(int argc, char **argv)
+{
+    // Options
+    po::options_description options("");
+    options.add_options()("help,h", "This help")(
+        "vk", po::value<std::string>(), "file to load verification key from")(
+        "vk-proto",
+        po::value<std::string>(),
+        "file to load (protobuf-encoded) verification key from")(
+        "address",
+        po::value<std::string>(),
+        "address to listen on (default: 0.0.0.0:50052)")(
+        "threads",
+        po::value<size_t>(),
+        "number of request threads (default: number of cores)")(
+        "log-level",
+        po::value<std::string>(),
+        "minimum level of log records: trace, debug, info, warning, error or "
+        "off (default: info)");
+
+    auto usage = [&]() {
+        std::cout << "Usage:"
+                  << "\n"
+                  << "  " << argv[0] << " [<options>]\n"
+                  << "\n";
+        std::cout << options;
+        std::cout << std::endl;
+    };
+
+    std::string vk_file;
+    std::string vk_proto_file;
+    std::string server_address("0.0.0.0:50052");
+    size_t num_threads = std::thread::hardware_concurrency();
+    try {
+        po::variables_map vm;
+        po::store(
+            po::command_line_parser(argc, argv).options(options).run(), vm);
+        if (vm.count("help")) {
+            usage();
+            return 0;
+        }
+        if (vm.count("vk")) {
+            vk_file = vm["vk"].as<std::string>();
+        }
+        if (vm.count("vk-proto")) {
+            vk_proto_file = vm["vk-proto"].as<std::string>();
+        }
+        if (vm.count("address")) {
+            server_address = vm["address"].as<std::string>();
+        }
+        if (vm.count("threads")) {
+            num_threads = vm["threads"].as<size_t>();
+        }
+        if (vm.count("log-level")) {
+            try {
+                libzeth::log_set_level(libzeth::log_level_from_string(
+                    vm["log-level"].as<std::string>()));
+            } catch (const std::invalid_argument &e) {
+                throw po::error(e.what());
+            }
+        }
+        if (vk_file.empty() == vk_proto_file.empty()) {
+            throw po::error("exactly one of --vk or --vk-proto is required");
+        }
+        if (0 == num_threads) {
+            num_threads = 1;
+        }
+    } catch (po::error &error) {
+        std::cerr << " ERROR: " << error.what() << std::endl;
+        usage();
+        return 1;
+    }
+
+    libzeth::ppT::init_public_params();
+
+    try {
+        const snark::VerificationKeyT verification_key =
+            vk_file.empty() ? load_verification_key_proto(vk_proto_file)
+                            : load_verification_key(vk_file);
+        RunServer(verification_key, server_address, num_threads);
+    } catch (const std::exception &e) {
+        ZETH_LOG(error) << e.what();
+        return 1;
+    }
+
+    return 0;
+}